@@ -5,23 +5,121 @@
 /// @brief  Interface from Developer Tools to ADL.
 //==============================================================================
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdlib>
 #include <cstring>
-#include <sstream>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory_resource>
+#include <new>
 #include <string>
-#include <charconv>
-#include <cassert>
 #include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "ADLUtilEntrypoints.h"
+#include "ADLUtilAsync.h"
+#include "ADLUtilASICDatabase.h"
+#include "ADLUtilAtomicSharedPtr.h"
+#include "ADLUtilCache.h"
+#include "ADLUtilCachedQuery.h"
+#include "ADLUtilLoader.h"
+#include "ADLUtilPhysicalGPUIndex.h"
+#include "ADLUtilReplay.h"
+#include "ADLUtilSysfs.h"
+#include "ADLUtilTopology.h"
+
+// Number of queries in a row that miss the call deadline before the circuit breaker holds new queries back
+static constexpr uint32_t s_circuitBreakerThreshold = 3;
+
+// Backoff of the circuit breaker once it trips, doubled with every further timeout up to s_maxBackoff
+static constexpr std::chrono::milliseconds s_initialBackoff(1000);
+static constexpr std::chrono::milliseconds s_maxBackoff(60000);
+
+// Age after which a persistent cache file whose driver did not change is revalidated anyway, by default
+static constexpr std::chrono::hours s_defaultCacheRevalidationAge(24);
+
+// Time the singleton's destructor waits for outstanding leases before it leaves the library loaded
+static constexpr std::chrono::milliseconds s_shutdownLeaseTimeout(5000);
+
+// Size of the callback arena; enough for the AdapterInfo array of a few dozen logical adapters. Allocations that do not
+// fit come from the heap.
+static constexpr size_t s_callbackArenaSize = 256 * 1024;
+
+// Arena serving the ADL allocation callback in arena allocation mode. ADL only allocates through the callback for data
+// it returns to the caller, so the arena is rewound whenever the last ArenaScope closes.
+static struct
+{
+    std::mutex                                           mutex;                    ///< serializes use of the resource
+    std::atomic<bool>                                    enabled{false};           ///< true while the library is loaded in arena mode
+    unsigned int                                         openScopes = 0;           ///< number of live ArenaScope objects of all threads
+    std::vector<char>                                    buffer;                   ///< the memory of the arena, kept across rewinds
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> resource;                 ///< the arena, serving from buffer only
+    std::atomic<uint64_t>                                heapAllocations{0};       ///< callback allocations served by malloc
+    std::atomic<uint64_t>                                arenaAllocations{0};      ///< callback allocations served by the arena
+    std::atomic<uint64_t>                                arenaResets{0};           ///< number of arena rewinds
+} s_callbackArena;
+
+// Number of ArenaScope objects live on this thread. ADL calls the allocation callback on the thread that called it, so only
+// the calls made inside a scope are served from the arena; the sampler, the context pool and user calls keep using the heap.
+static thread_local unsigned int t_openArenaScopes = 0;
+
+// Keeps the callback arena from being rewound while ADL-allocated data is in use, and serves the allocations of this thread from it
+class ArenaScope
+{
+public:
+    ArenaScope()
+    {
+        std::lock_guard<std::mutex> lock(s_callbackArena.mutex);
+        ++s_callbackArena.openScopes;
+        ++t_openArenaScopes;
+    }
 
-#include "ADLUtil.h"
+    ~ArenaScope()
+    {
+        std::lock_guard<std::mutex> lock(s_callbackArena.mutex);
+        --t_openArenaScopes;
 
-#include <Windows.h>
+        if (0 == --s_callbackArena.openScopes && nullptr != s_callbackArena.resource)
+        {
+            s_callbackArena.resource->release();
+            ++s_callbackArena.arenaResets;
+        }
+    }
+};
 
 // Callback so that ADL can allocate memory
 void* __stdcall ADL_Main_Memory_Alloc(int iSize)
 {
-    void* lpBuffer = malloc(iSize);
-    return lpBuffer;
+    size_t size = static_cast<size_t>(iSize);
+
+    if (0 < t_openArenaScopes && s_callbackArena.enabled.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(s_callbackArena.mutex);
+
+        if (nullptr != s_callbackArena.resource)
+        {
+            try
+            {
+                void* pBuffer = s_callbackArena.resource->allocate(size, alignof(std::max_align_t));
+                ++s_callbackArena.arenaAllocations;
+                return pBuffer;
+            }
+            catch (const std::bad_alloc&)
+            {
+                // the arena is full until the next rewind
+            }
+        }
+    }
+
+    // everything outside the arena is plain malloc memory, so that a caller handed the buffer can free it
+    ++s_callbackArena.heapAllocations;
+    return malloc(size);
 }
 
 // Optional ADL Memory de-allocation function
@@ -29,405 +127,2187 @@ void __stdcall ADL_Main_Memory_Free(void** lpBuffer)
 {
     if (nullptr != *lpBuffer)
     {
-        free(*lpBuffer);
+        bool isArenaBuffer = false;
+
+        if (s_callbackArena.enabled.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(s_callbackArena.mutex);
+            const char*                 pBuffer = static_cast<const char*>(*lpBuffer);
+            const char*                 pArena = s_callbackArena.buffer.data();
+
+            isArenaBuffer = pArena <= pBuffer && pArena + s_callbackArena.buffer.size() > pBuffer;
+        }
+
+        // arena memory is reclaimed all at once when the arena is rewound
+        if (!isArenaBuffer)
+        {
+            free(*lpBuffer);
+        }
+
         *lpBuffer = nullptr;
     }
 }
 
-// Converts a string to its decimal equivalent, the integer base is specified as a template argument
-template <int base>
-static int adl_from_chars(std::string_view str)
+// Switches the allocation callback between malloc and the arena. Only called while the library is not loaded.
+static void EnableCallbackArena(bool enable)
 {
-    int result{};
-    auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), result, base);
-    if (ec == std::errc())
+    std::lock_guard<std::mutex> lock(s_callbackArena.mutex);
+
+    if (enable && nullptr == s_callbackArena.resource)
     {
-        return result;
+        s_callbackArena.buffer.resize(s_callbackArenaSize);
+        s_callbackArena.resource = std::make_unique<std::pmr::monotonic_buffer_resource>(s_callbackArena.buffer.data(), s_callbackArena.buffer.size(),
+                                                                                         std::pmr::null_memory_resource());
+    }
+    else if (!enable && nullptr != s_callbackArena.resource)
+    {
+        s_callbackArena.enabled.store(false, std::memory_order_release);
+        s_callbackArena.resource.reset();
+        s_callbackArena.buffer = std::vector<char>();
     }
-    // Otherwise conversion failed
-    assert(false);
-    return 0;
+
+    s_callbackArena.enabled.store(enable, std::memory_order_release);
 }
 
-ADLUtil_Result ADLUtil_GetASICInfo(AsicInfoList& asicInfoList)
+// Parses a fixed number of hex digits at the start of a UDID token. The digits must be followed by the end of the token or '_'.
+static bool ParseHexField(std::string_view token, size_t digitCount, unsigned int& value)
 {
-    return AMDTADLUtils::Instance()->GetAsicInfoList(asicInfoList);
-}
+    if (token.size() < digitCount || (token.size() > digitCount && '_' != token[digitCount]))
+    {
+        return false;
+    }
 
+    unsigned int result = 0;
 
-ADLUtil_Result
-ADLUtil_GetVersionsInfo(
-    struct ADLVersionsInfo& info)
-{
-    return AMDTADLUtils::Instance()->GetADLVersionsInfo(info);
-}
+    for (size_t i = 0; i < digitCount; ++i)
+    {
+        char c = token[i];
+        unsigned int digit;
 
-AMDTADLUtils::AMDTADLUtils() :
-    m_libHandle(nullptr),
-    m_adlContext(nullptr),
-    m_asicInfoListRetVal(ADL_RESULT_NONE),
-    m_versionRetVal(ADL_RESULT_NONE)
-{
-#define X(SYM) m_##SYM = nullptr;
-    ADL_INTERFACE_TABLE
-#undef X
+        if ('0' <= c && '9' >= c)
+        {
+            digit = c - '0';
+        }
+        else if ('A' <= c && 'F' >= c)
+        {
+            digit = c - 'A' + 10;
+        }
+        else if ('a' <= c && 'f' >= c)
+        {
+            digit = c - 'a' + 10;
+        }
+        else
+        {
+            return false;
+        }
+
+        result = (result << 4) | digit;
+    }
+
+    value = result;
+    return true;
 }
 
-AMDTADLUtils::~AMDTADLUtils()
+// Removes the prefix from the token if it starts with it
+static bool ConsumePrefix(std::string_view& token, std::string_view prefix)
 {
-    Unload();
+    if (0 == token.compare(0, prefix.size(), prefix))
+    {
+        token.remove_prefix(prefix.size());
+        return true;
+    }
+
+    return false;
 }
 
-ADLUtil_Result AMDTADLUtils::LoadAndInit()
+ADLUtil_UDIDParseResult ADLUtil_ParseUDID(std::string_view udid, ADLUtil_PCIIdentity& pciIdentity)
 {
-    ADLUtil_Result result = ADL_SUCCESS;
+    constexpr unsigned int foundVendor   = 0x1;
+    constexpr unsigned int foundDevice   = 0x2;
+    constexpr unsigned int foundRevision = 0x4;
 
-    if (nullptr == m_libHandle)
+    pciIdentity = ADLUtil_PCIIdentity();
+
+    unsigned int found     = 0;
+    bool         malformed = false;
+
+    // UDIDs look like PCI_VEN_1002&DEV_67DF&SUBSYS_E3871DA2&REV_E7_4&2A3D0B5A&0&0008;
+    // visit each '&' or '\' separated token once and dispatch on its keyword
+    while (!udid.empty())
     {
-#ifdef _WIN64
-        // 64 bit Windows library
-        m_libHandle = LoadLibraryA("atiadlxx.dll");
-#elif defined(_WIN32)
-        // 32 bit Windows library
-        m_libHandle = LoadLibraryA("atiadlxy.dll");
-#endif
+        size_t tokenEnd = udid.find_first_of("&\\");
+        std::string_view token = udid.substr(0, tokenEnd);
+        udid.remove_prefix((std::string_view::npos == tokenEnd) ? udid.size() : tokenEnd + 1);
 
-        if (nullptr == m_libHandle)
-        {
-            result = ADL_NOT_FOUND;
-        }
+        ConsumePrefix(token, "PCI_");
 
-#define X(SYM)                                               \
-    m_##SYM = (SYM##_fn)::GetProcAddress(m_libHandle, #SYM); \
-    if (nullptr == m_##SYM)                                  \
-    {                                                        \
-        Unload();                                            \
-        result = ADL_MISSING_ENTRYPOINTS;                    \
-    }
-        ADL_INTERFACE_TABLE;
-#undef X
+        unsigned int value = 0;
 
-        if (ADL_SUCCESS == result)
+        if (ConsumePrefix(token, "VEN_"))
         {
-            int adlResult;
-
-            // Initialize ADL. The second parameter is 1, which means:
-            // retrieve adapter information only for adapters that are physically present and enabled in the system
-            if (nullptr != m_ADL2_Main_Control_Create)
+            malformed |= !ParseHexField(token, 4, value);
+            pciIdentity.vendorID = static_cast<int>(value);
+            found |= foundVendor;
+        }
+        else if (ConsumePrefix(token, "DEV_"))
+        {
+            if (ParseHexField(token, 4, value))
             {
-                adlResult = m_ADL2_Main_Control_Create(ADL_Main_Memory_Alloc, 1, &m_adlContext);
+                pciIdentity.deviceID = static_cast<int>(value);
+                pciIdentity.deviceIDString = token.substr(0, 4);
             }
             else
             {
-                adlResult = m_ADL_Main_Control_Create(ADL_Main_Memory_Alloc, 1);
+                malformed = true;
             }
 
-            if (ADL_OK != adlResult && ADL_OK_WARNING != adlResult)
-            {
-                Unload();
-                return ADL_INITIALIZATION_FAILED;
-            }
+            found |= foundDevice;
+        }
+        else if (ConsumePrefix(token, "SUBSYS_"))
+        {
+            malformed |= !ParseHexField(token, 8, value);
+            pciIdentity.subsystemID = value;
+        }
+        else if (ConsumePrefix(token, "REV_"))
+        {
+            malformed |= !ParseHexField(token, 2, value);
+            pciIdentity.revID = static_cast<int>(value);
+            found |= foundRevision;
         }
     }
 
-    return result;
+    if (malformed)
+    {
+        return ADL_UDID_MALFORMED_FIELD;
+    }
+    else if (0 == (found & foundVendor))
+    {
+        return ADL_UDID_MISSING_VENDOR;
+    }
+    else if (0 == (found & foundDevice))
+    {
+        return ADL_UDID_MISSING_DEVICE;
+    }
+    else if (0 == (found & foundRevision))
+    {
+        return ADL_UDID_MISSING_REVISION;
+    }
+
+    return ADL_UDID_OK;
 }
 
-ADLUtil_Result AMDTADLUtils::Unload()
+ADLUtil_UDIDParseResult ADLUtil_ParseAdapterInfo(const AdapterInfo& adapterInfo, ADLUtil_ASICInfo& asicInfo)
 {
-    ADLUtil_Result result = ADL_SUCCESS;
+    // ADL fills fixed size buffers, don't rely on them being NUL-terminated
+    std::string_view adapterName(adapterInfo.strAdapterName, strnlen(adapterInfo.strAdapterName, ADL_MAX_PATH));
+    std::string_view udid(adapterInfo.strUDID, strnlen(adapterInfo.strUDID, ADL_MAX_PATH));
 
-    if (nullptr != m_libHandle)
-    {
-        if (nullptr != m_ADL2_Main_Control_Destroy)
-        {
-            if (nullptr != m_adlContext)
-            {
-                m_ADL2_Main_Control_Destroy(m_adlContext);
-                m_adlContext = nullptr;
-            }
-        }
-        else if (nullptr != m_ADL_Main_Control_Destroy)
-        {
-            m_ADL_Main_Control_Destroy();
-        }
+    // trim trailing whitespace
+    size_t nameLength = adapterName.find_last_not_of(' ');
+    asicInfo.adapterName = adapterName.substr(0, (std::string_view::npos == nameLength) ? 0 : nameLength + 1);
+    asicInfo.gpuIndex = 0; // numbered per physical GPU by ADLUtil_FillAdapterTopology once the list is complete
+    asicInfo.adapterIndex = adapterInfo.iAdapterIndex;
+    asicInfo.udid = udid;
 
-        FreeLibrary(m_libHandle);
-        m_libHandle = nullptr;
+    ADLUtil_PCIIdentity pciIdentity;
+    ADLUtil_UDIDParseResult result = ADLUtil_ParseUDID(udid, pciIdentity);
 
-#define X(SYM) m_##SYM = nullptr;
-        ADL_INTERFACE_TABLE
-#undef X
-    }
+    asicInfo.vendorID       = pciIdentity.vendorID;
+    asicInfo.deviceID       = pciIdentity.deviceID;
+    asicInfo.deviceIDString = pciIdentity.deviceIDString;
+    asicInfo.revID          = pciIdentity.revID;
+    asicInfo.subsystemID    = pciIdentity.subsystemID;
 
-    Reset();
+    asicInfo.busNumber      = adapterInfo.iBusNumber;
+    asicInfo.deviceNumber   = adapterInfo.iDeviceNumber;
+    asicInfo.functionNumber = adapterInfo.iFunctionNumber;
+
+    asicInfo.registryPath    = std::string_view(adapterInfo.strDriverPath, strnlen(adapterInfo.strDriverPath, ADL_MAX_PATH));
+    asicInfo.registryPathExt = std::string_view(adapterInfo.strDriverPathExt, strnlen(adapterInfo.strDriverPathExt, ADL_MAX_PATH));
+
+    ADLUtil_ASICDatabase::Classify(asicInfo);
 
     return result;
 }
 
-
-ADLUtil_Result AMDTADLUtils::GetAsicInfoList(AsicInfoList& asicInfoList)
+// Compares the keys that identify adapters across enumerations, the PCI domain and bus location and the UDID
+// @returns a negative value, 0 or a positive value if the key of lhs is ordered before, equal to or after the key of rhs.
+static int CompareAdapterKeys(const ADLUtil_ASICInfo& lhs, const ADLUtil_ASICInfo& rhs)
 {
-    std::lock_guard<std::mutex> lock(m_asicInfoMutex);
+    uint64_t lhsBusKey = ADLUtil_PhysicalGPUIndex::MakeBusKey(lhs.topology.pciDomain, lhs.busNumber, lhs.deviceNumber, lhs.functionNumber);
+    uint64_t rhsBusKey = ADLUtil_PhysicalGPUIndex::MakeBusKey(rhs.topology.pciDomain, rhs.busNumber, rhs.deviceNumber, rhs.functionNumber);
 
-    if (ADL_RESULT_NONE == m_asicInfoListRetVal)
+    if (lhsBusKey != rhsBusKey)
     {
-        m_asicInfoListRetVal = LoadAndInit();
-
-        if (ADL_SUCCESS == m_asicInfoListRetVal)
-        {
-            int adlResult = ADL_OK;
-
-            int numAdapter = 0;
-
-            // Obtain the number of logical adapters for the system
-            // EX: Even if you only have 2 physical GPUs you may logically have 10 adapters.
-            if (nullptr != m_ADL2_Adapter_NumberOfAdapters_Get)
-            {
-                adlResult = m_ADL2_Adapter_NumberOfAdapters_Get(m_adlContext, &numAdapter);
-            }
-            else
-            {
-                adlResult = m_ADL_Adapter_NumberOfAdapters_Get(&numAdapter);
-            }
+        return (lhsBusKey < rhsBusKey) ? -1 : 1;
+    }
 
-            if (ADL_OK != adlResult)
-            {
-                m_asicInfoListRetVal = ADL_GET_ADAPTER_COUNT_FAILED;
-            }
-            else
-            {
-                if (0 < numAdapter)
-                {
-                    LPAdapterInfo lpAdapterInfo = reinterpret_cast<LPAdapterInfo>(malloc(sizeof(AdapterInfo) * numAdapter));
+    return std::string_view(lhs.udid).compare(std::string_view(rhs.udid));
+}
 
-                    if (nullptr == lpAdapterInfo)
-                    {
-                        return ADLUtil_Result::ADL_GET_ADAPTER_INFO_FAILED;
-                    }
-                    else
-                    {
-                        memset(lpAdapterInfo, '\0', sizeof(AdapterInfo) * numAdapter);
+// Orders the adapters of a list by the key that identifies an adapter across enumerations, the PCI domain and bus location and the UDID.
+// Adapters with the same key keep their list order.
+static std::vector<uint32_t> SortByAdapterKey(const AsicInfoList& asicInfoList)
+{
+    std::vector<uint32_t> order(asicInfoList.size());
 
-                        // Get the AdapterInfo structure for all adapters in the system
-                        if (nullptr != m_ADL2_Adapter_AdapterInfo_Get)
-                        {
-                            adlResult = m_ADL2_Adapter_AdapterInfo_Get(m_adlContext, lpAdapterInfo, sizeof(AdapterInfo) * numAdapter);
-                        }
-                        else
-                        {
-                            adlResult = m_ADL_Adapter_AdapterInfo_Get(lpAdapterInfo, sizeof(AdapterInfo) * numAdapter);
-                        }
+    for (uint32_t i = 0; i < static_cast<uint32_t>(order.size()); ++i)
+    {
+        order[i] = i;
+    }
 
-                        if (ADL_OK == adlResult)
-                        {
-                            for (int i = 0; i < numAdapter; ++i)
-                            {
-                                std::string_view adapterName = lpAdapterInfo[i].strAdapterName;
-                                std::string_view adapterInfo = lpAdapterInfo[i].strUDID;
-
-                                // trim trailing whitespace
-                                size_t lastNonSpace = adapterName.length() - 1;
-
-                                while (adapterName[lastNonSpace] == ' ')
-                                {
-                                    --lastNonSpace;
-                                }
-
-                                ADLUtil_ASICInfo asicInfo;
-                                asicInfo.adapterName = adapterName.substr(0, lastNonSpace + 1);
-                                asicInfo.gpuIndex = 0;
-
-                                size_t vendorIndex = adapterInfo.find("PCI_VEN_") + strlen("PCI_VEN_");
-                                size_t devIndex = adapterInfo.find("&DEV_") + strlen("&DEV_");
-                                size_t revIndex = adapterInfo.find("&REV_") + strlen("&REV_");
-
-                                if (vendorIndex != std::string_view::npos)
-                                {
-                                    std::string_view vendorIDString = adapterInfo.substr(vendorIndex, 4);
-                                    asicInfo.vendorID = adl_from_chars<16>(vendorIDString);
-                                }
-                                else
-                                {
-                                    asicInfo.vendorID = 0;
-                                }
-
-                                if (devIndex != std::string_view::npos)
-                                {
-                                    asicInfo.deviceIDString = adapterInfo.substr(devIndex, 4);
-                                    asicInfo.deviceID = adl_from_chars<16>(asicInfo.deviceIDString);
-                                }
-                                else
-                                {
-                                    asicInfo.deviceIDString.clear();
-                                    asicInfo.deviceID = 0;
-                                }
-
-                                if (revIndex != std::string_view::npos)
-                                {
-                                    std::string_view revIDString = adapterInfo.substr(revIndex, 2);
-                                    asicInfo.revID = adl_from_chars<16>(revIDString);
-                                }
-                                else
-                                {
-                                    asicInfo.revID = 0;
-                                }
-
-                                asicInfo.registryPath = lpAdapterInfo[i].strDriverPath;
-                                asicInfo.registryPathExt = lpAdapterInfo[i].strDriverPathExt;
-
-                                m_asicInfoList.push_back(asicInfo);
-                            }
+    std::sort(order.begin(), order.end(), [&asicInfoList](uint32_t lhs, uint32_t rhs)
+    {
+        int keyOrder = CompareAdapterKeys(asicInfoList[lhs], asicInfoList[rhs]);
+        return (0 != keyOrder) ? (0 > keyOrder) : (lhs < rhs);
+    });
 
-                            ADL_Main_Memory_Free(reinterpret_cast<void**>(&lpAdapterInfo));
-                        }
-                        else
-                        {
-                            m_asicInfoListRetVal = ADL_GET_ADAPTER_INFO_FAILED;
-                        }
-                    }
-                }
-            }
-        }
-    }
+    return order;
+}
 
-    asicInfoList = m_asicInfoList;
-    return m_asicInfoListRetVal;
+// Returns true if two ADLUtil_ASICInfo are identical
+static bool IsSameAsicInfo(const ADLUtil_ASICInfo& lhs, const ADLUtil_ASICInfo& rhs)
+{
+    return lhs.adapterName == rhs.adapterName &&
+           lhs.deviceIDString == rhs.deviceIDString &&
+           lhs.vendorID == rhs.vendorID &&
+           lhs.deviceID == rhs.deviceID &&
+           lhs.revID == rhs.revID &&
+           lhs.subsystemID == rhs.subsystemID &&
+           lhs.busNumber == rhs.busNumber &&
+           lhs.deviceNumber == rhs.deviceNumber &&
+           lhs.functionNumber == rhs.functionNumber &&
+           lhs.gpuIndex == rhs.gpuIndex &&
+           lhs.adapterIndex == rhs.adapterIndex &&
+           lhs.udid == rhs.udid &&
+           lhs.registryPath == rhs.registryPath &&
+           lhs.registryPathExt == rhs.registryPathExt &&
+           lhs.topology.pciDomain == rhs.topology.pciDomain &&
+           lhs.topology.numaNode == rhs.topology.numaNode;
 }
 
-ADLUtil_Result AMDTADLUtils::GetADLVersionsInfo(ADLVersionsInfo& adlVersionInfo)
+void ADLUtil_DiffAsicInfoLists(const AsicInfoList& previousList, const AsicInfoList& currentList, ADLUtil_AdapterChanges& changes)
 {
-    std::lock_guard<std::mutex> lock(m_adlVersionsMutex);
+    changes.added.clear();
+    changes.removed.clear();
+    changes.changed.clear();
 
-    if (ADL_RESULT_NONE == m_versionRetVal)
+    // walk both lists in key order; adapters that share a key, like the logical adapters of one GPU, are matched in list order
+    std::vector<uint32_t> previousOrder = SortByAdapterKey(previousList);
+    std::vector<uint32_t> currentOrder = SortByAdapterKey(currentList);
+
+    size_t previousPos = 0;
+    size_t currentPos = 0;
+
+    while (previousPos < previousOrder.size() || currentPos < currentOrder.size())
     {
-        m_versionRetVal = LoadAndInit();
+        int keyOrder;
 
-        if (ADL_SUCCESS == m_versionRetVal)
+        if (previousOrder.size() == previousPos)
+        {
+            keyOrder = 1;
+        }
+        else if (currentOrder.size() == currentPos)
         {
-            int adlResult = ADL_OK;
+            keyOrder = -1;
+        }
+        else
+        {
+            keyOrder = CompareAdapterKeys(previousList[previousOrder[previousPos]], currentList[currentOrder[currentPos]]);
+        }
 
-            if (nullptr != m_ADL2_Graphics_Versions_Get)
-            {
-                adlResult = m_ADL2_Graphics_Versions_Get(m_adlContext, &m_adlVersionsInfo);
-            }
-            else
-            {
-                adlResult = m_ADL_Graphics_Versions_Get(&m_adlVersionsInfo);
-            }
+        if (0 > keyOrder)
+        {
+            changes.removed.push_back(previousOrder[previousPos++]);
+        }
+        else if (0 < keyOrder)
+        {
+            changes.added.push_back(currentOrder[currentPos++]);
+        }
+        else
+        {
+            uint32_t previous = previousOrder[previousPos++];
+            uint32_t current = currentOrder[currentPos++];
 
-            if (ADL_OK != adlResult)
+            if (!IsSameAsicInfo(previousList[previous], currentList[current]))
             {
-                if (ADL_OK_WARNING == adlResult)
-                {
-                    m_versionRetVal = ADL_WARNING;
-                }
-                else // ADL_OK_WARNING != adlResult
-                {
-                    m_versionRetVal = ADL_GRAPHICS_VERSIONS_GET_FAILED;
-                }
+                changes.changed.emplace_back(previous, current);
             }
         }
     }
 
-    adlVersionInfo = m_adlVersionsInfo;
-    return m_versionRetVal;
+    // report in list order
+    std::sort(changes.added.begin(), changes.added.end());
+    std::sort(changes.removed.begin(), changes.removed.end());
+    std::sort(changes.changed.begin(), changes.changed.end(), [](const std::pair<uint32_t, uint32_t>& lhs, const std::pair<uint32_t, uint32_t>& rhs)
+    {
+        return lhs.second < rhs.second;
+    });
 }
 
-ADLUtil_Result AMDTADLUtils::GetDriverVersion(unsigned int& majorVer, unsigned int& minorVer, unsigned int& subMinorVer) const
+ADLUtil_Result ADLUtil_GetASICInfo(AsicInfoList& asicInfoList)
 {
-    majorVer = 0;
-    minorVer = 0;
-    subMinorVer = 0;
+    // read the C++ cache rather than the C records, whose strings are truncated and which lack the topology
+    return AMDTADLUtils::Instance()->GetAsicInfoList(asicInfoList);
+}
 
-    ADLVersionsInfo driverVerInfo;
-    ADLUtil_Result adlResult = AMDTADLUtils::Instance()->GetADLVersionsInfo(driverVerInfo);
 
-    if (adlResult == ADL_SUCCESS)
-    {
-        std::string_view strDriverVersion(driverVerInfo.strDriverVer);
+ADLUtil_Result
+ADLUtil_GetVersionsInfo(
+    struct ADLVersionsInfo& info)
+{
+    return AMDTADLUtils::Instance()->GetADLVersionsInfo(info);
+}
 
-        // driver version looks like:  13.35.1005-140131a-167669E-ATI or 14.10-140115n-021649E-ATI, etc...
-        // truncate at the first dash
-        strDriverVersion = strDriverVersion.substr(0, strDriverVersion.find('-', 0));
+//------------------------------------------------------------------------------------
+/// The state and the implementation of AMDTADLUtils. The public members mirror the
+/// AMDTADLUtils API, which forwards to them; see ADLUtil.h for their documentation.
+//------------------------------------------------------------------------------------
+class AMDTADLUtils::Impl
+{
+public:
+    /// constructor
+    /// @param[in] owner the singleton
+    explicit Impl(AMDTADLUtils& owner);
+
+    /// Waits for the background work and unloads ADL. Called by the singleton's destructor while it is still intact.
+    void Shutdown();
+
+    ADLUtil_Result LoadAndInit();
+    ADLUtil_Result Unload(std::chrono::milliseconds leaseTimeout);
+    ADLUtil_Result AcquireLease(Lease& lease);
+    void SetIdleUnloadTimeout(std::chrono::milliseconds timeout);
+    void SetLibraryName(const std::string& libraryName);
+    void SetUseArenaAllocator(bool useArena);
+    void SetBackend(ADLUtil_Backend backend);
+    void SetSysfsRoot(const std::string& sysfsRoot);
+    void SetRecordPath(const std::string& recordPath);
+    void SetReplayPath(const std::string& replayPath, bool replayLatency);
+    ADLUtil_Result GetAsicInfoList(AsicInfoListSnapshot& asicInfoList);
+    ADLUtil_Result GetPhysicalGPUIndex(std::shared_ptr<const ADLUtil_PhysicalGPUIndex>& physicalGPUIndex);
+    std::shared_future<ADLUtil_Result> PrefetchAsync();
+    std::future<ADLUtil_Result> GetAsicInfoListAsync(AsicInfoListCallback callback);
+    ADLUtil_Result GetADLVersionsInfo(ADLVersionsInfo& adlVersionInfo);
+    ADLUtil_Result GetVersionsInfo(ADLUtil_VersionsInfo& versionsInfo);
+    std::future<ADLUtil_Result> GetADLVersionsInfoAsync(ADLVersionsInfoCallback callback);
+    ADLUtil_Result GetDriverVersion(ADLUtil_DriverVersion& driverVersion);
+    void SetPersistentCachePath(const std::string& cachePath, std::chrono::seconds revalidationAge);
+    void SetCallDeadline(std::chrono::milliseconds deadline);
+    void Reset();
+    ADLUtil_Result Refresh();
+    uint64_t Subscribe(AdapterChangesCallback callback);
+    void Unsubscribe(uint64_t subscriptionID);
+
+    /// @returns true if the loaded ADL library exports the entry point.
+    template <ADLUtil_Entrypoint Sym>
+    bool IsAvailable()
+    {
+        return nullptr != GetEntrypointAddress(Sym);
+    }
 
-        constexpr char strDelimiter = '.';
+    /// Calls an ADL entry point through the singleton, so that the call is instrumented like any other
+    template <ADLUtil_Entrypoint Sym, typename... Args>
+    int Call(Args... args)
+    {
+        return m_owner.Call<Sym>(args...);
+    }
 
-        // parse the major driver version
-        size_t pos = strDriverVersion.find(strDelimiter);
+    /// The enumerated ASIC list together with the result of the query that produced it
+    struct AsicInfoCache
+    {
+        AsicInfoList                                    asicInfoList;     ///< the ADL ASIC list
+        ADLUtil_Result                                  result;           ///< the result of the AsicInfoList query
+        std::shared_ptr<const ADLUtil_PhysicalGPUIndex> physicalGPUIndex; ///< the physical GPUs of asicInfoList
+        uint64_t                                        generation;       ///< the adapter generation of asicInfoList
+    };
+
+    /// A registered AdapterChangesCallback
+    struct Subscription
+    {
+        uint64_t               id;       ///< the ID returned by Subscribe
+        AdapterChangesCallback callback; ///< the callback
+    };
 
-        if (pos != std::string_view::npos)
-        {
-            std::string_view strToken = strDriverVersion.substr(0, pos);
-            std::stringstream ss;
-            ss.str(strToken.data());
+    typedef std::vector<Subscription> SubscriptionList; ///< the registered callbacks
 
-            if ((ss >> majorVer).fail())
-            {
-                majorVer = 0;
-            }
-            else
-            {
-                adlResult = ADL_SUCCESS;
-                strDriverVersion.remove_prefix(pos + 1);
-            }
+    /// The ADL version info together with the result of the query that produced it and the parsed driver version
+    struct VersionsCache
+    {
+        ADLVersionsInfo       adlVersionsInfo; ///< the ADL Version info
+        ADLUtil_Result        result;          ///< the result of the ADL Version query
+        ADLUtil_DriverVersion driverVersion;   ///< adlVersionsInfo.strDriverVer parsed
+        ADLUtil_VersionsInfo  versionsInfo;    ///< the strings of adlVersionsInfo
+    };
+
+    /// A query run on the deadline worker under the call deadline
+    /// @tparam T what the query returns
+    template <typename T>
+    struct DeadlineTask
+    {
+        std::promise<T>       promise;          ///< set by the deadline worker once the query completed
+        std::shared_future<T> result;           ///< the result of the query
+        bool                  timedOut = false; ///< true once a caller gave up waiting for the query, protected by m_deadlineMutex
+    };
+
+    typedef DeadlineTask<std::shared_ptr<const AsicInfoCache>> AsicInfoTask; ///< a query filling m_asicInfoQuery
+    typedef DeadlineTask<std::shared_ptr<const VersionsCache>> VersionsTask; ///< a query filling m_versionsQuery
+    typedef DeadlineTask<ADLUtil_Result>                       RefreshTask;  ///< a Refresh
+
+    /// A long-lived thread running the queries of one kind under the call deadline, so that a hung query only holds up
+    /// the queries of its own kind
+    struct DeadlineWorker
+    {
+        std::deque<std::function<void()>> jobs;      ///< queries waiting for the worker, protected by m_deadlineMutex
+        std::condition_variable           jobQueued; ///< signaled when a query is queued or the worker must stop
+        std::thread                       thread;    ///< runs the queries, started by the first of them
+    };
+
+    /// Runs a query under the call deadline. Without a deadline the query runs on the calling thread. Otherwise the caller
+    /// joins the query of task if it is still queued or in progress, or queues the query to worker, and waits until the
+    /// deadline.
+    /// @param[in,out] worker the deadline worker of this kind of query
+    /// @param[in,out] task   the query in progress for the same data, replaced when a new query is started
+    /// @param[in]     query  the query
+    /// @param[out]    result what the query returned, only set if it completed in time
+    /// @returns       true if the query completed in time, false if the deadline passed or the circuit breaker held the query back.
+    template <typename T>
+    bool RunWithDeadline(DeadlineWorker& worker, std::shared_ptr<DeadlineTask<T>>& task, const std::function<T()>& query, T& result);
+
+    /// Runs the queries RunWithDeadline queued to a worker one after the other until Shutdown
+    /// @param[in,out] worker the deadline worker
+    void DeadlineWorkerLoop(DeadlineWorker& worker);
+
+    /// Returns the data to serve when a query missed the call deadline
+    /// @returns a copy of the last AsicInfoCache ADL returned successfully marked ADL_STALE, or an empty one marked ADL_TIMED_OUT.
+    std::shared_ptr<const AsicInfoCache> MakeStaleAsicInfoCache() const;
+
+    /// Returns the data to serve when a query missed the call deadline
+    /// @returns a copy of the last VersionsCache ADL returned successfully marked ADL_STALE, or an empty one marked ADL_TIMED_OUT.
+    std::shared_ptr<const VersionsCache> MakeStaleVersionsCache() const;
+
+    /// Builds a VersionsCache entry, parsing the driver version
+    /// @param[in] adlVersionsInfo the ADL Version info
+    /// @param[in] result          the result of the ADL Version query
+    /// @returns   the new cache entry.
+    static std::shared_ptr<const VersionsCache> MakeVersionsCache(const ADLVersionsInfo& adlVersionsInfo, ADLUtil_Result result);
+
+    /// Publishes a VersionsCache, and keeps it as the last known-good version info if its query succeeded.
+    /// @param[in] cache the new cache entry
+    void PublishVersionsCache(const std::shared_ptr<const VersionsCache>& cache);
+
+    /// Returns the published VersionsCache, filling it first under the call deadline if needed
+    /// @returns the VersionsCache, never nullptr.
+    std::shared_ptr<const VersionsCache> GetVersionsCache();
+
+    /// Returns the published VersionsCache, filling it first on the calling thread if needed
+    /// @returns the VersionsCache, never nullptr.
+    std::shared_ptr<const VersionsCache> FillVersionsCache();
+
+    /// Fill function of m_versionsQuery: reads the version info from the persistent cache or ADL
+    /// @returns the new VersionsCache.
+    std::shared_ptr<const VersionsCache> QueryVersionsCache();
+
+    /// Returns the published AsicInfoCache, filling it first under the call deadline if needed
+    /// @returns the AsicInfoCache, never nullptr.
+    std::shared_ptr<const AsicInfoCache> GetAsicInfoCache();
+
+    /// Returns the published AsicInfoCache, filling it first on the calling thread if needed
+    /// @returns the AsicInfoCache, never nullptr.
+    std::shared_ptr<const AsicInfoCache> FillAsicInfoCache();
+
+    /// Fill function of m_asicInfoQuery: reads the adapters from the persistent cache or enumerates them, then publishes
+    /// them and notifies the subscribers
+    /// @returns the published AsicInfoCache.
+    std::shared_ptr<const AsicInfoCache> QueryAsicInfoCache();
+
+    /// Refresh on the calling thread
+    /// @returns an enum ADLUtil_Result status code of the enumeration.
+    ADLUtil_Result RefreshAdapters();
+
+    /// Publishes an enumeration as the new AsicInfoCache. The generation is only advanced if the adapters differ from the last
+    /// published generation. The caller must hold m_asicInfoMutex; if the generation advanced, it hands the lock over to
+    /// NotifySubscribers with the returned changes.
+    /// @param[in]  asicInfoList the enumerated adapters
+    /// @param[in]  result       the result of the enumeration
+    /// @param[out] changes      the differences to the last published generation
+    /// @returns    the published cache.
+    std::shared_ptr<const AsicInfoCache> PublishAsicInfoCache(AsicInfoList&& asicInfoList, ADLUtil_Result result, ADLUtil_AdapterChanges& changes);
+
+    /// Invokes the subscribers if changes holds a new generation. Takes m_notifyMutex before releasing asicInfoLock,
+    /// so that the notifications of successive generations are delivered in order.
+    /// @param[in] asicInfoLock the held lock of m_asicInfoMutex, released by this call
+    /// @param[in] changes      the changes returned by PublishAsicInfoCache
+    void NotifySubscribers(std::unique_lock<std::mutex>& asicInfoLock, const ADLUtil_AdapterChanges& changes);
+
+    /// Loads the ADL library and creates the context if they are not loaded. The caller must hold m_libMutex.
+    /// @returns an enum ADLUtil_Result status code.
+    ADLUtil_Result LoadLibraryLocked();
+
+    /// Calls ADL2_Main_Control_Destroy, unloads ADL library, and clears the function entry points. The caller must hold m_libMutex.
+    void UnloadLibrary();
+
+    /// Releases a lease taken by AcquireLease and starts the idle period once the last lease is released
+    void ReleaseLease();
+
+    /// Body of the idle unload thread
+    void IdleUnloadLoop();
+
+    /// Looks an entry point up, resolving it on first use
+    /// @param[in] entrypoint the entry point
+    /// @returns   the address of the entry point, or nullptr if the library is not loaded or does not export it.
+    void* GetEntrypointAddress(ADLUtil_Entrypoint entrypoint)
+    {
+        return m_owner.GetEntrypointAddress(entrypoint);
+    }
 
-            // parse the minor driver version
-            bool subMinorAvailable = false;
+    /// Slow path of GetEntrypointAddress: looks the entry point up in the loaded library and caches the result.
+    /// Runs under m_resolveMutex, so that the library cannot be freed during the lookup nor the result cached after the unload.
+    /// @param[in] entrypoint the entry point to resolve
+    /// @returns   the address of the entry point, or &EntrypointTable::s_missingEntrypoint.
+    void* ResolveEntrypoint(ADLUtil_Entrypoint entrypoint);
+
+    /// Stands in for m_libHandle while a replay profile is loaded instead of the library
+    static char s_replayLibrary;
+
+    /// Finds the file the ADL library was loaded from, through the address of its adapter info entry point
+    /// @returns the path of the library file, empty if the library cannot be loaded or the path is not known.
+    std::string GetLibraryPath();
+
+    /// Reads the persistent cache file the first time it is called. Starts a background revalidation if there is no valid
+    /// file for the backend, if the driver stamp changed since the file was written, or if the file is older than the revalidation age.
+    /// @returns the validated cache contents, or nullptr if the cache is disabled, missing, invalid or was reset.
+    std::shared_ptr<const ADLUtil_CacheContents> ReadPersistentCache();
+
+    /// Queries ADL directly, publishes the live data if it differs from the served cache file and rewrites the file
+    /// @param[in] cachePath   the path of the cache file
+    /// @param[in] stamp       the stamp the file was checked against, written with the path and stamp of the library that answered
+    /// @param[in] servedCache the cache contents served to the callers, or nullptr if they enumerated live
+    /// @param[in] cancelled   set to stop the revalidation between its queries, without publishing or writing anything
+    void RevalidatePersistentCache(const std::string& cachePath, const ADLUtil_CacheStamp& stamp, std::shared_ptr<const ADLUtil_CacheContents> servedCache,
+                                   const std::atomic<bool>& cancelled);
+
+    /// Cancels the background revalidation of the persistent cache and waits for the query it is in, if any.
+    /// The caller must not hold m_persistentCacheMutex.
+    void CancelPersistentCacheRevalidation();
+
+    /// Returns the backend selection
+    /// @param[out] sysfsRoot the root of the sysfs tree to read
+    /// @returns    true if the adapter list and the driver version are read from sysfs rather than ADL.
+    bool IsSysfsBackend(std::string& sysfsRoot);
+
+    /// Queries ADL for the Catalyst version info
+    /// @param[out] adlVersionInfo the Catalyst version info from ADL
+    /// @returns    an enum ADLUtil_Result status code.
+    ADLUtil_Result QueryVersionsInfo(ADLVersionsInfo& adlVersionInfo);
+
+    /// Enumerates the adapters through the selected backend, then numbers their physical GPUs and reads their topology
+    /// @param[out] asicInfoList the list to populate with the available ASICs
+    /// @returns    an enum ADLUtil_Result status code.
+    ADLUtil_Result EnumerateAdapters(AsicInfoList& asicInfoList);
+
+    /// Queries ADL for the list of adapters
+    /// @param[out] asicInfoList the list to populate with the available ASICs
+    /// @returns    an enum ADLUtil_Result status code.
+    ADLUtil_Result EnumerateADLAdapters(AsicInfoList& asicInfoList);
+
+    AMDTADLUtils&      m_owner;              ///< the singleton, whose Call template performs the ADL calls
+    void*              m_libHandle;          ///< Handle to ADL Module, written with both m_libMutex and m_resolveMutex held
+    std::string        m_libraryName;        ///< ADL library override, empty to use the platform default
+    ADL_CONTEXT_HANDLE m_adlContext;         ///< ADL Context for use with ADL2 functions
+    bool               m_useArenaAllocator;  ///< true to serve the ADL allocation callback from the arena
+    ADLUtil_Backend    m_backend;            ///< the source of the adapter list and the driver version
+    std::string        m_sysfsRoot;          ///< root of the sysfs tree read by ADLUtil_Backend::Sysfs, empty to use ADLUTIL_DEFAULT_SYSFS_ROOT
+    std::string        m_recordPath;         ///< replay profile written when the library unloads, empty to not record
+    std::string        m_replayPath;         ///< replay profile loaded instead of the library, empty to load the library
+    bool               m_replayLatency;      ///< true to replay the recorded latency of the calls
+    std::mutex         m_libMutex;           ///< Mutex to serialize loading and unloading of the ADL library, also protects the lease members
+    std::mutex         m_resolveMutex;       ///< Mutex to keep the library from being freed while an entry point resolves, taken after m_libMutex
+    std::mutex         m_asicInfoMutex;      ///< Mutex to serialize publishing to m_asicInfoQuery, also protects m_lastAsicInfoCache
+
+    typedef std::function<std::shared_ptr<const AsicInfoCache>(int)> AsicInfoFillFn; ///< fill function of m_asicInfoQuery
+    typedef std::function<std::shared_ptr<const VersionsCache>(int)> VersionsFillFn; ///< fill function of m_versionsQuery
+
+    /// The published ASIC list, under ADLUTIL_ALL_ADAPTERS
+    ADLUtil_CachedQuery<AsicInfoCache, AsicInfoFillFn> m_asicInfoQuery;
+
+    /// The published version info, under ADLUTIL_ALL_ADAPTERS
+    ADLUtil_CachedQuery<VersionsCache, VersionsFillFn> m_versionsQuery;
+
+    /// The last ASIC list and version info ADL returned successfully, served when a query misses the call deadline.
+    /// Kept across Reset().
+    ADLUtil_AtomicSharedPtr<AsicInfoCache> m_knownGoodAsicInfoCache;
+    ADLUtil_AtomicSharedPtr<VersionsCache> m_knownGoodVersionsCache;
+
+    /// The last published ASIC list, kept across Reset() so that the next enumeration is diffed against it. Protected by m_asicInfoMutex.
+    std::shared_ptr<const AsicInfoCache> m_lastAsicInfoCache;
+    std::atomic<uint64_t>                m_generation;          ///< generation of m_lastAsicInfoCache
+
+    std::mutex                                m_subscriptionsMutex; ///< serializes changes to m_subscriptions
+    std::mutex                                m_notifyMutex;        ///< serializes notifications of the subscribers
+    uint64_t                                  m_nextSubscriptionID; ///< ID of the next Subscribe call
+    ADLUtil_AtomicSharedPtr<SubscriptionList> m_subscriptions;      ///< the registered callbacks, replaced as a whole on changes
+
+    std::mutex                         m_prefetchMutex; ///< Mutex to protect access to m_prefetch
+    std::shared_future<ADLUtil_Result> m_prefetch;      ///< the in-flight or completed background prefetch
+
+    std::mutex                                   m_persistentCacheMutex; ///< Mutex to protect access to the persistent cache members
+    std::string                                  m_persistentCachePath;  ///< path of the persistent cache file, empty if disabled
+    bool                                         m_persistentCacheRead;  ///< true once the persistent cache file was read
+    std::shared_ptr<const ADLUtil_CacheContents> m_persistentCache;      ///< contents of the persistent cache file while they are served
+    std::chrono::seconds                         m_cacheRevalidationAge; ///< age after which the file is revalidated although its driver stamp matches
+    std::future<void>                            m_cacheRevalidation;    ///< the background revalidation of the persistent cache
+    std::shared_ptr<std::atomic<bool>>           m_cancelRevalidation;   ///< cancels m_cacheRevalidation
+
+    std::atomic<int64_t>                  m_callDeadlineMs;      ///< the call deadline in milliseconds, 0 for none
+    std::mutex                            m_deadlineMutex;       ///< protects the DeadlineTask pointers and the circuit breaker
+    std::shared_ptr<AsicInfoTask>         m_asicInfoTask;        ///< the last query filling m_asicInfoQuery under the deadline
+    std::shared_ptr<VersionsTask>         m_versionsTask;        ///< the last query filling m_versionsQuery under the deadline
+    std::shared_ptr<RefreshTask>          m_refreshTask;         ///< the last Refresh under the deadline
+    uint32_t                              m_consecutiveTimeouts; ///< queries in a row that missed the deadline
+    std::chrono::steady_clock::time_point m_backoffUntil;        ///< end of the backoff once m_consecutiveTimeouts reached s_circuitBreakerThreshold
+    DeadlineWorker                        m_asicInfoWorker;      ///< runs the queries filling m_asicInfoQuery under the deadline
+    DeadlineWorker                        m_versionsWorker;      ///< runs the queries filling m_versionsQuery under the deadline
+    DeadlineWorker                        m_refreshWorker;       ///< runs the Refresh calls under the deadline
+    bool                                  m_stopDeadlineWorkers; ///< true tells the deadline workers to exit once their queues are empty
+
+    std::condition_variable               m_leasesChanged;     ///< signaled when a lease is released, the library is loaded or the idle unload settings change
+    uint32_t                              m_leaseCount;        ///< number of leases held
+    std::chrono::steady_clock::time_point m_lastUse;           ///< when the library was loaded or the last lease was released
+    std::chrono::milliseconds             m_idleUnloadTimeout; ///< quiet period before the idle unload, 0 to never unload
+    bool                                  m_stopIdleUnload;    ///< true tells the idle unload thread to exit
+    std::thread                           m_idleUnloadThread;  ///< waits for the library to become idle, started by SetIdleUnloadTimeout
+
+    EntrypointTable m_entrypointTable; ///< the resolved entry points, read inline by AMDTADLUtils::GetEntrypointAddress
+};
+
+const char* ADLUtil_GetEntrypointName(ADLUtil_Entrypoint entrypoint)
+{
+    static const char* const s_entrypointNames[] =
+    {
+#define X(SYM) #SYM,
+        ADL_INTERFACE_TABLE
+#undef X
+    };
 
-            pos = strDriverVersion.find(strDelimiter);
+    return s_entrypointNames[static_cast<uint32_t>(entrypoint)];
+}
 
-            if (pos != std::string_view::npos)
-            {
-                strToken = strDriverVersion.substr(0, pos);
-                strDriverVersion.remove_prefix(pos + 1);
-                subMinorAvailable = true;
-            }
-            else
-            {
-                strToken = strDriverVersion;
-            }
+char AMDTADLUtils::EntrypointTable::s_missingEntrypoint = 0;
+char AMDTADLUtils::Impl::s_replayLibrary = 0;
 
-            ss.clear();
-            ss.str(strToken.data());
+AMDTADLUtils::Impl::Impl(AMDTADLUtils& owner) :
+    m_owner(owner),
+    m_libHandle(nullptr),
+    m_adlContext(nullptr),
+    m_useArenaAllocator(false),
+    m_backend(ADLUtil_Backend::ADL),
+    m_replayLatency(false),
+    m_asicInfoQuery([this](int) { return QueryAsicInfoCache(); }),
+    m_versionsQuery([this](int) { return QueryVersionsCache(); }),
+    m_generation(0),
+    m_nextSubscriptionID(1),
+    m_subscriptions(std::make_shared<const SubscriptionList>()),
+    m_persistentCacheRead(false),
+    m_cacheRevalidationAge(s_defaultCacheRevalidationAge),
+    m_callDeadlineMs(0),
+    m_consecutiveTimeouts(0),
+    m_stopDeadlineWorkers(false),
+    m_leaseCount(0),
+    m_idleUnloadTimeout(0),
+    m_stopIdleUnload(false)
+{
+    for (std::atomic<void*>& entrypoint : m_entrypointTable.entrypoints)
+    {
+        entrypoint.store(nullptr, std::memory_order_relaxed);
+    }
+}
 
-            if ((ss >> minorVer).fail())
-            {
-                minorVer = 0;
-            }
+void AMDTADLUtils::Impl::Shutdown()
+{
+    // the prefetch and revalidation threads use this instance, so let them finish before tearing down
+    if (m_prefetch.valid())
+    {
+        m_prefetch.wait();
+    }
 
-            // parse the sub-minor driver version
-            if (subMinorAvailable)
-            {
-                pos = strDriverVersion.find(strDelimiter);
+    // don't hold up the exit with a revalidation, whose result only matters to a later launch
+    CancelPersistentCacheRevalidation();
 
-                if (pos != std::string_view::npos)
-                {
-                    strToken = strDriverVersion.substr(0, pos);
-                    strDriverVersion.remove_prefix(pos + 1);
-                }
-                else
-                {
-                    strToken = strDriverVersion;
-                }
+    // queries that missed their deadline may still be queued or running on the deadline workers
+    {
+        std::lock_guard<std::mutex> lock(m_deadlineMutex);
+        m_stopDeadlineWorkers = true;
+    }
 
-                ss.clear();
-                ss.str(strToken.data());
+    for (DeadlineWorker* pWorker : {&m_asicInfoWorker, &m_versionsWorker, &m_refreshWorker})
+    {
+        pWorker->jobQueued.notify_all();
 
-                if ((ss >> subMinorVer).fail())
-                {
-                    subMinorVer = 0;
-                }
-            }
+        if (pWorker->thread.joinable())
+        {
+            pWorker->thread.join();
         }
     }
 
-    return adlResult;
+    m_stopDeadlineWorkers = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_libMutex);
+        m_stopIdleUnload = true;
+    }
+
+    m_leasesChanged.notify_all();
+
+    if (m_idleUnloadThread.joinable())
+    {
+        m_idleUnloadThread.join();
+    }
+
+    Unload(s_shutdownLeaseTimeout);
 }
 
-void AMDTADLUtils::Reset()
+ADLUtil_Result AMDTADLUtils::Impl::LoadAndInit()
+{
+    ADLUtil_Result result;
+
+    {
+        std::lock_guard<std::mutex> lock(m_libMutex);
+        result = LoadLibraryLocked();
+    }
+
+    m_leasesChanged.notify_all();
+
+    return result;
+}
+
+ADLUtil_Result AMDTADLUtils::Impl::AcquireLease(Lease& lease)
+{
+    lease.Release();
+
+    ADLUtil_Result result;
+
+    {
+        std::lock_guard<std::mutex> lock(m_libMutex);
+        result = LoadLibraryLocked();
+
+        if (ADL_SUCCESS == result)
+        {
+            ++m_leaseCount;
+            lease.m_pImpl = this;
+        }
+    }
+
+    m_leasesChanged.notify_all();
+
+    return result;
+}
+
+void AMDTADLUtils::Impl::ReleaseLease()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_libMutex);
+        --m_leaseCount;
+        m_lastUse = std::chrono::steady_clock::now();
+    }
+
+    m_leasesChanged.notify_all();
+}
+
+void AMDTADLUtils::Impl::SetIdleUnloadTimeout(std::chrono::milliseconds timeout)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_libMutex);
+        m_idleUnloadTimeout = std::max(timeout, std::chrono::milliseconds(0));
+
+        if (0 < m_idleUnloadTimeout.count() && !m_idleUnloadThread.joinable())
+        {
+            m_idleUnloadThread = std::thread(&AMDTADLUtils::Impl::IdleUnloadLoop, this);
+        }
+    }
+
+    m_leasesChanged.notify_all();
+}
+
+void AMDTADLUtils::Impl::IdleUnloadLoop()
+{
+    std::unique_lock<std::mutex> lock(m_libMutex);
+
+    while (!m_stopIdleUnload)
+    {
+        bool isIdle = nullptr != m_libHandle && 0 == m_leaseCount && 0 < m_idleUnloadTimeout.count();
+
+        if (!isIdle)
+        {
+            m_leasesChanged.wait(lock);
+            continue;
+        }
+
+        std::chrono::steady_clock::time_point unloadTime = m_lastUse + m_idleUnloadTimeout;
+
+        if (std::chrono::steady_clock::now() >= unloadTime)
+        {
+            // no lease is held, so no call is in progress; the caches stay filled and the next lease loads the library again
+            UnloadLibrary();
+        }
+        else
+        {
+            m_leasesChanged.wait_until(lock, unloadTime);
+        }
+    }
+}
+
+ADLUtil_Result AMDTADLUtils::Impl::LoadLibraryLocked()
+{
+    ADLUtil_Result result = ADL_SUCCESS;
+
+    if (nullptr == m_libHandle)
+    {
+        ADLUTIL_PHASE_SCOPE(LoadAndInit);
+
+        {
+            ADLUTIL_PHASE_SCOPE(LoadLibrary);
+
+            void* libHandle;
+
+            if (!m_replayPath.empty())
+            {
+                libHandle = ADLUtil_OpenReplayProfile(m_replayPath, m_replayLatency) ? &s_replayLibrary : nullptr;
+            }
+            else
+            {
+                libHandle = ADLUtil_LoadLibrary(m_libraryName.empty() ? ADLUtil_GetDefaultLibraryName() : m_libraryName.c_str());
+
+                if (nullptr != libHandle && !m_recordPath.empty())
+                {
+                    ADLUtil_StartRecording();
+                }
+            }
+
+            std::lock_guard<std::mutex> resolveLock(m_resolveMutex);
+            m_libHandle = libHandle;
+        }
+
+        EnableCallbackArena(m_useArenaAllocator && nullptr != m_libHandle);
+
+        if (nullptr == m_libHandle)
+        {
+            result = ADL_NOT_FOUND;
+        }
+
+        if (ADL_SUCCESS == result)
+        {
+            // only the entry points needed to create a context are required up front, everything else resolves on first use
+            if (!IsAvailable<ADLUtil_Entrypoint::ADL2_Main_Control_Create>() && !IsAvailable<ADLUtil_Entrypoint::ADL_Main_Control_Create>())
+            {
+                UnloadLibrary();
+                result = ADL_MISSING_ENTRYPOINTS;
+            }
+        }
+
+        if (ADL_SUCCESS == result)
+        {
+            ADLUTIL_PHASE_SCOPE(CreateContext);
+            int adlResult;
+
+            // Initialize ADL. The second parameter is 1, which means:
+            // retrieve adapter information only for adapters that are physically present and enabled in the system
+            if (IsAvailable<ADLUtil_Entrypoint::ADL2_Main_Control_Create>())
+            {
+                adlResult = Call<ADLUtil_Entrypoint::ADL2_Main_Control_Create>(ADL_Main_Memory_Alloc, 1, &m_adlContext);
+            }
+            else
+            {
+                adlResult = Call<ADLUtil_Entrypoint::ADL_Main_Control_Create>(ADL_Main_Memory_Alloc, 1);
+            }
+
+            if (ADL_OK != adlResult && ADL_OK_WARNING != adlResult)
+            {
+                UnloadLibrary();
+                return ADL_INITIALIZATION_FAILED;
+            }
+
+            m_lastUse = std::chrono::steady_clock::now();
+        }
+    }
+
+    return result;
+}
+
+ADLUtil_Result AMDTADLUtils::Impl::Unload(std::chrono::milliseconds leaseTimeout)
+{
+    {
+        // never unload the library from under a call in progress, and don't wait forever for a lease
+        // that is never released, ie one held by the calling thread, a running sampler or a context pool
+        std::unique_lock<std::mutex> lock(m_libMutex);
+
+        if (!m_leasesChanged.wait_for(lock, leaseTimeout, [this]() { return 0 == m_leaseCount; }))
+        {
+            return ADL_LEASES_HELD;
+        }
+
+        UnloadLibrary();
+    }
+
+    Reset();
+
+    return ADL_SUCCESS;
+}
+
+void AMDTADLUtils::Impl::SetLibraryName(const std::string& libraryName)
+{
+    std::lock_guard<std::mutex> lock(m_libMutex);
+    m_libraryName = libraryName;
+}
+
+void AMDTADLUtils::Impl::SetUseArenaAllocator(bool useArena)
+{
+    std::lock_guard<std::mutex> lock(m_libMutex);
+    m_useArenaAllocator = useArena;
+}
+
+void AMDTADLUtils::Impl::SetBackend(ADLUtil_Backend backend)
+{
+    std::lock_guard<std::mutex> lock(m_libMutex);
+    m_backend = backend;
+}
+
+void AMDTADLUtils::Impl::SetSysfsRoot(const std::string& sysfsRoot)
+{
+    std::lock_guard<std::mutex> lock(m_libMutex);
+    m_sysfsRoot = sysfsRoot;
+}
+
+void AMDTADLUtils::Impl::SetRecordPath(const std::string& recordPath)
+{
+    std::lock_guard<std::mutex> lock(m_libMutex);
+    m_recordPath = recordPath;
+}
+
+void AMDTADLUtils::Impl::SetReplayPath(const std::string& replayPath, bool replayLatency)
+{
+    std::lock_guard<std::mutex> lock(m_libMutex);
+    m_replayPath = replayPath;
+    m_replayLatency = replayLatency;
+}
+
+bool AMDTADLUtils::Impl::IsSysfsBackend(std::string& sysfsRoot)
+{
+    std::lock_guard<std::mutex> lock(m_libMutex);
+    sysfsRoot = m_sysfsRoot.empty() ? ADLUTIL_DEFAULT_SYSFS_ROOT : m_sysfsRoot;
+    return ADLUtil_Backend::Sysfs == m_backend;
+}
+
+ADLUtil_AllocationStats AMDTADLUtils::GetAllocationStats() const
+{
+    ADLUtil_AllocationStats stats;
+    stats.heapAllocations = s_callbackArena.heapAllocations.load();
+    stats.arenaAllocations = s_callbackArena.arenaAllocations.load();
+    stats.arenaResets = s_callbackArena.arenaResets.load();
+    return stats;
+}
+
+void AMDTADLUtils::Impl::UnloadLibrary()
+{
+    if (nullptr != m_libHandle)
+    {
+        // a context only exists if it was created through ADL2_Main_Control_Create
+        if (nullptr != m_adlContext)
+        {
+            Call<ADLUtil_Entrypoint::ADL2_Main_Control_Destroy>(m_adlContext);
+            m_adlContext = nullptr;
+        }
+        else
+        {
+            Call<ADLUtil_Entrypoint::ADL_Main_Control_Destroy>();
+        }
+
+        // wait for resolutions in progress, and make later ones see that the library is gone
+        std::lock_guard<std::mutex> resolveLock(m_resolveMutex);
+
+        if (&s_replayLibrary == m_libHandle)
+        {
+            ADLUtil_CloseReplayProfile();
+        }
+        else
+        {
+            // the profile is written while the library is still loaded, after the last call into it
+            if (ADLUtil_IsRecording())
+            {
+                ADLUtil_StopRecording(m_recordPath);
+            }
+
+            ADLUtil_FreeLibrary(m_libHandle);
+        }
+
+        m_libHandle = nullptr;
+
+        // ADL is gone, so nothing can refer to arena memory anymore
+        EnableCallbackArena(false);
+
+        for (std::atomic<void*>& entrypoint : m_entrypointTable.entrypoints)
+        {
+            entrypoint.store(nullptr, std::memory_order_release);
+        }
+    }
+}
+
+void* AMDTADLUtils::Impl::ResolveEntrypoint(ADLUtil_Entrypoint entrypoint)
+{
+    // the idle unload and Unload free the library under this lock, so the handle stays valid during the lookup
+    std::lock_guard<std::mutex> resolveLock(m_resolveMutex);
+
+    if (nullptr == m_libHandle)
+    {
+        // nothing to resolve against; don't cache so the entry point resolves once the library is loaded
+        return &EntrypointTable::s_missingEntrypoint;
+    }
+
+    void* pEntrypoint;
+
+    if (&s_replayLibrary == m_libHandle)
+    {
+        pEntrypoint = ADLUtil_GetReplayEntrypoint(entrypoint);
+    }
+    else
+    {
+        pEntrypoint = ADLUtil_GetProcAddress(m_libHandle, ADLUtil_GetEntrypointName(entrypoint));
+
+        if (nullptr != pEntrypoint && ADLUtil_IsRecording())
+        {
+            pEntrypoint = ADLUtil_WrapForRecording(entrypoint, pEntrypoint);
+        }
+    }
+
+    if (nullptr == pEntrypoint)
+    {
+        pEntrypoint = &EntrypointTable::s_missingEntrypoint;
+    }
+
+    m_entrypointTable.entrypoints[static_cast<uint32_t>(entrypoint)].store(pEntrypoint, std::memory_order_release);
+    return pEntrypoint;
+}
+
+std::shared_future<ADLUtil_Result> AMDTADLUtils::Impl::PrefetchAsync()
+{
+    std::lock_guard<std::mutex> lock(m_prefetchMutex);
+
+    // start a new prefetch if none was started yet, or if the last one has finished and its data was reset since
+    bool prefetchIsStale = m_prefetch.valid() &&
+                           (std::future_status::ready == m_prefetch.wait_for(std::chrono::seconds(0))) &&
+                           (nullptr == m_asicInfoQuery.Peek(ADLUTIL_ALL_ADAPTERS));
+
+    if (!m_prefetch.valid() || prefetchIsStale)
+    {
+        std::shared_ptr<const AsicInfoCache> asicInfoCache = m_asicInfoQuery.Peek(ADLUTIL_ALL_ADAPTERS);
+        std::shared_ptr<const VersionsCache> versionsCache = m_versionsQuery.Peek(ADLUTIL_ALL_ADAPTERS);
+
+        if (nullptr != asicInfoCache && nullptr != versionsCache)
+        {
+            // both caches are warm: nothing to prefetch, so don't start a thread
+            std::promise<ADLUtil_Result> promise;
+            promise.set_value((ADL_SUCCESS == asicInfoCache->result) ? versionsCache->result : asicInfoCache->result);
+            m_prefetch = promise.get_future().share();
+            return m_prefetch;
+        }
+
+        m_prefetch = std::async(std::launch::async, [this]()
+        {
+            // the getters fill the caches under their own mutexes, so synchronous callers arriving
+            // while this runs wait for this work rather than repeating it
+            AsicInfoListSnapshot asicInfoList;
+            ADLUtil_Result result = GetAsicInfoList(asicInfoList);
+
+            ADLVersionsInfo adlVersionInfo;
+            ADLUtil_Result versionResult = GetADLVersionsInfo(adlVersionInfo);
+
+            return (ADL_SUCCESS == result) ? versionResult : result;
+        }).share();
+    }
+
+    return m_prefetch;
+}
+
+std::future<ADLUtil_Result> AMDTADLUtils::Impl::GetAsicInfoListAsync(AsicInfoListCallback callback)
+{
+    std::shared_ptr<const AsicInfoCache> cache = m_asicInfoQuery.Peek(ADLUTIL_ALL_ADAPTERS);
+
+    if (nullptr != cache)
+    {
+        // warm cache: complete immediately on the calling thread
+        if (callback)
+        {
+            callback(cache->result, AsicInfoListSnapshot(cache, &cache->asicInfoList));
+        }
+
+        std::promise<ADLUtil_Result> promise;
+        promise.set_value(cache->result);
+        return promise.get_future();
+    }
+
+    return std::async(std::launch::async, [this, callback]()
+    {
+        AsicInfoListSnapshot asicInfoList;
+        ADLUtil_Result result = GetAsicInfoList(asicInfoList);
+
+        if (callback)
+        {
+            callback(result, asicInfoList);
+        }
+
+        return result;
+    });
+}
+
+std::future<ADLUtil_Result> AMDTADLUtils::Impl::GetADLVersionsInfoAsync(ADLVersionsInfoCallback callback)
+{
+    std::shared_ptr<const VersionsCache> cache = m_versionsQuery.Peek(ADLUTIL_ALL_ADAPTERS);
+
+    if (nullptr != cache)
+    {
+        // warm cache: complete immediately on the calling thread
+        if (callback)
+        {
+            callback(cache->result, cache->adlVersionsInfo);
+        }
+
+        std::promise<ADLUtil_Result> promise;
+        promise.set_value(cache->result);
+        return promise.get_future();
+    }
+
+    return std::async(std::launch::async, [this, callback]()
+    {
+        ADLVersionsInfo adlVersionInfo;
+        ADLUtil_Result result = GetADLVersionsInfo(adlVersionInfo);
+
+        if (callback)
+        {
+            callback(result, adlVersionInfo);
+        }
+
+        return result;
+    });
+}
+
+
+ADLUtil_Result AMDTADLUtils::GetAsicInfoList(AsicInfoList& asicInfoList)
+{
+    AsicInfoListSnapshot snapshot;
+    ADLUtil_Result result = GetAsicInfoList(snapshot);
+
+    asicInfoList = *snapshot;
+    return result;
+}
+
+ADLUtil_Result AMDTADLUtils::Impl::GetAsicInfoList(AsicInfoListSnapshot& asicInfoList)
+{
+    std::shared_ptr<const AsicInfoCache> cache = GetAsicInfoCache();
+
+    // alias the list inside the cache entry so that the caller shares ownership without another allocation
+    asicInfoList = AsicInfoListSnapshot(cache, &cache->asicInfoList);
+    return cache->result;
+}
+
+ADLUtil_Result AMDTADLUtils::Impl::GetPhysicalGPUIndex(std::shared_ptr<const ADLUtil_PhysicalGPUIndex>& physicalGPUIndex)
+{
+    std::shared_ptr<const AsicInfoCache> cache = GetAsicInfoCache();
+
+    physicalGPUIndex = cache->physicalGPUIndex;
+    return cache->result;
+}
+
+std::shared_ptr<const AMDTADLUtils::Impl::AsicInfoCache> AMDTADLUtils::Impl::GetAsicInfoCache()
+{
+    std::shared_ptr<const AsicInfoCache> cache = m_asicInfoQuery.Peek(ADLUTIL_ALL_ADAPTERS);
+
+    if (nullptr == cache)
+    {
+        // the cache the query filled comes back with its answer, so it is not looked up again
+        std::function<std::shared_ptr<const AsicInfoCache>()> query = [this]() { return FillAsicInfoCache(); };
+
+        if (!RunWithDeadline(m_asicInfoWorker, m_asicInfoTask, query, cache))
+        {
+            cache = MakeStaleAsicInfoCache();
+        }
+    }
+
+    return cache;
+}
+
+std::shared_ptr<const AMDTADLUtils::Impl::AsicInfoCache> AMDTADLUtils::Impl::FillAsicInfoCache()
+{
+    return m_asicInfoQuery.Get(ADLUTIL_ALL_ADAPTERS);
+}
+
+std::shared_ptr<const AMDTADLUtils::Impl::AsicInfoCache> AMDTADLUtils::Impl::QueryAsicInfoCache()
+{
+    std::unique_lock<std::mutex> lock(m_asicInfoMutex);
+
+    AsicInfoList   asicInfoList;
+    ADLUtil_Result result;
+    std::shared_ptr<const ADLUtil_CacheContents> persistentCache = ReadPersistentCache();
+
+    if (nullptr != persistentCache)
+    {
+        // warm launch: serve the cache file without loading ADL, it is revalidated in the background.
+        // The file holds no topology, and link speeds change with power states anyway
+        asicInfoList = persistentCache->asicInfoList;
+        result = ADL_SUCCESS;
+
+        std::string sysfsRoot;
+        IsSysfsBackend(sysfsRoot);
+        ADLUtil_FillAdapterTopology(sysfsRoot, asicInfoList);
+    }
+    else
+    {
+        result = EnumerateAdapters(asicInfoList);
+    }
+
+    // published before the subscribers run, so that they can query it without waiting for this fill
+    ADLUtil_AdapterChanges changes;
+    std::shared_ptr<const AsicInfoCache> cache = PublishAsicInfoCache(std::move(asicInfoList), result, changes);
+    NotifySubscribers(lock, changes);
+
+    return cache;
+}
+
+std::shared_ptr<const AMDTADLUtils::Impl::AsicInfoCache> AMDTADLUtils::Impl::PublishAsicInfoCache(AsicInfoList&& asicInfoList, ADLUtil_Result result, ADLUtil_AdapterChanges& changes)
+{
+    std::shared_ptr<AsicInfoCache> newCache = std::make_shared<AsicInfoCache>();
+    newCache->asicInfoList = std::move(asicInfoList);
+    newCache->result = result;
+
+    // an aliasing pointer keeps the whole cache entry alive for as long as a subscriber holds the list
+    changes.currentList = AsicInfoListSnapshot(newCache, &newCache->asicInfoList);
+
+    if (nullptr != m_lastAsicInfoCache)
+    {
+        changes.previousGeneration = m_lastAsicInfoCache->generation;
+        changes.previousList = AsicInfoListSnapshot(m_lastAsicInfoCache, &m_lastAsicInfoCache->asicInfoList);
+        ADLUtil_DiffAsicInfoLists(m_lastAsicInfoCache->asicInfoList, newCache->asicInfoList, changes);
+    }
+    else
+    {
+        ADLUtil_DiffAsicInfoLists(AsicInfoList(), newCache->asicInfoList, changes);
+    }
+
+    if (nullptr != m_lastAsicInfoCache && !changes.HasChanges())
+    {
+        // same adapters as before; republish the previous index under the previous generation
+        newCache->physicalGPUIndex = m_lastAsicInfoCache->physicalGPUIndex;
+        newCache->generation = m_lastAsicInfoCache->generation;
+    }
+    else
+    {
+        newCache->physicalGPUIndex = std::make_shared<const ADLUtil_PhysicalGPUIndex>(newCache->asicInfoList);
+        newCache->generation = m_generation.load(std::memory_order_relaxed) + 1;
+    }
+
+    changes.generation = newCache->generation;
+
+    m_lastAsicInfoCache = newCache;
+    m_asicInfoQuery.Store(ADLUTIL_ALL_ADAPTERS, newCache);
+
+    if (ADL_SUCCESS == result || ADL_WARNING == result)
+    {
+        m_knownGoodAsicInfoCache.Store(newCache);
+    }
+    m_generation.store(newCache->generation, std::memory_order_release);
+
+    return newCache;
+}
+
+std::shared_ptr<const AMDTADLUtils::Impl::AsicInfoCache> AMDTADLUtils::Impl::MakeStaleAsicInfoCache() const
+{
+    std::shared_ptr<const AsicInfoCache> knownGood = m_knownGoodAsicInfoCache.Load();
+    std::shared_ptr<AsicInfoCache>       staleCache;
+
+    if (nullptr != knownGood)
+    {
+        staleCache = std::make_shared<AsicInfoCache>(*knownGood);
+        staleCache->result = ADL_STALE;
+    }
+    else
+    {
+        staleCache = std::make_shared<AsicInfoCache>();
+        staleCache->result = ADL_TIMED_OUT;
+        staleCache->physicalGPUIndex = std::make_shared<const ADLUtil_PhysicalGPUIndex>(staleCache->asicInfoList);
+        staleCache->generation = 0;
+    }
+
+    return staleCache;
+}
+
+template <typename T>
+bool AMDTADLUtils::Impl::RunWithDeadline(DeadlineWorker& worker, std::shared_ptr<DeadlineTask<T>>& task, const std::function<T()>& query, T& result)
+{
+    std::chrono::milliseconds deadline(m_callDeadlineMs.load(std::memory_order_relaxed));
+
+    if (0 == deadline.count())
+    {
+        result = query();
+        return true;
+    }
+
+    std::shared_ptr<DeadlineTask<T>> pendingTask;
+    bool                             isBackingOff;
+
+    {
+        std::lock_guard<std::mutex> lock(m_deadlineMutex);
+
+        isBackingOff = s_circuitBreakerThreshold <= m_consecutiveTimeouts && std::chrono::steady_clock::now() < m_backoffUntil;
+        bool isRunning = nullptr != task && std::future_status::ready != task->result.wait_for(std::chrono::seconds(0));
+
+        if (!isRunning)
+        {
+            if (isBackingOff)
+            {
+                // ADL keeps missing the deadline; don't pile more threads onto it until the backoff ends
+                return false;
+            }
+
+            std::shared_ptr<DeadlineTask<T>> newTask = std::make_shared<DeadlineTask<T>>();
+            newTask->result = newTask->promise.get_future().share();
+            task = newTask;
+
+            worker.jobs.push_back([this, newTask, query, deadline]()
+            {
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                T queryResult = query();
+
+                if (deadline >= std::chrono::steady_clock::now() - start)
+                {
+                    // ADL answers in time again, end the backoff
+                    std::lock_guard<std::mutex> deadlineLock(m_deadlineMutex);
+                    m_consecutiveTimeouts = 0;
+                }
+
+                newTask->promise.set_value(queryResult);
+            });
+
+            // one long-lived worker per kind of query, instead of a thread per query
+            if (!worker.thread.joinable())
+            {
+                worker.thread = std::thread([this, &worker]() { DeadlineWorkerLoop(worker); });
+            }
+
+            worker.jobQueued.notify_one();
+        }
+
+        pendingTask = task;
+    }
+
+    // while backing off only take a result that is already there
+    if (std::future_status::ready == pendingTask->result.wait_for(isBackingOff ? std::chrono::milliseconds(0) : deadline))
+    {
+        result = pendingTask->result.get();
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(m_deadlineMutex);
+
+    // count every query once, however many callers gave up on it
+    if (!pendingTask->timedOut)
+    {
+        pendingTask->timedOut = true;
+        ++m_consecutiveTimeouts;
+
+        if (s_circuitBreakerThreshold <= m_consecutiveTimeouts)
+        {
+            uint32_t doublings = std::min(m_consecutiveTimeouts - s_circuitBreakerThreshold, 6u);
+            m_backoffUntil = std::chrono::steady_clock::now() + std::min(s_initialBackoff * (1 << doublings), s_maxBackoff);
+        }
+    }
+
+    return false;
+}
+
+void AMDTADLUtils::Impl::DeadlineWorkerLoop(DeadlineWorker& worker)
+{
+    std::unique_lock<std::mutex> lock(m_deadlineMutex);
+
+    for (;;)
+    {
+        worker.jobQueued.wait(lock, [this, &worker]() { return m_stopDeadlineWorkers || !worker.jobs.empty(); });
+
+        if (worker.jobs.empty())
+        {
+            return;
+        }
+
+        std::function<void()> job = std::move(worker.jobs.front());
+        worker.jobs.pop_front();
+
+        lock.unlock();
+        job();
+        lock.lock();
+    }
+}
+
+void AMDTADLUtils::Impl::NotifySubscribers(std::unique_lock<std::mutex>& asicInfoLock, const ADLUtil_AdapterChanges& changes)
+{
+    if (changes.generation == changes.previousGeneration)
+    {
+        asicInfoLock.unlock();
+        return;
+    }
+
+    // the callbacks may query the cache, so they run without m_asicInfoMutex but in publishing order
+    std::lock_guard<std::mutex> notifyLock(m_notifyMutex);
+    asicInfoLock.unlock();
+
+    std::shared_ptr<const SubscriptionList> subscriptions = m_subscriptions.Load();
+
+    for (const Subscription& subscription : *subscriptions)
+    {
+        subscription.callback(changes);
+    }
+}
+
+ADLUtil_Result AMDTADLUtils::Impl::Refresh()
+{
+    ADLUtil_Result                   result;
+    std::function<ADLUtil_Result()> query = [this]() { return RefreshAdapters(); };
+
+    return RunWithDeadline(m_refreshWorker, m_refreshTask, query, result) ? result : ADL_STALE;
+}
+
+ADLUtil_Result AMDTADLUtils::Impl::RefreshAdapters()
+{
+    std::unique_lock<std::mutex> lock(m_asicInfoMutex);
+
+    AsicInfoList   asicInfoList;
+    ADLUtil_Result result = EnumerateAdapters(asicInfoList);
+
+    if (ADL_SUCCESS != result && ADL_WARNING != result)
+    {
+        return result;
+    }
+
+    {
+        // serve live data from now on; the persistent cache file is rewritten by its next revalidation
+        std::lock_guard<std::mutex> persistentCacheLock(m_persistentCacheMutex);
+        m_persistentCache.reset();
+    }
+
+    ADLUtil_AdapterChanges changes;
+    PublishAsicInfoCache(std::move(asicInfoList), result, changes);
+
+    // a driver update changes the versions as well
+    ADLVersionsInfo adlVersionsInfo = {};
+    ADLUtil_Result  versionResult = QueryVersionsInfo(adlVersionsInfo);
+
+    PublishVersionsCache(MakeVersionsCache(adlVersionsInfo, versionResult));
+
+    NotifySubscribers(lock, changes);
+
+    return result;
+}
+
+uint64_t AMDTADLUtils::Impl::Subscribe(AdapterChangesCallback callback)
+{
+    std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
+
+    std::shared_ptr<SubscriptionList> subscriptions = std::make_shared<SubscriptionList>(*m_subscriptions.Load());
+    uint64_t subscriptionID = m_nextSubscriptionID++;
+    subscriptions->push_back(Subscription{subscriptionID, std::move(callback)});
+    m_subscriptions.Store(std::move(subscriptions));
+
+    return subscriptionID;
+}
+
+void AMDTADLUtils::Impl::Unsubscribe(uint64_t subscriptionID)
+{
+    std::lock_guard<std::mutex> lock(m_subscriptionsMutex);
+
+    std::shared_ptr<SubscriptionList> subscriptions = std::make_shared<SubscriptionList>(*m_subscriptions.Load());
+    subscriptions->erase(std::remove_if(subscriptions->begin(), subscriptions->end(), [subscriptionID](const Subscription& subscription)
+    {
+        return subscription.id == subscriptionID;
+    }), subscriptions->end());
+    m_subscriptions.Store(std::move(subscriptions));
+}
+
+ADLUtil_Result AMDTADLUtils::Impl::EnumerateAdapters(AsicInfoList& asicInfoList)
+{
+    ADLUTIL_PHASE_SCOPE(EnumerateAdapters);
+    std::string    sysfsRoot;
+    ADLUtil_Result result = IsSysfsBackend(sysfsRoot) ? ADLUtil_EnumerateSysfsAdapters(sysfsRoot, asicInfoList) : EnumerateADLAdapters(asicInfoList);
+
+    // ADL reports neither the physical GPU nor the NUMA placement of an adapter
+    ADLUtil_FillAdapterTopology(sysfsRoot, asicInfoList);
+
+    return result;
+}
+
+ADLUtil_Result AMDTADLUtils::Impl::EnumerateADLAdapters(AsicInfoList& asicInfoList)
+{
+    Lease          lease;
+    ADLUtil_Result result = AcquireLease(lease);
+
+    // the AdapterInfo scratch array comes from the callback arena in arena mode
+    ArenaScope arenaScope;
+
+    if (ADL_SUCCESS == result)
+    {
+        int adlResult = ADL_OK;
+
+        int numAdapter = 0;
+
+        // Obtain the number of logical adapters for the system
+        // EX: Even if you only have 2 physical GPUs you may logically have 10 adapters.
+        if (IsAvailable<ADLUtil_Entrypoint::ADL2_Adapter_NumberOfAdapters_Get>())
+        {
+            adlResult = Call<ADLUtil_Entrypoint::ADL2_Adapter_NumberOfAdapters_Get>(m_adlContext, &numAdapter);
+        }
+        else
+        {
+            adlResult = Call<ADLUtil_Entrypoint::ADL_Adapter_NumberOfAdapters_Get>(&numAdapter);
+        }
+
+        if (!IsAvailable<ADLUtil_Entrypoint::ADL2_Adapter_AdapterInfo_Get>() && !IsAvailable<ADLUtil_Entrypoint::ADL_Adapter_AdapterInfo_Get>())
+        {
+            result = ADL_MISSING_ENTRYPOINTS;
+        }
+        else if (ADL_OK != adlResult)
+        {
+            result = ADL_GET_ADAPTER_COUNT_FAILED;
+        }
+        else
+        {
+            if (0 < numAdapter)
+            {
+                LPAdapterInfo lpAdapterInfo = reinterpret_cast<LPAdapterInfo>(ADL_Main_Memory_Alloc(sizeof(AdapterInfo) * numAdapter));
+
+                if (nullptr == lpAdapterInfo)
+                {
+                    result = ADL_GET_ADAPTER_INFO_FAILED;
+                }
+                else
+                {
+                    memset(lpAdapterInfo, '\0', sizeof(AdapterInfo) * numAdapter);
+
+                    // Get the AdapterInfo structure for all adapters in the system
+                    if (IsAvailable<ADLUtil_Entrypoint::ADL2_Adapter_AdapterInfo_Get>())
+                    {
+                        adlResult = Call<ADLUtil_Entrypoint::ADL2_Adapter_AdapterInfo_Get>(m_adlContext, lpAdapterInfo, static_cast<int>(sizeof(AdapterInfo) * numAdapter));
+                    }
+                    else
+                    {
+                        adlResult = Call<ADLUtil_Entrypoint::ADL_Adapter_AdapterInfo_Get>(lpAdapterInfo, static_cast<int>(sizeof(AdapterInfo) * numAdapter));
+                    }
+
+                    if (ADL_OK == adlResult)
+                    {
+                        asicInfoList.reserve(asicInfoList.size() + numAdapter);
+
+                        for (int i = 0; i < numAdapter; ++i)
+                        {
+                            // parse in place so the strings are not copied again
+                            asicInfoList.emplace_back();
+
+                            if (ADL_UDID_OK != ADLUtil_ParseAdapterInfo(lpAdapterInfo[i], asicInfoList.back()))
+                            {
+                                // keep the adapter so that indices still line up with ADL, but tell the caller its IDs are incomplete
+                                result = ADL_WARNING;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        result = ADL_GET_ADAPTER_INFO_FAILED;
+                    }
+
+                    ADL_Main_Memory_Free(reinterpret_cast<void**>(&lpAdapterInfo));
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+ADLUtil_Result AMDTADLUtils::Impl::GetADLVersionsInfo(ADLVersionsInfo& adlVersionInfo)
+{
+    std::shared_ptr<const VersionsCache> cache = GetVersionsCache();
+
+    adlVersionInfo = cache->adlVersionsInfo;
+    return cache->result;
+}
+
+ADLUtil_Result AMDTADLUtils::Impl::GetVersionsInfo(ADLUtil_VersionsInfo& versionsInfo)
+{
+    std::shared_ptr<const VersionsCache> cache = GetVersionsCache();
+
+    versionsInfo = cache->versionsInfo;
+    return cache->result;
+}
+
+void AMDTADLUtils::Impl::PublishVersionsCache(const std::shared_ptr<const VersionsCache>& cache)
+{
+    m_versionsQuery.Store(ADLUTIL_ALL_ADAPTERS, cache);
+
+    if (ADL_SUCCESS == cache->result || ADL_WARNING == cache->result)
+    {
+        m_knownGoodVersionsCache.Store(cache);
+    }
+}
+
+std::shared_ptr<const AMDTADLUtils::Impl::VersionsCache> AMDTADLUtils::Impl::MakeStaleVersionsCache() const
+{
+    std::shared_ptr<const VersionsCache> knownGood = m_knownGoodVersionsCache.Load();
+
+    if (nullptr == knownGood)
+    {
+        ADLVersionsInfo adlVersionsInfo = {};
+        return MakeVersionsCache(adlVersionsInfo, ADL_TIMED_OUT);
+    }
+
+    std::shared_ptr<VersionsCache> staleCache = std::make_shared<VersionsCache>(*knownGood);
+    staleCache->result = ADL_STALE;
+    return staleCache;
+}
+
+std::shared_ptr<const AMDTADLUtils::Impl::VersionsCache> AMDTADLUtils::Impl::MakeVersionsCache(const ADLVersionsInfo& adlVersionsInfo, ADLUtil_Result result)
+{
+    std::shared_ptr<VersionsCache> cache = std::make_shared<VersionsCache>();
+    cache->adlVersionsInfo = adlVersionsInfo;
+    cache->result = result;
+
+    // ADL fills the versions on a warning too, ie when it cannot read one of the registry keys of the driver
+    if (ADL_SUCCESS == result || ADL_WARNING == result)
+    {
+        cache->driverVersion = ADLUtil_DriverVersion::FromString(std::string_view(adlVersionsInfo.strDriverVer, strnlen(adlVersionsInfo.strDriverVer, ADL_MAX_PATH)));
+        cache->versionsInfo.driverVersion.assign(adlVersionsInfo.strDriverVer, strnlen(adlVersionsInfo.strDriverVer, ADL_MAX_PATH));
+        cache->versionsInfo.catalystVersion.assign(adlVersionsInfo.strCatalystVersion, strnlen(adlVersionsInfo.strCatalystVersion, ADL_MAX_PATH));
+        cache->versionsInfo.catalystWebLink.assign(adlVersionsInfo.strCatalystWebLink, strnlen(adlVersionsInfo.strCatalystWebLink, ADL_MAX_PATH));
+    }
+
+    return cache;
+}
+
+std::shared_ptr<const AMDTADLUtils::Impl::VersionsCache> AMDTADLUtils::Impl::GetVersionsCache()
+{
+    std::shared_ptr<const VersionsCache> cache = m_versionsQuery.Peek(ADLUTIL_ALL_ADAPTERS);
+
+    if (nullptr == cache)
+    {
+        std::function<std::shared_ptr<const VersionsCache>()> query = [this]() { return FillVersionsCache(); };
+
+        if (!RunWithDeadline(m_versionsWorker, m_versionsTask, query, cache))
+        {
+            cache = MakeStaleVersionsCache();
+        }
+    }
+
+    return cache;
+}
+
+std::shared_ptr<const AMDTADLUtils::Impl::VersionsCache> AMDTADLUtils::Impl::FillVersionsCache()
+{
+    return m_versionsQuery.Get(ADLUTIL_ALL_ADAPTERS);
+}
+
+std::shared_ptr<const AMDTADLUtils::Impl::VersionsCache> AMDTADLUtils::Impl::QueryVersionsCache()
+{
+    std::shared_ptr<const VersionsCache>         cache;
+    std::shared_ptr<const ADLUtil_CacheContents> persistentCache = ReadPersistentCache();
+
+    if (nullptr != persistentCache)
+    {
+        cache = MakeVersionsCache(persistentCache->adlVersionsInfo, ADL_SUCCESS);
+    }
+    else
+    {
+        ADLVersionsInfo adlVersionsInfo = {};
+        ADLUtil_Result result = QueryVersionsInfo(adlVersionsInfo);
+        cache = MakeVersionsCache(adlVersionsInfo, result);
+    }
+
+    // m_versionsQuery publishes the cache under the generation the fill started in, so a Reset during the query retires it
+    if (ADL_SUCCESS == cache->result || ADL_WARNING == cache->result)
+    {
+        m_knownGoodVersionsCache.Store(cache);
+    }
+
+    return cache;
+}
+
+ADLUtil_Result AMDTADLUtils::Impl::QueryVersionsInfo(ADLVersionsInfo& adlVersionInfo)
+{
+    ADLUTIL_PHASE_SCOPE(QueryVersionsInfo);
+    std::string sysfsRoot;
+
+    if (IsSysfsBackend(sysfsRoot))
+    {
+        std::string    driverVersion;
+        ADLUtil_Result result = ADLUtil_QuerySysfsDriverVersion(sysfsRoot, driverVersion);
+
+        memset(&adlVersionInfo, 0, sizeof(adlVersionInfo));
+        memcpy(adlVersionInfo.strDriverVer, driverVersion.data(), std::min<size_t>(driverVersion.size(), ADL_MAX_PATH - 1));
+        return result;
+    }
+
+    Lease          lease;
+    ADLUtil_Result result = AcquireLease(lease);
+
+    if (ADL_SUCCESS == result)
+    {
+        int adlResult = ADL_OK;
+
+        if (IsAvailable<ADLUtil_Entrypoint::ADL2_Graphics_Versions_Get>())
+        {
+            adlResult = Call<ADLUtil_Entrypoint::ADL2_Graphics_Versions_Get>(m_adlContext, &adlVersionInfo);
+        }
+        else
+        {
+            adlResult = Call<ADLUtil_Entrypoint::ADL_Graphics_Versions_Get>(&adlVersionInfo);
+        }
+
+        if (!IsAvailable<ADLUtil_Entrypoint::ADL2_Graphics_Versions_Get>() && !IsAvailable<ADLUtil_Entrypoint::ADL_Graphics_Versions_Get>())
+        {
+            result = ADL_MISSING_ENTRYPOINTS;
+        }
+        else if (ADL_OK != adlResult)
+        {
+            if (ADL_OK_WARNING == adlResult)
+            {
+                result = ADL_WARNING;
+            }
+            else // ADL_OK_WARNING != adlResult
+            {
+                result = ADL_GRAPHICS_VERSIONS_GET_FAILED;
+            }
+        }
+    }
+
+    return result;
+}
+
+void AMDTADLUtils::Impl::SetPersistentCachePath(const std::string& cachePath, std::chrono::seconds revalidationAge)
+{
+    CancelPersistentCacheRevalidation();
+
+    std::lock_guard<std::mutex> lock(m_persistentCacheMutex);
+
+    m_persistentCachePath = cachePath;
+    m_persistentCacheRead = false;
+    m_persistentCache.reset();
+    m_cacheRevalidationAge = std::max(revalidationAge, std::chrono::seconds(0));
+}
+
+void AMDTADLUtils::Impl::CancelPersistentCacheRevalidation()
+{
+    std::future<void> revalidation;
+
+    {
+        std::lock_guard<std::mutex> lock(m_persistentCacheMutex);
+
+        if (nullptr != m_cancelRevalidation)
+        {
+            m_cancelRevalidation->store(true);
+        }
+
+        revalidation = std::move(m_cacheRevalidation);
+    }
+
+    // the revalidation takes m_persistentCacheMutex, so wait for it outside the lock
+    if (revalidation.valid())
+    {
+        revalidation.wait();
+    }
+}
+
+std::string AMDTADLUtils::Impl::GetLibraryPath()
+{
+    Lease lease;
+
+    if (ADL_SUCCESS != AcquireLease(lease))
+    {
+        return std::string();
+    }
+
+    // every library that enumerates exports one of the two
+    void* pEntrypoint = GetEntrypointAddress(ADLUtil_Entrypoint::ADL2_Adapter_AdapterInfo_Get);
+
+    if (nullptr == pEntrypoint)
+    {
+        pEntrypoint = GetEntrypointAddress(ADLUtil_Entrypoint::ADL_Adapter_AdapterInfo_Get);
+    }
+
+    return (nullptr != pEntrypoint) ? ADLUtil_GetLibraryPath(pEntrypoint) : std::string();
+}
+
+std::shared_ptr<const ADLUtil_CacheContents> AMDTADLUtils::Impl::ReadPersistentCache()
+{
+    std::lock_guard<std::mutex> lock(m_persistentCacheMutex);
+
+    if (!m_persistentCachePath.empty() && !m_persistentCacheRead)
+    {
+        m_persistentCacheRead = true;
+
+        std::shared_ptr<ADLUtil_CacheContents> contents = std::make_shared<ADLUtil_CacheContents>();
+        ADLUtil_CacheStamp                     stamp;
+
+        {
+            ADLUTIL_PHASE_SCOPE(ReadPersistentCache);
+
+            std::string sysfsRoot;
+            std::string libraryName;
+
+            {
+                std::lock_guard<std::mutex> libLock(m_libMutex);
+                stamp.backend = m_backend;
+                sysfsRoot = m_sysfsRoot.empty() ? ADLUTIL_DEFAULT_SYSFS_ROOT : m_sysfsRoot;
+                libraryName = m_libraryName.empty() ? ADLUtil_GetDefaultLibraryName() : m_libraryName;
+            }
+
+            if (ADLUtil_ReadCacheFile(m_persistentCachePath, stamp.backend, *contents))
+            {
+                m_persistentCache = contents;
+            }
+
+            // the file is keyed by the backend, and stamped with the driver so that a driver update is noticed without loading ADL.
+            // A library given by path is stamped there; a bare name at the path the library was loaded from when the file was written.
+            if (ADLUtil_Backend::ADL == stamp.backend)
+            {
+                bool hasDirectory = std::string::npos != libraryName.find_first_of("/\\");
+                stamp.libraryPath = hasDirectory ? libraryName : ((nullptr != m_persistentCache) ? m_persistentCache->stamp.libraryPath : std::string());
+            }
+
+            stamp.driverStamp = ADLUtil_GetDriverStamp(stamp.backend, stamp.libraryPath, sysfsRoot);
+            stamp.writeTime = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        }
+
+        // a valid file of the same driver is trusted until it ages out, so that a warm launch does not load ADL;
+        // otherwise revalidate in the background, which also creates or repairs the file
+        bool isCurrent = nullptr != m_persistentCache && 0 != stamp.driverStamp && stamp.driverStamp == m_persistentCache->stamp.driverStamp &&
+                         m_persistentCache->stamp.writeTime <= stamp.writeTime &&
+                         m_cacheRevalidationAge.count() > stamp.writeTime - m_persistentCache->stamp.writeTime;
+
+        if (!isCurrent)
+        {
+            std::string cachePath = m_persistentCachePath;
+            std::shared_ptr<const ADLUtil_CacheContents> servedCache = m_persistentCache;
+            std::shared_ptr<std::atomic<bool>> cancelled = std::make_shared<std::atomic<bool>>(false);
+
+            m_cancelRevalidation = cancelled;
+            m_cacheRevalidation = std::async(std::launch::async, [this, cachePath, stamp, servedCache, cancelled]()
+            {
+                RevalidatePersistentCache(cachePath, stamp, servedCache, *cancelled);
+            });
+        }
+    }
+
+    return m_persistentCache;
+}
+
+void AMDTADLUtils::Impl::RevalidatePersistentCache(const std::string& cachePath, const ADLUtil_CacheStamp& stamp, std::shared_ptr<const ADLUtil_CacheContents> servedCache,
+                                                   const std::atomic<bool>& cancelled)
+{
+    ADLUTIL_PHASE_SCOPE(RevalidatePersistentCache);
+
+    AsicInfoList    asicInfoList;
+    ADLVersionsInfo adlVersionsInfo;
+    ADLUtil_Result  asicInfoResult;
+    ADLUtil_Result  versionResult = ADL_RESULT_NONE;
+
+    if (nullptr == servedCache)
+    {
+        // the callers are enumerating live; wait for their results rather than enumerating again
+        AsicInfoListSnapshot snapshot;
+        asicInfoResult = GetAsicInfoList(snapshot);
+        asicInfoList = *snapshot;
+
+        if (!cancelled)
+        {
+            versionResult = GetADLVersionsInfo(adlVersionsInfo);
+        }
+    }
+    else
+    {
+        asicInfoResult = EnumerateAdapters(asicInfoList);
+
+        if (!cancelled)
+        {
+            versionResult = QueryVersionsInfo(adlVersionsInfo);
+        }
+    }
+
+    if (cancelled || ADL_SUCCESS != asicInfoResult || ADL_SUCCESS != versionResult)
+    {
+        // keep serving what we have, a later launch will try again
+        return;
+    }
+
+    uint64_t knownChecksum = (nullptr != servedCache) ? servedCache->checksum : 0;
+
+    // stamped like the served file, the live data has the same checksum unless it changed
+    if (nullptr != servedCache && ADLUtil_ComputeCacheChecksum(asicInfoList, adlVersionsInfo, servedCache->stamp) != knownChecksum)
+    {
+        // the driver or the hardware changed since the file was written; publish the live data
+        {
+            std::lock_guard<std::mutex> lock(m_persistentCacheMutex);
+            m_persistentCache.reset();
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(m_asicInfoMutex);
+            ADLUtil_AdapterChanges changes;
+            PublishAsicInfoCache(AsicInfoList(asicInfoList), asicInfoResult, changes);
+            NotifySubscribers(lock, changes);
+        }
+
+        PublishVersionsCache(MakeVersionsCache(adlVersionsInfo, versionResult));
+    }
+
+    // stamp the library that answered, which the loader may have found somewhere else than where the file says
+    ADLUtil_CacheStamp writeStamp = stamp;
+
+    if (ADLUtil_Backend::ADL == stamp.backend)
+    {
+        writeStamp.libraryPath = GetLibraryPath();
+        writeStamp.driverStamp = ADLUtil_GetDriverStamp(stamp.backend, writeStamp.libraryPath, std::string());
+    }
+
+    // rewrite the file even if the data did not change, to restart its revalidation age
+    ADLUtil_WriteCacheFile(cachePath, asicInfoList, adlVersionsInfo, writeStamp, knownChecksum);
+}
+
+ADLUtil_Result AMDTADLUtils::GetDriverVersion(unsigned int& majorVer, unsigned int& minorVer, unsigned int& subMinorVer) const
+{
+    ADLUtil_DriverVersion driverVersion;
+    ADLUtil_Result adlResult = AMDTADLUtils::Instance()->GetDriverVersion(driverVersion);
+
+    majorVer = driverVersion.majorVer;
+    minorVer = driverVersion.minorVer;
+    subMinorVer = driverVersion.subMinorVer;
+
+    return adlResult;
+}
+
+ADLUtil_Result AMDTADLUtils::Impl::GetDriverVersion(ADLUtil_DriverVersion& driverVersion)
+{
+    std::shared_ptr<const VersionsCache> cache = GetVersionsCache();
+
+    driverVersion = cache->driverVersion;
+    return cache->result;
+}
+
+void AMDTADLUtils::Impl::SetCallDeadline(std::chrono::milliseconds deadline)
+{
+    m_callDeadlineMs.store(std::max<int64_t>(0, deadline.count()), std::memory_order_relaxed);
+}
+
+void AMDTADLUtils::Impl::Reset()
+{
+    {
+        // requery ADL rather than serving the persistent cache again
+        std::lock_guard<std::mutex> lock(m_persistentCacheMutex);
+        m_persistentCache.reset();
+    }
+
+    // readers that already hold a snapshot keep it alive; the next query re-enumerates. An enumeration in progress
+    // publishes under m_asicInfoMutex, so waiting for it here retires its result as well
+    {
+        std::lock_guard<std::mutex> lock(m_asicInfoMutex);
+        m_asicInfoQuery.Invalidate();
+    }
+
+    // a version query in progress is filled under the old generation and not served afterwards
+    m_versionsQuery.Invalidate();
+}
+
+AMDTADLUtils::Lease::Lease() :
+    m_pImpl(nullptr)
+{
+}
+
+AMDTADLUtils::Lease::~Lease()
+{
+    Release();
+}
+
+AMDTADLUtils::Lease::Lease(Lease&& other) noexcept :
+    m_pImpl(other.m_pImpl)
+{
+    other.m_pImpl = nullptr;
+}
+
+AMDTADLUtils::Lease& AMDTADLUtils::Lease::operator=(Lease&& other) noexcept
+{
+    if (this != &other)
+    {
+        Release();
+        m_pImpl = other.m_pImpl;
+        other.m_pImpl = nullptr;
+    }
+
+    return *this;
+}
+
+void AMDTADLUtils::Lease::Release()
+{
+    if (nullptr != m_pImpl)
+    {
+        m_pImpl->ReleaseLease();
+        m_pImpl = nullptr;
+    }
+}
+
+AMDTADLUtils::AMDTADLUtils() :
+    m_pImpl(std::make_unique<Impl>(*this)),
+    m_pEntrypointTable(&m_pImpl->m_entrypointTable)
+{
+}
+
+AMDTADLUtils::~AMDTADLUtils()
+{
+    m_pImpl->Shutdown();
+}
+
+void* AMDTADLUtils::ResolveEntrypoint(ADLUtil_Entrypoint entrypoint)
+{
+    return m_pImpl->ResolveEntrypoint(entrypoint);
+}
+
+void* AMDTADLUtils::GetContext() const
+{
+    return m_pImpl->m_adlContext;
+}
+
+ADLUtil_Result AMDTADLUtils::LoadAndInit()
+{
+    return m_pImpl->LoadAndInit();
+}
+
+ADLUtil_Result AMDTADLUtils::Unload(uint32_t leaseTimeoutMs)
+{
+    return m_pImpl->Unload(std::chrono::milliseconds(leaseTimeoutMs));
+}
+
+ADLUtil_Result AMDTADLUtils::AcquireLease(Lease& lease)
+{
+    return m_pImpl->AcquireLease(lease);
+}
+
+void AMDTADLUtils::SetIdleUnloadTimeout(uint32_t timeoutMs)
+{
+    m_pImpl->SetIdleUnloadTimeout(std::chrono::milliseconds(timeoutMs));
+}
+
+void AMDTADLUtils::SetLibraryName(const std::string& libraryName)
+{
+    m_pImpl->SetLibraryName(libraryName);
+}
+
+void AMDTADLUtils::SetUseArenaAllocator(bool useArena)
+{
+    m_pImpl->SetUseArenaAllocator(useArena);
+}
+
+void AMDTADLUtils::SetBackend(ADLUtil_Backend backend)
+{
+    m_pImpl->SetBackend(backend);
+}
+
+void AMDTADLUtils::SetSysfsRoot(const std::string& sysfsRoot)
+{
+    m_pImpl->SetSysfsRoot(sysfsRoot);
+}
+
+void AMDTADLUtils::SetRecordPath(const std::string& recordPath)
+{
+    m_pImpl->SetRecordPath(recordPath);
+}
+
+void AMDTADLUtils::SetReplayPath(const std::string& replayPath, bool replayLatency)
+{
+    m_pImpl->SetReplayPath(replayPath, replayLatency);
+}
+
+ADLUtil_Result AMDTADLUtils::GetAsicInfoList(AsicInfoListSnapshot& asicInfoList)
+{
+    return m_pImpl->GetAsicInfoList(asicInfoList);
+}
+
+ADLUtil_Result AMDTADLUtils::GetPhysicalGPUIndex(std::shared_ptr<const ADLUtil_PhysicalGPUIndex>& physicalGPUIndex)
+{
+    return m_pImpl->GetPhysicalGPUIndex(physicalGPUIndex);
+}
+
+ADLUtil_Result AMDTADLUtils::GetADLVersionsInfo(ADLVersionsInfo& adlVersionInfo)
+{
+    return m_pImpl->GetADLVersionsInfo(adlVersionInfo);
+}
+
+ADLUtil_Result AMDTADLUtils::GetVersionsInfo(ADLUtil_VersionsInfo& versionsInfo)
+{
+    return m_pImpl->GetVersionsInfo(versionsInfo);
+}
+
+ADLUtil_Result AMDTADLUtils::GetDriverVersion(ADLUtil_DriverVersion& driverVersion)
+{
+    return m_pImpl->GetDriverVersion(driverVersion);
+}
+
+void AMDTADLUtils::SetPersistentCachePath(const std::string& cachePath, uint32_t revalidationAgeSeconds)
+{
+    m_pImpl->SetPersistentCachePath(cachePath, std::chrono::seconds(revalidationAgeSeconds));
+}
+
+void AMDTADLUtils::SetCallDeadline(uint32_t deadlineMs)
+{
+    m_pImpl->SetCallDeadline(std::chrono::milliseconds(deadlineMs));
+}
+
+void AMDTADLUtils::Reset()
+{
+    m_pImpl->Reset();
+}
+
+ADLUtil_Result AMDTADLUtils::Refresh()
+{
+    return m_pImpl->Refresh();
+}
+
+uint64_t AMDTADLUtils::GetGeneration() const
+{
+    return m_pImpl->m_generation.load(std::memory_order_acquire);
+}
+
+/// Gives the functions of ADLUtilAsync.h access to the implementation of the singleton
+class ADLUtil_AsyncAccess
+{
+public:
+    /// @returns the implementation of the singleton.
+    static AMDTADLUtils::Impl& GetImpl()
+    {
+        return *AMDTADLUtils::Instance()->m_pImpl;
+    }
+};
+
+std::shared_future<ADLUtil_Result> ADLUtil_PrefetchAsync()
+{
+    return ADLUtil_AsyncAccess::GetImpl().PrefetchAsync();
+}
+
+std::future<ADLUtil_Result> ADLUtil_GetAsicInfoListAsync(AsicInfoListCallback callback)
+{
+    return ADLUtil_AsyncAccess::GetImpl().GetAsicInfoListAsync(std::move(callback));
+}
+
+std::future<ADLUtil_Result> ADLUtil_GetADLVersionsInfoAsync(ADLVersionsInfoCallback callback)
+{
+    return ADLUtil_AsyncAccess::GetImpl().GetADLVersionsInfoAsync(std::move(callback));
+}
+
+uint64_t ADLUtil_Subscribe(AdapterChangesCallback callback)
+{
+    return ADLUtil_AsyncAccess::GetImpl().Subscribe(std::move(callback));
+}
+
+void ADLUtil_Unsubscribe(uint64_t subscriptionID)
 {
-    m_asicInfoList.clear();
-    m_asicInfoListRetVal = ADL_RESULT_NONE;
-    m_versionRetVal = ADL_RESULT_NONE;
+    ADLUtil_AsyncAccess::GetImpl().Unsubscribe(subscriptionID);
 }
@@ -3,86 +3,56 @@
 /// @author AMD Developer Tools Team
 /// @file
 /// @brief  Interface from Developer Tools to ADL.
+///         This header does not include the ADL SDK or Windows.h; include ADLUtilEntrypoints.h to call ADL directly,
+///         and ADLUtilAsync.h for the asynchronous getters and the adapter change subscriptions.
 //==============================================================================
 
 #ifndef _ADL_UTIL_H_
 #define _ADL_UTIL_H_
 
-#include <mutex>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
-#include "adl_sdk.h"
 #include "TSingleton.h"
 
-#include <Windows.h>
+#include "ADLUtilTypes.h"
 
-/// Stores ASIC information that is parsed from data supplied by ADL
-struct ADLUtil_ASICInfo
-{
-    std::string adapterName;      ///< description of the adapter ie "ATI Radeon HD 5800 series"
-    std::string deviceIDString;   ///< string version of the deviceID (for easy comparing since the deviceID is hex, but stored as int)
-    int vendorID;                 ///< the vendor ID
-    int deviceID;                 ///< the device ID (hex value stored as int)
-    int revID;                    ///< the revision ID (hex value stored as int)
-    unsigned int gpuIndex;        ///< GPU index in the system
-    std::string registryPath;     ///< Adapter registry path
-    std::string registryPathExt;  ///< Adapter registry path
-};
+struct ADLVersionsInfo;
+class ADLUtil_PhysicalGPUIndex;
 
-typedef std::vector<ADLUtil_ASICInfo> AsicInfoList;
+/// Identifiers of the ADL entry points, defined in ADLUtilEntrypoints.h
+enum class ADLUtil_Entrypoint : uint32_t;
 
-/// Return values from the ADLUtil
-enum ADLUtil_Result
-{
-    ADL_RESULT_NONE,                  ///< Undefined ADL result
-    ADL_SUCCESS = 1,                  ///< Data was retrieved successfully.
-    ADL_NOT_FOUND,                    ///< ADL DLLs were not found.
-    ADL_MISSING_ENTRYPOINTS,          ///< ADL did not expose necessary entrypoints.
-    ADL_INITIALIZATION_FAILED,        ///< ADL could not be initialized.
-    ADL_GET_ADAPTER_COUNT_FAILED,     ///< ADL was unable to return the number of adapters.
-    ADL_GET_ADAPTER_INFO_FAILED,      ///< ADL was unable to return adapter info.
-    ADL_GRAPHICS_VERSIONS_GET_FAILED, ///< ADL was unable to return graphics versions info.
-    ADL_WARNING,                      ///< ADL Operation succeeded, but generated a warning.
-};
+/// Maps an ADLUtil_Entrypoint to its function pointer type, specialized in ADLUtilEntrypoints.h
+template <ADLUtil_Entrypoint Sym>
+struct ADLUtil_EntrypointTraits;
+
+/// Parses the vendor, device, subsystem and revision IDs out of an ADL UDID in a single pass.
+/// Fields that are missing or malformed are left as 0.
+/// @param[in]  udid        the UDID, ie "PCI_VEN_1002&DEV_67DF&SUBSYS_E3871DA2&REV_E7_4&2A3D0B5A&0&0008"
+/// @param[out] pciIdentity the parsed IDs
+/// @returns    an enum ADLUtil_UDIDParseResult status code.
+ADLUtil_UDIDParseResult ADLUtil_ParseUDID(std::string_view udid, ADLUtil_PCIIdentity& pciIdentity);
+
+/// Matches the adapters of two enumerations by PCI domain, bus location and UDID. Logical adapters that share all of them are matched in list order.
+/// @param[in]  previousList the earlier enumeration
+/// @param[in]  currentList  the later enumeration
+/// @param[out] changes      receives the added, removed and changed adapters; the generations and snapshots are not touched
+void ADLUtil_DiffAsicInfoLists(const AsicInfoList& previousList, const AsicInfoList& currentList, ADLUtil_AdapterChanges& changes);
 
 /// Uses ADL to obtain information about the available ASICs. This is deprecated -- use AMDTADLUtils::Instance()->GetAsicInfoList() instead.
 /// @param   asicInfoList A list to populate with the available ASICs.
 /// @returns              an enum ADLUtil_Result status code.
 [[deprecated]] ADLUtil_Result ADLUtil_GetASICInfo(AsicInfoList &asicInfoList);
 
-/// Uses ADL to obtain version information about installed drivers. This is deprecated -- use AMDTADLUtils::Instance()->GetADLVersionsInfo() instead
+/// Uses ADL to obtain version information about installed drivers. This is deprecated -- use AMDTADLUtils::Instance()->GetVersionsInfo() instead
 /// @param   info The version information.
 /// @returns      an enum ADLUtil_Result status code.
 [[deprecated]] ADLUtil_Result ADLUtil_GetVersionsInfo(struct ADLVersionsInfo &info);
 
-// Typedefs of the ADL function pointers. If additional entry points are needed, add them here
-typedef int(*ADL_Main_Control_Create_fn)(ADL_MAIN_MALLOC_CALLBACK, int);
-typedef int(*ADL_Main_Control_Destroy_fn)();
-typedef int(*ADL2_Main_Control_Create_fn)(ADL_MAIN_MALLOC_CALLBACK, int, ADL_CONTEXT_HANDLE*);
-typedef int(*ADL2_Main_Control_Destroy_fn)(ADL_CONTEXT_HANDLE);
-
-typedef int(*ADL_Adapter_NumberOfAdapters_Get_fn)(int*);
-typedef int(*ADL_Adapter_AdapterInfo_Get_fn)(LPAdapterInfo, int);
-typedef int(*ADL2_Adapter_NumberOfAdapters_Get_fn)(ADL_CONTEXT_HANDLE, int*);
-typedef int(*ADL2_Adapter_AdapterInfo_Get_fn)(ADL_CONTEXT_HANDLE, LPAdapterInfo, int);
-
-typedef int(*ADL_Graphics_Versions_Get_fn)(struct ADLVersionsInfo*);
-typedef int(*ADL2_Graphics_Versions_Get_fn)(ADL_CONTEXT_HANDLE, struct ADLVersionsInfo*);
-
-// Table of ADL entry points. If additional entry points are needed, add them to this table and the code will automatically initialize them
-#define ADL_INTERFACE_TABLE              \
-    X(ADL_Main_Control_Create)           \
-    X(ADL_Main_Control_Destroy)          \
-    X(ADL2_Main_Control_Create)          \
-    X(ADL2_Main_Control_Destroy)         \
-    X(ADL_Adapter_NumberOfAdapters_Get)  \
-    X(ADL_Adapter_AdapterInfo_Get)       \
-    X(ADL2_Adapter_NumberOfAdapters_Get) \
-    X(ADL2_Adapter_AdapterInfo_Get)      \
-    X(ADL_Graphics_Versions_Get)         \
-    X(ADL2_Graphics_Versions_Get)
-
 //------------------------------------------------------------------------------------
 /// Singleton class to provide caching of values returned by various ADLUtil functions
 //------------------------------------------------------------------------------------
@@ -91,23 +61,150 @@ class AMDTADLUtils : public TSingleton<AMDTADLUtils>
     /// TSingleton needs to be able to use our constructor.
     friend class TSingleton<AMDTADLUtils>;
 
+    /// The ADL state and the caches, defined in ADLUtil.cpp so that this header does not depend on ADL
+    class Impl;
+
+    /// The resolved entry points, defined in ADLUtilEntrypoints.h
+    struct EntrypointTable;
+
+    /// Gives the functions of ADLUtilAsync.h access to the implementation
+    friend class ADLUtil_AsyncAccess;
+
 public:
+    //------------------------------------------------------------------------------------
+    /// Keeps the ADL library and its context loaded while it is held. Calls into ADL made through
+    /// Call or GetContext must hold a lease when an idle unload timeout is set.
+    //------------------------------------------------------------------------------------
+    class Lease
+    {
+    public:
+        /// constructor, creates a lease that holds nothing
+        Lease();
+
+        /// destructor, releases the lease
+        ~Lease();
+
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        /// @returns true if the lease holds the library.
+        bool IsHeld() const { return nullptr != m_pImpl; }
+
+        /// Releases the lease before it is destroyed
+        void Release();
+
+    private:
+        friend class Impl;
+
+        Impl* m_pImpl; ///< the implementation the lease is counted in, nullptr if the lease holds nothing
+    };
+
     /// Loads ADL library, initializes the function entry points, and calls ADL2_Main_Control_Create
     ADLUtil_Result LoadAndInit();
 
-    /// Calls ADL2_Main_Control_Destroy, unloads ADL library, and clears the function entry points
-    ADLUtil_Result Unload();
+    /// Waits until no lease is held, then calls ADL2_Main_Control_Destroy, unloads ADL library, clears the function entry points
+    /// and resets the caches. A lease held by the calling thread, a running telemetry sampler or a context pool is never released
+    /// while Unload waits, so stop those first; otherwise Unload gives up after the timeout.
+    /// @param[in] leaseTimeoutMs the longest time to wait for the leases to be released, in milliseconds
+    /// @returns   ADL_SUCCESS, or ADL_LEASES_HELD if leases were still held after the timeout; the library then stays loaded.
+    ADLUtil_Result Unload(uint32_t leaseTimeoutMs = 5000);
+
+    /// Loads the library if needed and leases it. While any lease is held neither Unload nor the idle unload frees the library.
+    /// @param[out] lease receives the lease; a lease it held before is released
+    /// @returns    an enum ADLUtil_Result status code of loading the library. The lease is only held on ADL_SUCCESS.
+    ADLUtil_Result AcquireLease(Lease& lease);
+
+    /// Unloads the library once no lease was held for the given time. The caches stay filled, and the next lease or query that
+    /// needs ADL loads the library again.
+    /// @param[in] timeoutMs the quiet period after which the library is unloaded in milliseconds, 0 (the default) to keep it loaded
+    void SetIdleUnloadTimeout(uint32_t timeoutMs);
+
+    /// Overrides the file name or path of the ADL library, ie to load a stand-in library in tests.
+    /// Takes effect the next time the library is loaded; an empty name restores the platform default.
+    /// @param[in] libraryName the file name or path of the library
+    void SetLibraryName(const std::string& libraryName);
+
+    /// Serves the ADL allocation callback and the enumeration scratch space from an arena instead of malloc during an enumeration.
+    /// ADL calls made outside an enumeration, ie by the sampler, a context pool or the caller, still allocate from the heap,
+    /// so the buffers ADL returns to the caller are plain malloc memory that may be released with free.
+    /// The arena is rewound after each enumeration, so a steady-state enumeration makes no callback heap allocations.
+    /// Takes effect the next time the library is loaded.
+    /// @param[in] useArena true to use the arena
+    void SetUseArenaAllocator(bool useArena);
+
+    /// Selects where the adapter list and the driver version come from. Takes effect with the next query; call Reset() to requery.
+    /// The entry points, the context and the samplers always use ADL.
+    /// @param[in] backend the backend, ADLUtil_Backend::ADL by default
+    void SetBackend(ADLUtil_Backend backend);
+
+    /// Overrides the root of the sysfs tree read by ADLUtil_Backend::Sysfs and for the PCI topology of the adapters, ie to
+    /// enumerate a fake tree in tests.
+    /// Takes effect with the next query; an empty root restores "/sys".
+    /// @param[in] sysfsRoot the root of the sysfs tree
+    void SetSysfsRoot(const std::string& sysfsRoot);
+
+    /// Records the ADL calls, with their output and latency, into a replay profile for SetReplayPath.
+    /// Takes effect the next time the library is loaded; the profile is written when the library is unloaded.
+    /// An empty path stops recording.
+    /// @param[in] recordPath the path of the profile to write
+    void SetRecordPath(const std::string& recordPath);
+
+    /// Serves the ADL calls from a replay profile written through SetRecordPath instead of loading the library, so that
+    /// enumeration and sampling can be reproduced on a machine without the recorded driver.
+    /// Takes effect the next time the library is loaded; an empty path loads the library again.
+    /// @param[in] replayPath    the path of the profile
+    /// @param[in] replayLatency true to make each replayed call take as long as the recorded call did, false to return at once
+    void SetReplayPath(const std::string& replayPath, bool replayLatency = false);
+
+    /// @returns the counters of the allocations made through the ADL allocation callback.
+    ADLUtil_AllocationStats GetAllocationStats() const;
+
+    /// Returns an ADL entry point, resolving it from the loaded library on first use. Defined in ADLUtilEntrypoints.h.
+    /// @returns the entry point, or nullptr if the library is not loaded or does not export it.
+    template <ADLUtil_Entrypoint Sym>
+    typename ADLUtil_EntrypointTraits<Sym>::Type GetEntrypoint();
+
+    /// @returns true if the loaded ADL library exports the entry point. Defined in ADLUtilEntrypoints.h.
+    template <ADLUtil_Entrypoint Sym>
+    bool IsAvailable();
+
+    /// Calls an ADL entry point. With ADL_UTIL_ENABLE_INSTRUMENTATION the call is counted and timed. Defined in ADLUtilEntrypoints.h.
+    /// @param[in] args the arguments of the entry point
+    /// @returns   the ADL return code of the entry point, or ADL_ERR_NOT_SUPPORTED if it is not available.
+    template <ADLUtil_Entrypoint Sym, typename... Args>
+    int Call(Args... args);
+
+    /// @returns the ADL_CONTEXT_HANDLE to pass to ADL2 entry points, nullptr if the library is not loaded or only offers the legacy ADL entry points.
+    void* GetContext() const;
 
     /// Get the AsicInfoList from ADL. The value is cached so that multiple calls don't need to requery ADL
     /// @param[out] asicInfoList the AsicInfoList from ADL
     /// @returns    an enum ADLUtil_Result status code.
     ADLUtil_Result GetAsicInfoList(AsicInfoList& asicInfoList);
 
+    /// Get a shared snapshot of the AsicInfoList from ADL. Once the cache is filled this does not lock or copy the list.
+    /// @param[out] asicInfoList the immutable snapshot of the AsicInfoList from ADL
+    /// @returns    an enum ADLUtil_Result status code.
+    ADLUtil_Result GetAsicInfoList(AsicInfoListSnapshot& asicInfoList);
+
+    /// Get the index of the physical GPUs behind the logical adapters of the AsicInfoList. The index is built once
+    /// per enumeration and shared by all callers; its logical adapter indices refer to the AsicInfoList of the same enumeration.
+    /// @param[out] physicalGPUIndex the physical GPU index
+    /// @returns    an enum ADLUtil_Result status code of the enumeration.
+    ADLUtil_Result GetPhysicalGPUIndex(std::shared_ptr<const ADLUtil_PhysicalGPUIndex>& physicalGPUIndex);
+
     /// Get the Catalyst version info from ADL. The value is cached so that multiple calls don't need to requery ADL
     /// @param[out] adlVersionInfo the Catalyst version info from ADL
     /// @returns    an enum ADLUtil_Result status code.
     ADLUtil_Result GetADLVersionsInfo(ADLVersionsInfo& adlVersionInfo);
 
+    /// Get the driver version strings from ADL, from the same cache as GetADLVersionsInfo
+    /// @param[out] versionsInfo the driver version strings
+    /// @returns    an enum ADLUtil_Result status code.
+    ADLUtil_Result GetVersionsInfo(ADLUtil_VersionsInfo& versionsInfo);
+
     /// Gets the major, minor and subminor number of the driver version. For
     /// instance, if the driver version string is 14.10.1005-140115n-021649E-ATI,
     /// the major number is "14", the minor is "10", and the sub-minor is "1005".
@@ -118,9 +215,46 @@ public:
     /// @return an enum ADLUtil_Result status code.
     ADLUtil_Result GetDriverVersion(unsigned int& majorVer, unsigned int& minorVer, unsigned int& subMinorVer) const;
 
+    /// Gets the parsed driver version. The version string is parsed once per fill of the version cache;
+    /// once filled this neither locks nor allocates.
+    /// @param[out] driverVersion the parsed driver version, all 0 if the version query failed
+    /// @returns    an enum ADLUtil_Result status code of the version query.
+    ADLUtil_Result GetDriverVersion(ADLUtil_DriverVersion& driverVersion);
+
+    /// Enables the persistent enumeration cache. When the file holds valid data for the selected backend, the getters serve it
+    /// without loading ADL. The file is revalidated against the live driver on a background thread, and atomically replaced
+    /// if it changed, only when the driver file changed since it was written or it is older than the revalidation age.
+    /// The destructor cancels a revalidation that is in progress once its current query returns.
+    /// Call this before the first query; an empty path disables the cache.
+    /// @param[in] cachePath              the path of the cache file
+    /// @param[in] revalidationAgeSeconds the age in seconds after which the file is revalidated although the driver did not change
+    void SetPersistentCachePath(const std::string& cachePath, uint32_t revalidationAgeSeconds = 24 * 60 * 60);
+
+    /// Bounds the time the getters and Refresh wait for ADL. With a deadline, the queries run on long-lived worker threads,
+    /// one for each of the ASIC list, the version info and Refresh, started by the first query of their kind, so that a query
+    /// that hangs only holds up the queries of its own kind. A caller that is not answered in time gets the last data ADL
+    /// returned successfully with ADL_STALE, or ADL_TIMED_OUT if there is none, while the query continues and publishes its
+    /// result when it completes.
+    /// After repeated timeouts new queries are held back for a backoff period that doubles with every further timeout;
+    /// meanwhile the getters return the earlier data right away. A query that completes within the deadline ends the backoff.
+    /// The destructor still waits for a query that is in progress.
+    /// @param[in] deadlineMs the longest time to wait for ADL in milliseconds, 0 (the default) to wait for as long as ADL takes
+    void SetCallDeadline(uint32_t deadlineMs);
+
     /// Resets the singleton data so that the next call with requery the data rather than using any cached data
     void Reset();
 
+    /// Re-enumerates the adapters and requeries the version info. If the adapters differ from the last published
+    /// enumeration, publishes them as a new generation and notifies the subscribers of ADLUtil_Subscribe.
+    /// On failure the previous data stays published.
+    /// With a call deadline, returns ADL_STALE if the deadline passes; the refresh then completes in the background.
+    /// Must not be called from a subscriber callback.
+    /// @returns an enum ADLUtil_Result status code of the enumeration.
+    ADLUtil_Result Refresh();
+
+    /// @returns the generation of the published adapter list, 0 before the first enumeration. It only changes when the adapters change.
+    uint64_t GetGeneration() const;
+
 private:
     /// constructor
     AMDTADLUtils();
@@ -128,19 +262,19 @@ private:
     /// destructor
     ~AMDTADLUtils();
 
-    HINSTANCE          m_libHandle;          ///< Handle to ADL Module
-    ADL_CONTEXT_HANDLE m_adlContext;         ///< ADL Context for use with ADL2 functions
-    std::mutex         m_asicInfoMutex;      ///< Mutex to protect access to the m_asicInfoList
-    std::mutex         m_adlVersionsMutex;   ///< Mutex to protect access to the m_adlVersionsInfo
-    AsicInfoList       m_asicInfoList;       ///< the ADL ASIC list
-    ADLVersionsInfo    m_adlVersionsInfo;    ///< the ADL Version info
+    /// Looks an entry point up, resolving it from the loaded library on first use. Defined in ADLUtilEntrypoints.h,
+    /// so that a resolved entry point costs Call one atomic load rather than a call into the implementation.
+    /// @param[in] entrypoint the entry point
+    /// @returns   the address of the entry point, or nullptr if the library is not loaded or does not export it.
+    inline void* GetEntrypointAddress(ADLUtil_Entrypoint entrypoint);
 
-    ADLUtil_Result     m_asicInfoListRetVal; ///< the result of the AsicInfoList query
-    ADLUtil_Result     m_versionRetVal;      ///< the result of the ADL Version query
-
-#define X(SYM) SYM##_fn m_##SYM; ///< ADL entry point
-    ADL_INTERFACE_TABLE;
-#undef X
+    /// Slow path of GetEntrypointAddress: resolves an entry point that was not looked up since the library was loaded
+    /// @param[in] entrypoint the entry point
+    /// @returns   the address of the entry point, or the missing marker of EntrypointTable.
+    void* ResolveEntrypoint(ADLUtil_Entrypoint entrypoint);
 
+    std::unique_ptr<Impl> m_pImpl;            ///< the implementation
+    EntrypointTable*      m_pEntrypointTable; ///< the entry point table of the implementation
 };
+
 #endif //_ADL_UTIL_H_
@@ -0,0 +1,79 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  C++20 named module AMD.ADLUtil, exporting the interface of ADLUtil.h, ADLUtilAsync.h and ADLUtilASICDatabase.h.
+///         ADL entry points are not part of the module; include ADLUtilEntrypoints.h to call ADL directly.
+//==============================================================================
+
+module;
+
+#include "ADLUtil.h"
+#include "ADLUtilAsync.h"
+#include "ADLUtilASICDatabase.h"
+
+export module AMD.ADLUtil;
+
+export using ::ADLUtil_ASICInfo;
+export using ::ADLUtil_PCITopology;
+export using ::ADLUtil_InlineString;
+export using ::ADLUtil_AdapterString;
+export using ::ADLUtil_DeviceIDString;
+export using ::ADLUtil_FamilyString;
+export using ::AsicInfoList;
+export using ::AsicInfoListSnapshot;
+export using ::ADLUtil_AdapterChanges;
+export using ::ADLUtil_DriverVersion;
+export using ::ADLUtil_VersionsInfo;
+export using ::ADLUtil_AllocationStats;
+export using ::ADLUtil_PCIIdentity;
+export using ::ADLUtil_ASICGeneration;
+export using ::ADLUtil_ASICMatch;
+export using ::ADLUtil_Backend;
+export using ::ADLUtil_ASICClass;
+export using ::ADLUtil_ASICDatabase;
+export using ::ADLUTIL_AMD_VENDOR_ID;
+export using ::ADLUTIL_ASIC_ANY_REVISION;
+
+export using ::ADLUtil_Result;
+export using ::ADL_RESULT_NONE;
+export using ::ADL_SUCCESS;
+export using ::ADL_NOT_FOUND;
+export using ::ADL_MISSING_ENTRYPOINTS;
+export using ::ADL_INITIALIZATION_FAILED;
+export using ::ADL_GET_ADAPTER_COUNT_FAILED;
+export using ::ADL_GET_ADAPTER_INFO_FAILED;
+export using ::ADL_GRAPHICS_VERSIONS_GET_FAILED;
+export using ::ADL_WARNING;
+export using ::ADL_STALE;
+export using ::ADL_TIMED_OUT;
+export using ::ADL_LEASES_HELD;
+
+export using ::ADLUtil_UDIDParseResult;
+export using ::ADL_UDID_OK;
+export using ::ADL_UDID_MISSING_VENDOR;
+export using ::ADL_UDID_MISSING_DEVICE;
+export using ::ADL_UDID_MISSING_REVISION;
+export using ::ADL_UDID_MALFORMED_FIELD;
+
+export using ::operator==;
+export using ::operator!=;
+export using ::operator<;
+export using ::operator<=;
+export using ::operator>;
+export using ::operator>=;
+
+export using ::ADLUtil_ParseUDID;
+export using ::ADLUtil_DiffAsicInfoLists;
+
+export using ::AsicInfoListCallback;
+export using ::ADLVersionsInfoCallback;
+export using ::AdapterChangesCallback;
+
+export using ::ADLUtil_PrefetchAsync;
+export using ::ADLUtil_GetAsicInfoListAsync;
+export using ::ADLUtil_GetADLVersionsInfoAsync;
+export using ::ADLUtil_Subscribe;
+export using ::ADLUtil_Unsubscribe;
+
+export using ::AMDTADLUtils;
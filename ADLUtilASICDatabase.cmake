@@ -0,0 +1,88 @@
+## Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+# Compiles ADLUtilASICDatabase.csv into the ADLUTIL_ASIC rows included by ADLUtilASICDatabase.h.
+# Usage: cmake -DINPUT=<csv> -DOUTPUT=<inl> -P ADLUtilASICDatabase.cmake
+
+cmake_minimum_required(VERSION 3.25)
+
+if (NOT INPUT OR NOT OUTPUT)
+    message(FATAL_ERROR "usage: cmake -DINPUT=<csv> -DOUTPUT=<inl> -P ADLUtilASICDatabase.cmake")
+endif()
+
+# must match the enumerators of ADLUtil_ASICGeneration in ADLUtilTypes.h
+set(GENERATIONS GCN1 GCN2 GCN3 GCN4 GCN5 RDNA1 RDNA2 RDNA3 RDNA3_5 RDNA4 CDNA1 CDNA2 CDNA3)
+
+file(STRINGS "${INPUT}" LINES ENCODING UTF-8)
+
+set(ROWS "")
+set(KEYS "")
+set(LINE_NUMBER 0)
+set(HEADER_SEEN FALSE)
+
+foreach (LINE IN LISTS LINES)
+    math(EXPR LINE_NUMBER "${LINE_NUMBER} + 1")
+    string(STRIP "${LINE}" LINE)
+
+    if (LINE STREQUAL "" OR LINE MATCHES "^#")
+        continue()
+    endif()
+
+    if (NOT HEADER_SEEN)
+        if (NOT LINE STREQUAL "device_id,rev_id,generation,family")
+            message(FATAL_ERROR "${INPUT}:${LINE_NUMBER}: expected the header device_id,rev_id,generation,family")
+        endif()
+
+        set(HEADER_SEEN TRUE)
+        continue()
+    endif()
+
+    if (NOT LINE MATCHES "^([0-9A-Fa-f][0-9A-Fa-f][0-9A-Fa-f][0-9A-Fa-f]),([0-9A-Fa-f][0-9A-Fa-f]?|\\*),([A-Z0-9_]+),([^,\"\\\\]+)$")
+        message(FATAL_ERROR "${INPUT}:${LINE_NUMBER}: expected <device_id>,<rev_id>,<generation>,<family>: ${LINE}")
+    endif()
+
+    string(TOUPPER "${CMAKE_MATCH_1}" DEVICE_ID)
+    string(TOUPPER "${CMAKE_MATCH_2}" REV_ID)
+    set(GENERATION "${CMAKE_MATCH_3}")
+    string(STRIP "${CMAKE_MATCH_4}" FAMILY)
+
+    if (NOT GENERATION IN_LIST GENERATIONS)
+        message(FATAL_ERROR "${INPUT}:${LINE_NUMBER}: unknown generation ${GENERATION}")
+    endif()
+
+    # ADLUtil_FamilyString holds 31 characters
+    string(LENGTH "${FAMILY}" FAMILY_LENGTH)
+
+    if (FAMILY_LENGTH GREATER 31)
+        message(FATAL_ERROR "${INPUT}:${LINE_NUMBER}: family ${FAMILY} is longer than 31 characters")
+    endif()
+
+    if (REV_ID STREQUAL "*")
+        set(REV_ID "ADLUTIL_ASIC_ANY_REVISION")
+    else()
+        set(REV_ID "0x${REV_ID}")
+    endif()
+
+    # duplicates are also caught by a static_assert, but this names the line
+    set(KEY "${DEVICE_ID}:${REV_ID}")
+
+    if (KEY IN_LIST KEYS)
+        message(FATAL_ERROR "${INPUT}:${LINE_NUMBER}: device ${DEVICE_ID} revision ${CMAKE_MATCH_2} is listed twice")
+    endif()
+
+    list(APPEND KEYS "${KEY}")
+    string(APPEND ROWS "ADLUTIL_ASIC(0x${DEVICE_ID}, ${REV_ID}, ${GENERATION}, \"${FAMILY}\")\n")
+endforeach()
+
+if (ROWS STREQUAL "")
+    message(FATAL_ERROR "${INPUT}: no devices")
+endif()
+
+# only touch the output when it changes, so that editing comments in the data file does not rebuild everything
+set(CONTENT "// Generated from ADLUtilASICDatabase.csv by ADLUtilASICDatabase.cmake, do not edit.\n${ROWS}")
+
+if (EXISTS "${OUTPUT}")
+    file(READ "${OUTPUT}" OLD_CONTENT)
+endif()
+
+if (NOT "${OLD_CONTENT}" STREQUAL "${CONTENT}")
+    file(WRITE "${OUTPUT}" "${CONTENT}")
+endif()
@@ -0,0 +1,256 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Compile-time database of the architecture generation and family of AMD GPUs.
+//==============================================================================
+
+#ifndef _ADL_UTIL_ASIC_DATABASE_H_
+#define _ADL_UTIL_ASIC_DATABASE_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "ADLUtilTypes.h"
+
+/// PCI vendor ID of AMD
+constexpr int ADLUTIL_AMD_VENDOR_ID = 0x1002;
+
+/// Revision ID of database rows that match every revision of their device
+constexpr int ADLUTIL_ASIC_ANY_REVISION = -1;
+
+/// Result of a device database lookup
+struct ADLUtil_ASICClass
+{
+    ADLUtil_ASICGeneration generation; ///< the architecture generation
+    ADLUtil_ASICMatch      match;      ///< how the device was matched
+    std::string_view       family;     ///< the ASIC family, empty unless match is Exact or Device
+};
+
+//------------------------------------------------------------------------------------
+/// Rows of ADLUtilASICDatabase.csv and the compile-time construction of the perfect hash over
+/// them. Kept apart from ADLUtil_ASICDatabase so that the table can be built in a constant
+/// expression inside that class.
+//------------------------------------------------------------------------------------
+class ADLUtil_ASICDatabaseTable
+{
+protected:
+    /// One row of ADLUtilASICDatabase.csv
+    struct Row
+    {
+        int                    deviceID;   ///< the PCI device ID
+        int                    revID;      ///< the PCI revision ID, or ADLUTIL_ASIC_ANY_REVISION
+        ADLUtil_ASICGeneration generation; ///< the architecture generation
+        std::string_view       family;     ///< the ASIC family
+    };
+
+    static constexpr size_t s_rowCount = 0
+#define ADLUTIL_ASIC(deviceID, revID, generation, family) + 1
+#include "ADLUtilASICDatabase.inl"
+#undef ADLUTIL_ASIC
+        ;
+
+    static_assert(0 < s_rowCount && 0xFF > s_rowCount, "row indices must fit the uint8_t hash slots, with one value left for empty slots");
+
+    /// log2 of the number of hash slots. With 16 or more slots per row a collision-free seed is found within a few dozen attempts.
+    static constexpr uint32_t s_slotBits = 12;
+    static constexpr size_t   s_slotCount = size_t(1) << s_slotBits;
+
+    static_assert(16 * s_rowCount <= s_slotCount, "the database outgrew the hash table, increase s_slotBits");
+
+    /// Key that no row has
+    static constexpr uint32_t s_noKey = 0xFFFFFFFF;
+
+    /// The rows, the perfect hash over them and the rows ordered by device ID. rows has one extra, empty row that empty slots refer to.
+    struct Table
+    {
+        std::array<Row, s_rowCount + 1>      rows;       ///< the rows of the data file, followed by an empty row
+        std::array<uint32_t, s_rowCount + 1> keys;       ///< MakeKey of each row, s_noKey for the empty row
+        std::array<uint8_t, s_slotCount>     slots;      ///< index into rows per hash slot, s_rowCount if the slot is empty
+        std::array<uint8_t, s_rowCount>      byDeviceID; ///< indices into rows ordered by device ID
+        uint32_t                             seed;       ///< hash seed without collisions, 0 if none was found
+    };
+
+    /// @returns the hash key of a device and revision.
+    static constexpr uint32_t MakeKey(int deviceID, int revID)
+    {
+        return (static_cast<uint32_t>(deviceID) << 16) | (static_cast<uint32_t>(revID) & 0xFFFF);
+    }
+
+    /// @returns the hash slot of a key.
+    static constexpr uint32_t Slot(uint32_t key, uint32_t seed)
+    {
+        key ^= key >> 16;
+        key *= seed;
+        key ^= key >> 15;
+        return key >> (32 - s_slotBits);
+    }
+
+    /// Builds the table from the rows of the data file
+    static constexpr Table Build()
+    {
+        Table table = {};
+        size_t count = 0;
+
+#define ADLUTIL_ASIC(deviceID, revID, generation, family) \
+        table.rows[count] = Row{deviceID, revID, ADLUtil_ASICGeneration::generation, family}; \
+        table.keys[count] = MakeKey(deviceID, revID); \
+        ++count;
+#include "ADLUtilASICDatabase.inl"
+#undef ADLUTIL_ASIC
+
+        table.rows[s_rowCount] = Row{0, ADLUTIL_ASIC_ANY_REVISION, ADLUtil_ASICGeneration::Unknown, {}};
+        table.keys[s_rowCount] = s_noKey;
+
+        // odd multipliers taken from a Weyl sequence; duplicate keys collide under every seed and leave seed at 0
+        table.seed = 0;
+
+        for (uint32_t attempt = 0, seed = 0x9E3779B1u; 0 == table.seed && 1024 > attempt; ++attempt, seed += 0x6A09E668u)
+        {
+            for (uint8_t& slot : table.slots)
+            {
+                slot = static_cast<uint8_t>(s_rowCount);
+            }
+
+            bool isPerfect = true;
+
+            for (size_t row = 0; row < s_rowCount && isPerfect; ++row)
+            {
+                uint8_t& slot = table.slots[Slot(table.keys[row], seed)];
+                isPerfect = static_cast<uint8_t>(s_rowCount) == slot;
+                slot = static_cast<uint8_t>(row);
+            }
+
+            table.seed = isPerfect ? seed : 0;
+        }
+
+        // insertion sort, the table is small and this runs once at compile time
+        for (size_t i = 0; i < s_rowCount; ++i)
+        {
+            size_t j = i;
+
+            for (; 0 < j && table.rows[table.byDeviceID[j - 1]].deviceID > table.rows[i].deviceID; --j)
+            {
+                table.byDeviceID[j] = table.byDeviceID[j - 1];
+            }
+
+            table.byDeviceID[j] = static_cast<uint8_t>(i);
+        }
+
+        return table;
+    }
+};
+
+//------------------------------------------------------------------------------------
+/// Device database compiled from ADLUtilASICDatabase.csv. Lookups go through a perfect hash
+/// of (deviceID, revID) that is built at compile time, so they neither allocate nor compare
+/// strings, take a fixed number of probes and can be evaluated in constant expressions, ie
+/// static_assert(ADLUtil_ASICDatabase::Lookup(0x73BF, 0xC1).generation == ADLUtil_ASICGeneration::RDNA2);
+//------------------------------------------------------------------------------------
+class ADLUtil_ASICDatabase : private ADLUtil_ASICDatabaseTable
+{
+public:
+    /// Looks a device up. A row for the device and revision wins over a row for all revisions of the device.
+    /// A device that is not listed gets the generation of the listed device with the closest ID, preferring the lower one on a tie.
+    /// @param[in] deviceID the PCI device ID
+    /// @param[in] revID    the PCI revision ID, or ADLUTIL_ASIC_ANY_REVISION
+    /// @returns   the generation and family of the device, Unknown if deviceID is not a valid device ID.
+    static constexpr ADLUtil_ASICClass Lookup(int deviceID, int revID)
+    {
+        if (0 >= deviceID || 0xFFFF <= deviceID)
+        {
+            return {ADLUtil_ASICGeneration::Unknown, ADLUtil_ASICMatch::None, {}};
+        }
+
+        // probe both keys unconditionally and select, rather than branching on the first probe
+        bool     isRevision = 0 <= revID && 0xFF >= revID;
+        uint32_t exact = Find(isRevision ? MakeKey(deviceID, revID) : s_noKey);
+        uint32_t device = Find(MakeKey(deviceID, ADLUTIL_ASIC_ANY_REVISION));
+
+        if (s_rowCount != exact || s_rowCount != device)
+        {
+            const Row& row = s_table.rows[(s_rowCount != exact) ? exact : device];
+            return {row.generation, (s_rowCount != exact) ? ADLUtil_ASICMatch::Exact : ADLUtil_ASICMatch::Device, row.family};
+        }
+
+        return {s_table.rows[FindNearest(deviceID)].generation, ADLUtil_ASICMatch::Nearest, {}};
+    }
+
+    /// Resolves the generation, match and family of an ASIC from its vendor, device and revision IDs. Non-AMD ASICs are left Unknown.
+    /// @param[in,out] asicInfo the ASIC info to update
+    static void Classify(ADLUtil_ASICInfo& asicInfo)
+    {
+        ADLUtil_ASICClass asicClass = (ADLUTIL_AMD_VENDOR_ID == asicInfo.vendorID) ? Lookup(asicInfo.deviceID, asicInfo.revID) :
+                                                                                      ADLUtil_ASICClass{ADLUtil_ASICGeneration::Unknown, ADLUtil_ASICMatch::None, {}};
+
+        asicInfo.generation = asicClass.generation;
+        asicInfo.asicMatch = asicClass.match;
+        asicInfo.family = asicClass.family;
+    }
+
+    /// @returns the display name of a generation, ie "RDNA 3.5".
+    static constexpr std::string_view GetGenerationName(ADLUtil_ASICGeneration generation)
+    {
+        constexpr std::string_view names[] = {"Unknown", "GCN 1", "GCN 2", "GCN 3", "GCN 4", "GCN 5", "RDNA 1", "RDNA 2", "RDNA 3", "RDNA 3.5", "RDNA 4", "CDNA 1", "CDNA 2", "CDNA 3"};
+        static_assert(sizeof(names) / sizeof(names[0]) == static_cast<size_t>(ADLUtil_ASICGeneration::CDNA3) + 1, "a generation name is missing");
+
+        size_t index = static_cast<size_t>(generation);
+        return (sizeof(names) / sizeof(names[0]) > index) ? names[index] : names[0];
+    }
+
+    /// @returns the number of rows in the database.
+    static constexpr size_t GetRowCount() { return s_rowCount; }
+
+private:
+    /// @returns the index of the row with the key, s_rowCount if there is none.
+    static constexpr uint32_t Find(uint32_t key)
+    {
+        uint32_t row = s_table.slots[Slot(key, s_table.seed)];
+        return (s_table.keys[row] == key) ? row : static_cast<uint32_t>(s_rowCount);
+    }
+
+    /// @returns the index of the row whose device ID is closest to deviceID.
+    static constexpr uint32_t FindNearest(int deviceID)
+    {
+        // first row with a device ID not below deviceID
+        size_t first = 0;
+        size_t count = s_rowCount;
+
+        while (0 < count)
+        {
+            size_t half = count / 2;
+
+            if (s_table.rows[s_table.byDeviceID[first + half]].deviceID < deviceID)
+            {
+                first += half + 1;
+                count -= half + 1;
+            }
+            else
+            {
+                count = half;
+            }
+        }
+
+        if (s_rowCount == first)
+        {
+            return s_table.byDeviceID[s_rowCount - 1];
+        }
+
+        if (0 == first)
+        {
+            return s_table.byDeviceID[0];
+        }
+
+        int above = s_table.rows[s_table.byDeviceID[first]].deviceID - deviceID;
+        int below = deviceID - s_table.rows[s_table.byDeviceID[first - 1]].deviceID;
+        return s_table.byDeviceID[(above < below) ? first : first - 1];
+    }
+
+    static constexpr Table s_table = Build(); ///< the database
+
+    static_assert(0 != s_table.seed, "no perfect hash of the device database was found; check ADLUtilASICDatabase.csv for duplicate rows");
+};
+
+#endif //_ADL_UTIL_ASIC_DATABASE_H_
@@ -0,0 +1,57 @@
+//==============================================================================
+// Copyright (c) 2011-2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Asynchronous getters and adapter change subscriptions of the AMDTADLUtils singleton.
+///         Kept out of ADLUtil.h so that code that only reads the cached ADLUtil data does not pay for <future>.
+//==============================================================================
+
+#ifndef _ADL_UTIL_ASYNC_H_
+#define _ADL_UTIL_ASYNC_H_
+
+#include <cstdint>
+#include <functional>
+#include <future>
+
+#include "ADLUtil.h"
+
+/// Callback invoked with the result of an asynchronous AsicInfoList query
+typedef std::function<void(ADLUtil_Result result, const AsicInfoListSnapshot& asicInfoList)> AsicInfoListCallback;
+
+/// Callback invoked with the result of an asynchronous ADL version query
+typedef std::function<void(ADLUtil_Result result, const ADLVersionsInfo& adlVersionInfo)> ADLVersionsInfoCallback;
+
+/// Callback invoked with the changes of a new adapter generation
+typedef std::function<void(const ADLUtil_AdapterChanges& changes)> AdapterChangesCallback;
+
+/// Starts loading ADL and filling the AsicInfoList and version caches on a background thread.
+/// Synchronous getters called while the prefetch is running wait for it rather than repeating the work.
+/// Calling this again while a prefetch is in flight, or after it completed, returns the same future.
+/// If both caches are already filled no thread is started and the returned future is ready.
+/// @returns a future holding the combined ADLUtil_Result of the prefetched queries.
+std::shared_future<ADLUtil_Result> ADLUtil_PrefetchAsync();
+
+/// Asynchronous variant of AMDTADLUtils::GetAsicInfoList. If the cache is already filled the callback runs on the calling thread.
+/// Otherwise the query and the callback run on a background thread.
+/// @param[in] callback optional callback receiving the result and the AsicInfoList snapshot
+/// @returns   a future holding the ADLUtil_Result of the query
+std::future<ADLUtil_Result> ADLUtil_GetAsicInfoListAsync(AsicInfoListCallback callback = nullptr);
+
+/// Asynchronous variant of AMDTADLUtils::GetADLVersionsInfo. If the cache is already filled the callback runs on the calling thread.
+/// Otherwise the query and the callback run on a background thread.
+/// @param[in] callback optional callback receiving the result and the Catalyst version info
+/// @returns   a future holding the ADLUtil_Result of the query
+std::future<ADLUtil_Result> ADLUtil_GetADLVersionsInfoAsync(ADLVersionsInfoCallback callback = nullptr);
+
+/// Registers a callback that is invoked on the publishing thread whenever a new adapter generation is published,
+/// by the first enumeration, AMDTADLUtils::Refresh or the persistent cache revalidation. Callbacks of successive
+/// generations never overlap. Callbacks must not call AMDTADLUtils::Reset or AMDTADLUtils::Refresh.
+/// @param[in] callback the callback
+/// @returns   the ID to pass to ADLUtil_Unsubscribe.
+uint64_t ADLUtil_Subscribe(AdapterChangesCallback callback);
+
+/// Unregisters a callback. A notification already in progress may still invoke it.
+/// @param[in] subscriptionID the ID returned by ADLUtil_Subscribe
+void ADLUtil_Unsubscribe(uint64_t subscriptionID);
+
+#endif //_ADL_UTIL_ASYNC_H_
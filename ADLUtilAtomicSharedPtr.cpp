@@ -0,0 +1,119 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Publication of immutable shared data through an atomic pointer, with lock-free reads.
+//==============================================================================
+
+#include "ADLUtilAtomicSharedPtr.h"
+
+// Registry of the hazard records of the live threads. Only the first read of a thread, its exit and the stores lock it.
+static std::mutex            s_hazardRecordsMutex;
+static ADLUtil_HazardRecord* s_pHazardRecords = nullptr; // head of the list, protected by s_hazardRecordsMutex
+static size_t                s_hazardRecordCount = 0;    // records in the list, protected by s_hazardRecordsMutex
+
+// The record of the calling thread. It is trivially initialized, so the read path pays no thread_local initialization check.
+static thread_local ADLUtil_HazardRecord* t_pHazardRecord = nullptr;
+
+// Set once the thread began destroying its thread_local objects, after which t_releaser must not be touched again
+static thread_local bool t_isExiting = false;
+
+// Removes the record of a thread from the registry and frees it when the thread exits
+class HazardRecordReleaser
+{
+public:
+    /// Makes sure the releaser is constructed, and so destroyed when the thread exits
+    void Arm() {}
+
+    ~HazardRecordReleaser()
+    {
+        t_isExiting = true;
+
+        if (nullptr != t_pHazardRecord)
+        {
+            // the thread cannot be reading anymore, so its hazards are already cleared
+            {
+                std::lock_guard<std::mutex> lock(s_hazardRecordsMutex);
+
+                if (nullptr != t_pHazardRecord->pPrev)
+                {
+                    t_pHazardRecord->pPrev->pNext = t_pHazardRecord->pNext;
+                }
+                else
+                {
+                    s_pHazardRecords = t_pHazardRecord->pNext;
+                }
+
+                if (nullptr != t_pHazardRecord->pNext)
+                {
+                    t_pHazardRecord->pNext->pPrev = t_pHazardRecord->pPrev;
+                }
+
+                --s_hazardRecordCount;
+            }
+
+            delete t_pHazardRecord;
+            t_pHazardRecord = nullptr;
+        }
+    }
+};
+
+static thread_local HazardRecordReleaser t_releaser;
+
+ADLUtil_HazardRecord* ADLUtil_GetThreadHazardRecord()
+{
+    // a thread that reads while it destroys its thread_local objects gets no record, and its readers take the locked path
+    if (nullptr == t_pHazardRecord && !t_isExiting)
+    {
+        ADLUtil_HazardRecord* pRecord = new ADLUtil_HazardRecord();
+
+        {
+            std::lock_guard<std::mutex> lock(s_hazardRecordsMutex);
+            pRecord->pNext = s_pHazardRecords;
+
+            if (nullptr != s_pHazardRecords)
+            {
+                s_pHazardRecords->pPrev = pRecord;
+            }
+
+            s_pHazardRecords = pRecord;
+            ++s_hazardRecordCount;
+        }
+
+        t_pHazardRecord = pRecord;
+        t_releaser.Arm();
+    }
+
+    return t_pHazardRecord;
+}
+
+size_t ADLUtil_GetHazardRecordCount()
+{
+    std::lock_guard<std::mutex> lock(s_hazardRecordsMutex);
+    return s_hazardRecordCount;
+}
+
+void ADLUtil_CollectHazards(std::vector<const void*>& hazards)
+{
+    hazards.clear();
+
+    {
+        // the lock keeps exiting threads from freeing their records while they are walked
+        std::lock_guard<std::mutex> lock(s_hazardRecordsMutex);
+
+        for (ADLUtil_HazardRecord* pRecord = s_pHazardRecords; nullptr != pRecord; pRecord = pRecord->pNext)
+        {
+            for (std::atomic<const void*>& hazard : pRecord->hazards)
+            {
+                const void* pHazard = hazard.load(std::memory_order_seq_cst);
+
+                if (nullptr != pHazard)
+                {
+                    hazards.push_back(pHazard);
+                }
+            }
+        }
+    }
+
+    std::sort(hazards.begin(), hazards.end());
+}
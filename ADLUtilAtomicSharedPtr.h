@@ -0,0 +1,239 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Publication of immutable shared data through an atomic pointer, with lock-free reads.
+//==============================================================================
+
+#ifndef _ADL_UTIL_ATOMIC_SHARED_PTR_H_
+#define _ADL_UTIL_ATOMIC_SHARED_PTR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/// Number of published objects one thread can read lock-free at the same time, ie through nested ADLUtil_AtomicSharedPtr::Reader
+/// scopes. Readers nested deeper take a lock instead.
+constexpr uint32_t ADLUTIL_HAZARDS_PER_THREAD = 4;
+
+/// The hazard pointers of one thread: the published objects it is reading, which must not be freed yet.
+/// A record is added to the registry by the first read of its thread and freed when the thread exits.
+struct ADLUtil_HazardRecord
+{
+    alignas(64) std::atomic<const void*> hazards[ADLUTIL_HAZARDS_PER_THREAD] = {}; ///< the objects being read, nullptr for an unused entry
+    uint32_t                             depth = 0;                                ///< entries in use, only accessed by the owning thread
+    ADLUtil_HazardRecord*                pPrev = nullptr;                          ///< previous record of the registry, protected by its mutex
+    ADLUtil_HazardRecord*                pNext = nullptr;                          ///< next record of the registry, protected by its mutex
+};
+
+/// @returns the hazard record of the calling thread, adding one on first use, or nullptr while the thread destroys its
+///          thread_local objects.
+ADLUtil_HazardRecord* ADLUtil_GetThreadHazardRecord();
+
+/// @returns the number of hazard records, one per live thread that has read an ADLUtil_AtomicSharedPtr.
+size_t ADLUtil_GetHazardRecordCount();
+
+/// Collects the objects all threads are reading
+/// @param[out] hazards receives the hazard pointers of every thread, sorted
+void ADLUtil_CollectHazards(std::vector<const void*>& hazards);
+
+//------------------------------------------------------------------------------------
+/// A std::shared_ptr<const T> that can be loaded and stored concurrently, like std::atomic<std::shared_ptr<const T>>,
+/// but whose loads never lock. std::atomic_load on a shared_ptr and the C++20 atomic shared_ptr both lock internally,
+/// in a mutex pool or a spinlock, which serializes the readers of a value published to many threads.
+///
+/// The shared_ptr is held in a node published through a std::atomic pointer. A reader announces the node in a hazard
+/// pointer of its thread before it dereferences it, so a store never frees a node that is being read; replaced nodes
+/// are retired and freed by a later store once no thread announces them. Reading takes two atomic stores and two loads
+/// on cache lines no other reader writes, plus the reference count increment when a shared_ptr is copied out.
+/// A reader that finds no free hazard pointer, because it is nested more than ADLUTIL_HAZARDS_PER_THREAD deep or its
+/// thread is exiting, copies the shared_ptr under the store mutex instead.
+/// Stores serialize on a mutex and are expected to be rare compared to loads.
+///
+/// @tparam T the type of the published object
+//------------------------------------------------------------------------------------
+template <typename T>
+class ADLUtil_AtomicSharedPtr
+{
+    /// A published value
+    struct Node
+    {
+        std::shared_ptr<const T> value; ///< the value
+    };
+
+public:
+    typedef std::shared_ptr<const T> ValuePtr; ///< a published value
+
+    //------------------------------------------------------------------------------------
+    /// Reads the published value without copying the shared_ptr. The value stays valid until the reader is destroyed,
+    /// even if a new value is stored meanwhile. Readers of one thread must be destroyed in reverse order of construction.
+    //------------------------------------------------------------------------------------
+    class Reader
+    {
+    public:
+        /// constructor, announces the published node and keeps it from being freed
+        /// @param[in] atomicSharedPtr the pointer to read
+        explicit Reader(const ADLUtil_AtomicSharedPtr& atomicSharedPtr) :
+            m_pRecord(ADLUtil_GetThreadHazardRecord()),
+            m_pNode(nullptr)
+        {
+            if (nullptr == m_pRecord || ADLUTIL_HAZARDS_PER_THREAD <= m_pRecord->depth)
+            {
+                // no hazard pointer to announce the node in: hold a reference to the value, taken while no store can free it
+                m_pRecord = nullptr;
+
+                std::lock_guard<std::mutex> lock(atomicSharedPtr.m_storeMutex);
+                const Node* pNode = atomicSharedPtr.m_pNode.load(std::memory_order_relaxed);
+                m_heldValue = (nullptr != pNode) ? pNode->value : nullptr;
+                return;
+            }
+
+            std::atomic<const void*>& hazard = m_pRecord->hazards[m_pRecord->depth++];
+
+            m_pNode = atomicSharedPtr.m_pNode.load(std::memory_order_acquire);
+
+            // announce the node, then check that it is still published; a store that replaced it before the announcement
+            // became visible may have freed it already
+            for (;;)
+            {
+                hazard.store(m_pNode, std::memory_order_seq_cst);
+                const Node* pPublished = atomicSharedPtr.m_pNode.load(std::memory_order_seq_cst);
+
+                if (pPublished == m_pNode)
+                {
+                    break;
+                }
+
+                m_pNode = pPublished;
+            }
+        }
+
+        /// destructor, releases the node
+        ~Reader()
+        {
+            if (nullptr != m_pRecord)
+            {
+                m_pRecord->hazards[--m_pRecord->depth].store(nullptr, std::memory_order_release);
+            }
+        }
+
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        /// @returns the published object, nullptr if none is published.
+        const T* Get() const { return (nullptr != m_pNode) ? m_pNode->value.get() : m_heldValue.get(); }
+
+        /// @returns the published shared_ptr, empty if none is published; copy it to keep the object beyond the reader.
+        const ValuePtr& GetShared() const { return (nullptr != m_pNode) ? m_pNode->value : m_heldValue; }
+
+    private:
+        ADLUtil_HazardRecord* m_pRecord;   ///< hazard record of the reading thread, nullptr if the reader holds m_heldValue
+        const Node*           m_pNode;     ///< the node read, nullptr if nothing is published or the reader holds m_heldValue
+        ValuePtr              m_heldValue; ///< the value read without a hazard pointer
+    };
+
+    /// constructor
+    /// @param[in] value the initial value
+    explicit ADLUtil_AtomicSharedPtr(ValuePtr value = nullptr) :
+        m_pNode(MakeNode(std::move(value)))
+    {
+    }
+
+    /// destructor, frees the published and the retired nodes. No thread may read the pointer anymore.
+    ~ADLUtil_AtomicSharedPtr()
+    {
+        delete m_pNode.load(std::memory_order_relaxed);
+
+        for (const Node* pNode : m_retiredNodes)
+        {
+            delete pNode;
+        }
+    }
+
+    ADLUtil_AtomicSharedPtr(const ADLUtil_AtomicSharedPtr&) = delete;
+    ADLUtil_AtomicSharedPtr& operator=(const ADLUtil_AtomicSharedPtr&) = delete;
+
+    /// @returns a copy of the published shared_ptr.
+    ValuePtr Load() const
+    {
+        Reader reader(*this);
+        return reader.GetShared();
+    }
+
+    /// Publishes a value, replacing the current one
+    /// @param[in] value the value
+    void Store(ValuePtr value)
+    {
+        std::lock_guard<std::mutex> lock(m_storeMutex);
+        Publish(MakeNode(std::move(value)));
+    }
+
+    /// Publishes a value if the published one is still the expected one
+    /// @param[in,out] expected the value expected to be published; receives the published value if it is another one
+    /// @param[in]     desired  the value to publish
+    /// @returns       true if desired was published.
+    bool CompareExchange(ValuePtr& expected, ValuePtr desired)
+    {
+        std::lock_guard<std::mutex> lock(m_storeMutex);
+        const Node* pNode = m_pNode.load(std::memory_order_relaxed);
+        const T*    pPublished = (nullptr != pNode) ? pNode->value.get() : nullptr;
+
+        if (pPublished != expected.get())
+        {
+            expected = (nullptr != pNode) ? pNode->value : nullptr;
+            return false;
+        }
+
+        Publish(MakeNode(std::move(desired)));
+        return true;
+    }
+
+private:
+    /// @returns a node holding value, nullptr for an empty value so that clearing does not allocate.
+    static const Node* MakeNode(ValuePtr value)
+    {
+        return (nullptr != value) ? new Node{std::move(value)} : nullptr;
+    }
+
+    /// Publishes a node and retires the one it replaces. Called with m_storeMutex held.
+    /// @param[in] pNode the node to publish
+    void Publish(const Node* pNode)
+    {
+        const Node* pRetired = m_pNode.exchange(pNode, std::memory_order_seq_cst);
+
+        if (nullptr != pRetired)
+        {
+            m_retiredNodes.push_back(pRetired);
+        }
+
+        // free the retired nodes no thread is reading; the others wait for a later store
+        std::vector<const void*> hazards;
+        ADLUtil_CollectHazards(hazards);
+
+        size_t keptCount = 0;
+
+        for (const Node* pRetiredNode : m_retiredNodes)
+        {
+            if (std::binary_search(hazards.begin(), hazards.end(), static_cast<const void*>(pRetiredNode)))
+            {
+                m_retiredNodes[keptCount++] = pRetiredNode;
+            }
+            else
+            {
+                delete pRetiredNode;
+            }
+        }
+
+        m_retiredNodes.resize(keptCount);
+    }
+
+    std::atomic<const Node*> m_pNode;        ///< the published node, nullptr if nothing is published
+    mutable std::mutex       m_storeMutex;   ///< serializes the stores, and the readers that find no free hazard pointer
+    std::vector<const Node*> m_retiredNodes; ///< replaced nodes that were being read when they were replaced, protected by m_storeMutex
+};
+
+#endif //_ADL_UTIL_ATOMIC_SHARED_PTR_H_
@@ -0,0 +1,249 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  C interface to the cached ADLUtil data, for callers that cannot allocate or use C++.
+//==============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "ADLUtilCAPI.h"
+#include "ADLUtil.h"
+#include "ADLUtilAsync.h"
+
+static_assert(sizeof(ADLUtil_AdapterRecord) == 40 + 24 + 8 * 16 + 16 + 32 + 4 * ADLUTIL_RECORD_MAX_STRING, "ADLUtil_AdapterRecord layout changed, increment ADLUTIL_RECORD_ABI_VERSION");
+static_assert(sizeof(ADLUtil_DriverVersionRecord) == 28 + 3 * ADLUTIL_RECORD_MAX_STRING, "ADLUtil_DriverVersionRecord layout changed, increment ADLUTIL_RECORD_ABI_VERSION");
+
+/// The records of one enumeration. Immutable once published.
+struct RecordSnapshot
+{
+    int32_t                                  asicInfoResult; ///< the ADLUtil_Result of the enumeration
+    int32_t                                  versionsResult; ///< the ADLUtil_Result of the version query
+    uint32_t                                 adapterCount;   ///< number of entries in adapters
+    std::unique_ptr<ADLUtil_AdapterRecord[]> adapters;       ///< the adapter records
+    ADLUtil_DriverVersionRecord              driverVersion;  ///< the driver version record
+};
+
+// The published records. A new snapshot is only published when the data changed. The getters, which may run in a signal
+// handler, count themselves in s_activeReaders around their use of a snapshot; a replaced snapshot is retired and freed
+// by a later publish that finds no reader active, since any reader arriving after that sees the current snapshot.
+static std::atomic<const RecordSnapshot*>           s_pRecordSnapshot{nullptr};
+static std::atomic<uint32_t>                        s_activeReaders{0};
+static std::mutex                                   s_recordMutex;         // serializes publishing and protects the members below
+static std::unique_ptr<RecordSnapshot>              s_publishedSnapshot;   // owns the snapshot s_pRecordSnapshot points to
+static std::vector<std::unique_ptr<RecordSnapshot>> s_retiredSnapshots;    // replaced snapshots a reader may still be copying
+static bool                                         s_isSubscribed = false;
+
+static_assert(std::atomic<const RecordSnapshot*>::is_always_lock_free, "the record getters must be async-signal-safe");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "the record getters must be async-signal-safe");
+
+/// Counts a getter as a reader of the published snapshot for as long as it lives. Only atomic operations, so that it
+/// is async-signal-safe.
+class RecordReader
+{
+public:
+    /// constructor, registers the reader before it loads the snapshot
+    RecordReader() { s_activeReaders.fetch_add(1); }
+
+    /// destructor, unregisters the reader once it is done with the snapshot
+    ~RecordReader() { s_activeReaders.fetch_sub(1); }
+
+    RecordReader(const RecordReader&) = delete;
+    RecordReader& operator=(const RecordReader&) = delete;
+
+    /// @returns the published snapshot, nullptr before the first publish.
+    const RecordSnapshot* GetSnapshot() const { return s_pRecordSnapshot.load(); }
+};
+
+/// Copies a string into a fixed-size field, truncating it and terminating it with NUL
+/// @param[out] pDest    the field
+/// @param[in]  destSize the size of the field
+/// @param[in]  str      the string
+static void CopyRecordString(char* pDest, size_t destSize, std::string_view str)
+{
+    size_t length = std::min(str.size(), destSize - 1);
+    memcpy(pDest, str.data(), length);
+    memset(pDest + length, '\0', destSize - length);
+}
+
+/// Queries AMDTADLUtils and publishes its data as a new snapshot if it differs from the published one
+/// @returns the ADLUtil_Result of the enumeration.
+static int PublishRecords()
+{
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+
+    std::unique_ptr<RecordSnapshot> snapshot(new RecordSnapshot());
+
+    AsicInfoListSnapshot asicInfoList;
+    snapshot->asicInfoResult = pADLUtils->GetAsicInfoList(asicInfoList);
+    snapshot->adapterCount = static_cast<uint32_t>(asicInfoList->size());
+    snapshot->adapters.reset(new ADLUtil_AdapterRecord[snapshot->adapterCount]);
+
+    for (uint32_t i = 0; i < snapshot->adapterCount; ++i)
+    {
+        const ADLUtil_ASICInfo& asicInfo = (*asicInfoList)[i];
+        ADLUtil_AdapterRecord&  record = snapshot->adapters[i];
+
+        // zero the padding as well, so that snapshots compare with memcmp
+        memset(&record, 0, sizeof(record));
+        record.vendorID = asicInfo.vendorID;
+        record.deviceID = asicInfo.deviceID;
+        record.revID = asicInfo.revID;
+        record.subsystemID = asicInfo.subsystemID;
+        record.busNumber = asicInfo.busNumber;
+        record.deviceNumber = asicInfo.deviceNumber;
+        record.functionNumber = asicInfo.functionNumber;
+        record.gpuIndex = asicInfo.gpuIndex;
+        record.adapterIndex = asicInfo.adapterIndex;
+        record.generation = static_cast<uint8_t>(asicInfo.generation);
+        record.asicMatch = static_cast<uint8_t>(asicInfo.asicMatch);
+        record.pciDomain = asicInfo.topology.pciDomain;
+        record.linkSpeedMTs = asicInfo.topology.linkSpeedMTs;
+        record.linkWidth = asicInfo.topology.linkWidth;
+        record.maxLinkSpeedMTs = asicInfo.topology.maxLinkSpeedMTs;
+        record.maxLinkWidth = asicInfo.topology.maxLinkWidth;
+        record.numaNode = asicInfo.topology.numaNode;
+
+        for (uint32_t cpu : asicInfo.topology.localCPUs)
+        {
+            if (cpu < 64 * (sizeof(record.localCPUMask) / sizeof(record.localCPUMask[0])))
+            {
+                record.localCPUMask[cpu / 64] |= uint64_t(1) << (cpu % 64);
+            }
+        }
+
+        CopyRecordString(record.deviceIDString, sizeof(record.deviceIDString), asicInfo.deviceIDString);
+        CopyRecordString(record.family, sizeof(record.family), asicInfo.family);
+        CopyRecordString(record.adapterName, sizeof(record.adapterName), asicInfo.adapterName);
+        CopyRecordString(record.udid, sizeof(record.udid), asicInfo.udid);
+        CopyRecordString(record.registryPath, sizeof(record.registryPath), asicInfo.registryPath);
+        CopyRecordString(record.registryPathExt, sizeof(record.registryPathExt), asicInfo.registryPathExt);
+    }
+
+    ADLUtil_VersionsInfo  versionsInfo;
+    ADLUtil_DriverVersion driverVersion;
+    snapshot->versionsResult = pADLUtils->GetVersionsInfo(versionsInfo);
+    pADLUtils->GetDriverVersion(driverVersion);
+
+    ADLUtil_DriverVersionRecord& versionRecord = snapshot->driverVersion;
+    memset(&versionRecord, 0, sizeof(versionRecord));
+    versionRecord.majorVer = driverVersion.majorVer;
+    versionRecord.minorVer = driverVersion.minorVer;
+    versionRecord.subMinorVer = driverVersion.subMinorVer;
+    versionRecord.buildVer = driverVersion.buildVer;
+    versionRecord.buildDate = driverVersion.buildDate;
+    versionRecord.changelist = driverVersion.changelist;
+    versionRecord.buildDateRevision = driverVersion.buildDateRevision;
+    CopyRecordString(versionRecord.driverVersion, sizeof(versionRecord.driverVersion), versionsInfo.driverVersion);
+    CopyRecordString(versionRecord.catalystVersion, sizeof(versionRecord.catalystVersion), versionsInfo.catalystVersion);
+    CopyRecordString(versionRecord.catalystWebLink, sizeof(versionRecord.catalystWebLink), versionsInfo.catalystWebLink);
+
+    std::lock_guard<std::mutex> lock(s_recordMutex);
+    const RecordSnapshot* pPublished = s_pRecordSnapshot.load(std::memory_order_relaxed);
+
+    bool isUnchanged = nullptr != pPublished &&
+                       pPublished->asicInfoResult == snapshot->asicInfoResult &&
+                       pPublished->versionsResult == snapshot->versionsResult &&
+                       pPublished->adapterCount == snapshot->adapterCount &&
+                       0 == memcmp(pPublished->adapters.get(), snapshot->adapters.get(), sizeof(ADLUtil_AdapterRecord) * snapshot->adapterCount) &&
+                       0 == memcmp(&pPublished->driverVersion, &snapshot->driverVersion, sizeof(ADLUtil_DriverVersionRecord));
+
+    if (!isUnchanged)
+    {
+        s_pRecordSnapshot.store(snapshot.get());
+
+        if (nullptr != s_publishedSnapshot)
+        {
+            s_retiredSnapshots.push_back(std::move(s_publishedSnapshot));
+        }
+
+        s_publishedSnapshot = std::move(snapshot);
+    }
+
+    // the counter is read after the store above, so a reader it misses loads the new snapshot
+    if (!s_retiredSnapshots.empty() && 0 == s_activeReaders.load())
+    {
+        s_retiredSnapshots.clear();
+    }
+
+    return s_publishedSnapshot->asicInfoResult;
+}
+
+int ADLUtil_InitRecords(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(s_recordMutex);
+
+        if (!s_isSubscribed)
+        {
+            // the callback runs after the new adapters are published, so PublishRecords reads them from the cache
+            ADLUtil_Subscribe([](const ADLUtil_AdapterChanges&) { PublishRecords(); });
+            s_isSubscribed = true;
+        }
+    }
+
+    return PublishRecords();
+}
+
+ADLUtil_RecordStatus ADLUtil_GetAdapterRecords(ADLUtil_AdapterRecord* pRecords, uint32_t* pCount, int32_t* pQueryResult)
+{
+    if (nullptr == pCount || (nullptr == pRecords && 0 != *pCount))
+    {
+        return ADLUTIL_RECORD_INVALID_ARGUMENT;
+    }
+
+    RecordReader          reader;
+    const RecordSnapshot* pSnapshot = reader.GetSnapshot();
+
+    if (nullptr == pSnapshot)
+    {
+        return ADLUTIL_RECORD_NOT_INITIALIZED;
+    }
+
+    uint32_t copyCount = std::min(*pCount, pSnapshot->adapterCount);
+
+    for (uint32_t i = 0; i < copyCount; ++i)
+    {
+        pRecords[i] = pSnapshot->adapters[i];
+    }
+
+    *pCount = pSnapshot->adapterCount;
+
+    if (nullptr != pQueryResult)
+    {
+        *pQueryResult = pSnapshot->asicInfoResult;
+    }
+
+    return (copyCount < pSnapshot->adapterCount && nullptr != pRecords) ? ADLUTIL_RECORD_MORE_DATA : ADLUTIL_RECORD_OK;
+}
+
+ADLUtil_RecordStatus ADLUtil_GetDriverVersionRecord(ADLUtil_DriverVersionRecord* pRecord, int32_t* pQueryResult)
+{
+    if (nullptr == pRecord)
+    {
+        return ADLUTIL_RECORD_INVALID_ARGUMENT;
+    }
+
+    RecordReader          reader;
+    const RecordSnapshot* pSnapshot = reader.GetSnapshot();
+
+    if (nullptr == pSnapshot)
+    {
+        return ADLUTIL_RECORD_NOT_INITIALIZED;
+    }
+
+    *pRecord = pSnapshot->driverVersion;
+
+    if (nullptr != pQueryResult)
+    {
+        *pQueryResult = pSnapshot->versionsResult;
+    }
+
+    return ADLUTIL_RECORD_OK;
+}
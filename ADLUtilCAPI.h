@@ -0,0 +1,106 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  C interface to the cached ADLUtil data, for callers that cannot allocate or use C++.
+///         The records have a fixed layout and are copied into caller-supplied buffers.
+///         This header can be included from C.
+//==============================================================================
+
+#ifndef _ADL_UTIL_C_API_H_
+#define _ADL_UTIL_C_API_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Version of the record layout, incremented whenever a record changes
+#define ADLUTIL_RECORD_ABI_VERSION 2
+
+/// Size of the string fields of the records, including the terminating NUL
+#define ADLUTIL_RECORD_MAX_STRING 256
+
+/// Status codes of the record functions
+typedef enum ADLUtil_RecordStatus
+{
+    ADLUTIL_RECORD_OK = 0,              ///< the records were copied.
+    ADLUTIL_RECORD_MORE_DATA,           ///< the buffer was too small; it holds the first records and the count holds the number available.
+    ADLUTIL_RECORD_NOT_INITIALIZED,     ///< ADLUtil_InitRecords has not published any records yet.
+    ADLUTIL_RECORD_INVALID_ARGUMENT,    ///< a required pointer was NULL.
+} ADLUtil_RecordStatus;
+
+/// One logical adapter, the fields of ADLUtil_ASICInfo with fixed-size strings. Strings are NUL-terminated and truncated to fit.
+/// The topology fields are only filled where the platform exposes them (Linux sysfs).
+typedef struct ADLUtil_AdapterRecord
+{
+    int32_t  vendorID;                                   ///< the vendor ID
+    int32_t  deviceID;                                   ///< the device ID
+    int32_t  revID;                                      ///< the revision ID
+    uint32_t subsystemID;                                ///< the subsystem ID, subsystem device ID in the high and subsystem vendor ID in the low 16 bits
+    int32_t  busNumber;                                  ///< the PCI bus number
+    int32_t  deviceNumber;                               ///< the PCI device number
+    int32_t  functionNumber;                             ///< the PCI function number
+    uint32_t gpuIndex;                                   ///< GPU index in the system
+    int32_t  adapterIndex;                               ///< the ADL adapter index
+    uint8_t  generation;                                 ///< the ADLUtil_ASICGeneration of the ASIC
+    uint8_t  asicMatch;                                  ///< the ADLUtil_ASICMatch of generation and family
+    uint8_t  reserved[2];                                ///< padding, 0
+    int32_t  pciDomain;                                  ///< the PCI domain (segment)
+    uint32_t linkSpeedMTs;                               ///< current PCIe link speed in MT/s per lane, 0 if unknown
+    uint32_t linkWidth;                                  ///< current number of PCIe lanes, 0 if unknown
+    uint32_t maxLinkSpeedMTs;                            ///< maximum PCIe link speed in MT/s per lane, 0 if unknown
+    uint32_t maxLinkWidth;                               ///< maximum number of PCIe lanes, 0 if unknown
+    int32_t  numaNode;                                   ///< the NUMA node closest to the adapter, -1 if unknown
+    uint64_t localCPUMask[16];                           ///< bit n % 64 of word n / 64 is set if logical CPU n is close to the adapter, CPUs from 1024 on are left out
+    char     deviceIDString[16];                         ///< the device ID as it appears in the UDID
+    char     family[32];                                 ///< ASIC family ie "Navi 21", empty if the device is not in the database
+    char     adapterName[ADLUTIL_RECORD_MAX_STRING];     ///< description of the adapter
+    char     udid[ADLUTIL_RECORD_MAX_STRING];            ///< the ADL unique device ID
+    char     registryPath[ADLUTIL_RECORD_MAX_STRING];    ///< adapter registry path
+    char     registryPathExt[ADLUTIL_RECORD_MAX_STRING]; ///< adapter registry path
+} ADLUtil_AdapterRecord;
+
+/// The parsed driver version together with the version strings reported by ADL
+typedef struct ADLUtil_DriverVersionRecord
+{
+    uint32_t majorVer;                                   ///< the major version number
+    uint32_t minorVer;                                   ///< the minor version number
+    uint32_t subMinorVer;                                ///< the sub-minor version number
+    uint32_t buildVer;                                   ///< the fourth dotted number used by newer drivers, 0 if absent
+    uint32_t buildDate;                                  ///< the build date as the decimal number yymmdd
+    uint32_t changelist;                                 ///< the changelist number
+    char     buildDateRevision;                          ///< the build letter following the build date
+    char     reserved[3];                                ///< padding, 0
+    char     driverVersion[ADLUTIL_RECORD_MAX_STRING];   ///< the driver version string
+    char     catalystVersion[ADLUTIL_RECORD_MAX_STRING]; ///< the Catalyst/Radeon Software version
+    char     catalystWebLink[ADLUTIL_RECORD_MAX_STRING]; ///< the web link to the driver release notes
+} ADLUtil_DriverVersionRecord;
+
+/// Queries the adapters and the driver version through AMDTADLUtils and publishes them as records. Records are
+/// republished automatically when a later enumeration finds different adapters; call this again to pick up a new driver version.
+/// This allocates and may load ADL, so call it during startup rather than from a signal handler.
+/// @returns the ADLUtil_Result of the adapter enumeration.
+int ADLUtil_InitRecords(void);
+
+/// Copies the published adapter records. Call it with pRecords NULL to get the count, then again with a buffer of that size.
+/// Does not allocate, lock or call ADL, and is async-signal-safe.
+/// @param[out]    pRecords     the buffer to fill, may be NULL if *pCount is 0
+/// @param[in,out] pCount       in: the number of records pRecords holds; out: the number of records available
+/// @param[out]    pQueryResult optional, receives the ADLUtil_Result of the enumeration the records come from
+/// @returns       an ADLUtil_RecordStatus.
+ADLUtil_RecordStatus ADLUtil_GetAdapterRecords(ADLUtil_AdapterRecord* pRecords, uint32_t* pCount, int32_t* pQueryResult);
+
+/// Copies the published driver version record.
+/// Does not allocate, lock or call ADL, and is async-signal-safe.
+/// @param[out] pRecord      the record to fill
+/// @param[out] pQueryResult optional, receives the ADLUtil_Result of the version query the record comes from
+/// @returns    an ADLUtil_RecordStatus.
+ADLUtil_RecordStatus ADLUtil_GetDriverVersionRecord(ADLUtil_DriverVersionRecord* pRecord, int32_t* pQueryResult);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //_ADL_UTIL_C_API_H_
@@ -0,0 +1,352 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Persistent on-disk cache of the ADL enumeration results.
+//==============================================================================
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include "ADLUtilCache.h"
+#include "ADLUtilASICDatabase.h"
+#include "ADLUtilSysfs.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Offset of the first byte covered by the checksum
+static constexpr size_t s_checksumOffset = offsetof(ADLUtil_CacheFileHeader, checksum) + sizeof(uint64_t);
+
+// 64 bit FNV-1a hash
+static uint64_t HashBytes(const char* pData, size_t size)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= static_cast<unsigned char>(pData[i]);
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+// Copies a string into a fixed size, NUL-terminated and zero-padded field
+template <size_t size>
+static void CopyField(char (&dest)[size], std::string_view src)
+{
+    memset(dest, 0, size);
+    memcpy(dest, src.data(), std::min(src.size(), size - 1));
+}
+
+// Reads a fixed size field that may not be NUL-terminated if the file was tampered with
+template <size_t size>
+static std::string ReadField(const char (&src)[size])
+{
+    return std::string(src, strnlen(src, size));
+}
+
+// Serializes the contents into the complete file image, including the checksum
+static std::vector<char> BuildImage(const AsicInfoList& asicInfoList, const ADLVersionsInfo& adlVersionsInfo, const ADLUtil_CacheStamp& stamp)
+{
+    std::vector<char> image(sizeof(ADLUtil_CacheFileHeader) + sizeof(ADLUtil_CacheFileRecord) * asicInfoList.size(), 0);
+
+    ADLUtil_CacheFileHeader* pHeader = reinterpret_cast<ADLUtil_CacheFileHeader*>(image.data());
+    pHeader->magic           = ADLUTIL_CACHE_MAGIC;
+    pHeader->formatVersion   = ADLUTIL_CACHE_FORMAT_VERSION;
+    pHeader->headerSize      = sizeof(ADLUtil_CacheFileHeader);
+    pHeader->recordSize      = sizeof(ADLUtil_CacheFileRecord);
+    pHeader->recordCount     = static_cast<uint32_t>(asicInfoList.size());
+    pHeader->backend         = static_cast<uint32_t>(stamp.backend);
+    pHeader->writeTime       = stamp.writeTime;
+    pHeader->driverStamp     = stamp.driverStamp;
+    pHeader->adlVersionsInfo = adlVersionsInfo;
+    CopyField(pHeader->libraryPath, stamp.libraryPath);
+
+    ADLUtil_CacheFileRecord* pRecords = reinterpret_cast<ADLUtil_CacheFileRecord*>(image.data() + sizeof(ADLUtil_CacheFileHeader));
+
+    for (size_t i = 0; i < asicInfoList.size(); ++i)
+    {
+        const ADLUtil_ASICInfo& asicInfo = asicInfoList[i];
+        ADLUtil_CacheFileRecord& record  = pRecords[i];
+
+        record.vendorID       = asicInfo.vendorID;
+        record.deviceID       = asicInfo.deviceID;
+        record.revID          = asicInfo.revID;
+        record.subsystemID    = asicInfo.subsystemID;
+        record.busNumber      = asicInfo.busNumber;
+        record.deviceNumber   = asicInfo.deviceNumber;
+        record.functionNumber = asicInfo.functionNumber;
+        record.gpuIndex       = asicInfo.gpuIndex;
+        record.adapterIndex   = asicInfo.adapterIndex;
+        CopyField(record.adapterName, asicInfo.adapterName);
+        CopyField(record.deviceIDString, asicInfo.deviceIDString);
+        CopyField(record.registryPath, asicInfo.registryPath);
+        CopyField(record.registryPathExt, asicInfo.registryPathExt);
+        CopyField(record.udid, asicInfo.udid);
+    }
+
+    pHeader->checksum = HashBytes(image.data() + s_checksumOffset, image.size() - s_checksumOffset);
+
+    return image;
+}
+
+// Validates a file image and parses it into contents
+static bool ParseImage(const char* pData, size_t size, ADLUtil_Backend backend, ADLUtil_CacheContents& contents)
+{
+    if (size < sizeof(ADLUtil_CacheFileHeader))
+    {
+        return false;
+    }
+
+    ADLUtil_CacheFileHeader header;
+    memcpy(&header, pData, sizeof(header));
+
+    if (ADLUTIL_CACHE_MAGIC != header.magic ||
+        ADLUTIL_CACHE_FORMAT_VERSION != header.formatVersion ||
+        sizeof(ADLUtil_CacheFileHeader) != header.headerSize ||
+        sizeof(ADLUtil_CacheFileRecord) != header.recordSize ||
+        static_cast<uint32_t>(backend) != header.backend ||
+        size != sizeof(ADLUtil_CacheFileHeader) + static_cast<size_t>(header.recordCount) * sizeof(ADLUtil_CacheFileRecord))
+    {
+        return false;
+    }
+
+    if (header.checksum != HashBytes(pData + s_checksumOffset, size - s_checksumOffset))
+    {
+        return false;
+    }
+
+    contents.adlVersionsInfo = header.adlVersionsInfo;
+    contents.adlVersionsInfo.strDriverVer[ADL_MAX_PATH - 1]       = '\0';
+    contents.adlVersionsInfo.strCatalystVersion[ADL_MAX_PATH - 1] = '\0';
+    contents.adlVersionsInfo.strCatalystWebLink[ADL_MAX_PATH - 1] = '\0';
+    contents.stamp.backend     = backend;
+    contents.stamp.writeTime   = header.writeTime;
+    contents.stamp.driverStamp = header.driverStamp;
+    contents.stamp.libraryPath = ReadField(header.libraryPath);
+    contents.checksum          = header.checksum;
+
+    contents.asicInfoList.clear();
+    contents.asicInfoList.reserve(header.recordCount);
+
+    for (uint32_t i = 0; i < header.recordCount; ++i)
+    {
+        ADLUtil_CacheFileRecord record;
+        memcpy(&record, pData + sizeof(ADLUtil_CacheFileHeader) + i * sizeof(ADLUtil_CacheFileRecord), sizeof(record));
+
+        ADLUtil_ASICInfo asicInfo;
+        asicInfo.vendorID        = record.vendorID;
+        asicInfo.deviceID        = record.deviceID;
+        asicInfo.revID           = record.revID;
+        asicInfo.subsystemID     = record.subsystemID;
+        asicInfo.busNumber       = record.busNumber;
+        asicInfo.deviceNumber    = record.deviceNumber;
+        asicInfo.functionNumber  = record.functionNumber;
+        asicInfo.gpuIndex        = record.gpuIndex;
+        asicInfo.adapterIndex    = record.adapterIndex;
+        asicInfo.adapterName     = ReadField(record.adapterName);
+        asicInfo.deviceIDString  = ReadField(record.deviceIDString);
+        asicInfo.registryPath    = ReadField(record.registryPath);
+        asicInfo.registryPathExt = ReadField(record.registryPathExt);
+        asicInfo.udid            = ReadField(record.udid);
+
+        // classify with the database of this build rather than storing the result, so that database updates apply to cached adapters
+        ADLUtil_ASICDatabase::Classify(asicInfo);
+
+        contents.asicInfoList.push_back(asicInfo);
+    }
+
+    return true;
+}
+
+bool ADLUtil_ReadCacheFile(const std::string& cachePath, ADLUtil_Backend backend, ADLUtil_CacheContents& contents)
+{
+    // the records are parsed into ADLUtil_ASICInfo anyway, so a single read into a buffer is as good as a mapping
+    std::vector<char> image;
+    bool              isRead = false;
+
+#ifdef _WIN32
+    // FILE_SHARE_DELETE allows another process to rename a new cache file over this one while it is read
+    HANDLE hFile = CreateFileA(cachePath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (INVALID_HANDLE_VALUE != hFile)
+    {
+        LARGE_INTEGER fileSize;
+
+        if (GetFileSizeEx(hFile, &fileSize) && 0 < fileSize.QuadPart && MAXDWORD >= fileSize.QuadPart)
+        {
+            DWORD bytesRead = 0;
+            image.resize(static_cast<size_t>(fileSize.QuadPart));
+            isRead = ReadFile(hFile, image.data(), static_cast<DWORD>(image.size()), &bytesRead, nullptr) && image.size() == bytesRead;
+        }
+
+        CloseHandle(hFile);
+    }
+#else
+    int fd = open(cachePath.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (0 <= fd)
+    {
+        struct stat fileStat;
+
+        if (0 == fstat(fd, &fileStat) && 0 < fileStat.st_size)
+        {
+            image.resize(static_cast<size_t>(fileStat.st_size));
+            size_t offset = 0;
+
+            while (offset < image.size())
+            {
+                ssize_t bytesRead = read(fd, image.data() + offset, image.size() - offset);
+
+                if (0 < bytesRead)
+                {
+                    offset += static_cast<size_t>(bytesRead);
+                }
+                else if (0 == bytesRead || EINTR != errno)
+                {
+                    break;
+                }
+            }
+
+            isRead = image.size() == offset;
+        }
+
+        close(fd);
+    }
+#endif
+
+    return isRead && ParseImage(image.data(), image.size(), backend, contents);
+}
+
+bool ADLUtil_WriteCacheFile(const std::string& cachePath, const AsicInfoList& asicInfoList, const ADLVersionsInfo& adlVersionsInfo,
+                            const ADLUtil_CacheStamp& stamp, uint64_t knownChecksum)
+{
+    std::vector<char> image = BuildImage(asicInfoList, adlVersionsInfo, stamp);
+
+    if (reinterpret_cast<const ADLUtil_CacheFileHeader*>(image.data())->checksum == knownChecksum)
+    {
+        return true;
+    }
+
+    // a per-process temporary name keeps concurrent writers from interleaving their output
+#ifdef _WIN32
+    std::string tempPath = cachePath + ".tmp" + std::to_string(GetCurrentProcessId());
+#else
+    std::string tempPath = cachePath + ".tmp" + std::to_string(getpid());
+#endif
+
+    // the data reaches the disk before the rename, so that a crash cannot leave a renamed but empty or partial file
+#ifdef _WIN32
+    HANDLE hFile = CreateFileA(tempPath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (INVALID_HANDLE_VALUE == hFile)
+    {
+        return false;
+    }
+
+    DWORD bytesWritten = 0;
+    bool  result = WriteFile(hFile, image.data(), static_cast<DWORD>(image.size()), &bytesWritten, nullptr) && image.size() == bytesWritten &&
+                   FlushFileBuffers(hFile);
+    CloseHandle(hFile);
+
+    result = result && (FALSE != MoveFileExA(tempPath.c_str(), cachePath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH));
+#else
+    int fd = open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+    if (0 > fd)
+    {
+        return false;
+    }
+
+    size_t offset = 0;
+
+    while (offset < image.size())
+    {
+        ssize_t bytesWritten = write(fd, image.data() + offset, image.size() - offset);
+
+        if (0 < bytesWritten)
+        {
+            offset += static_cast<size_t>(bytesWritten);
+        }
+        else if (0 == bytesWritten || EINTR != errno)
+        {
+            break;
+        }
+    }
+
+    bool result = image.size() == offset && 0 == fsync(fd);
+    result = (0 == close(fd)) && result;
+    result = result && (0 == rename(tempPath.c_str(), cachePath.c_str()));
+#endif
+
+    if (!result)
+    {
+        std::remove(tempPath.c_str());
+    }
+
+    return result;
+}
+
+uint64_t ADLUtil_ComputeCacheChecksum(const AsicInfoList& asicInfoList, const ADLVersionsInfo& adlVersionsInfo, const ADLUtil_CacheStamp& stamp)
+{
+    std::vector<char> image = BuildImage(asicInfoList, adlVersionsInfo, stamp);
+    return reinterpret_cast<const ADLUtil_CacheFileHeader*>(image.data())->checksum;
+}
+
+// Fingerprints a file by its size and modification time, 0 if it does not exist
+static uint64_t GetFileStamp(const std::string& path)
+{
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+
+    if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &attributes))
+    {
+        return 0;
+    }
+
+    uint64_t size = (static_cast<uint64_t>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+    uint64_t writeTime = (static_cast<uint64_t>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+#else
+    struct stat fileStat;
+
+    if (0 != stat(path.c_str(), &fileStat))
+    {
+        return 0;
+    }
+
+    uint64_t size = static_cast<uint64_t>(fileStat.st_size);
+    uint64_t writeTime = static_cast<uint64_t>(fileStat.st_mtim.tv_sec) * 1000000000ull + static_cast<uint64_t>(fileStat.st_mtim.tv_nsec);
+#endif
+
+    uint64_t stamp[2] = {size, writeTime};
+    return HashBytes(reinterpret_cast<const char*>(stamp), sizeof(stamp)) | 1;
+}
+
+uint64_t ADLUtil_GetDriverStamp(ADLUtil_Backend backend, const std::string& libraryPath, const std::string& sysfsRoot)
+{
+    if (ADLUtil_Backend::Sysfs == backend)
+    {
+        std::string driverVersion;
+
+        if (ADL_SUCCESS != ADLUtil_QuerySysfsDriverVersion(sysfsRoot, driverVersion) || driverVersion.empty())
+        {
+            return 0;
+        }
+
+        return HashBytes(driverVersion.data(), driverVersion.size()) | 1;
+    }
+
+    return libraryPath.empty() ? 0 : GetFileStamp(libraryPath);
+}
@@ -0,0 +1,113 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Persistent on-disk cache of the ADL enumeration results.
+//==============================================================================
+
+#ifndef _ADL_UTIL_CACHE_H_
+#define _ADL_UTIL_CACHE_H_
+
+#include <cstdint>
+#include <string>
+
+#include "ADLUtilEntrypoints.h"
+
+/// Identifies an adl_util cache file ("ADLC")
+constexpr uint32_t ADLUTIL_CACHE_MAGIC = 0x434C4441;
+
+/// Version of the cache file layout. Bump this whenever ADLUtil_CacheFileHeader or ADLUtil_CacheFileRecord change.
+constexpr uint32_t ADLUTIL_CACHE_FORMAT_VERSION = 6;
+
+/// Size of the library path field of the cache file header, including the terminating NUL
+constexpr uint32_t ADLUTIL_CACHE_MAX_LIBRARY_PATH = 1024;
+
+/// What a cache file was written against, used to decide whether it must be revalidated
+struct ADLUtil_CacheStamp
+{
+    ADLUtil_Backend backend     = ADLUtil_Backend::ADL; ///< the backend that enumerated the records; a file of another backend is not read
+    int64_t         writeTime   = 0;                    ///< when the file was written, in seconds since the epoch
+    uint64_t        driverStamp = 0;                    ///< ADLUtil_GetDriverStamp when the file was written, 0 if it was not known
+    std::string     libraryPath;                        ///< the ADL library file driverStamp was taken from, empty for the sysfs backend
+};
+
+/// Fixed-size header at the start of a cache file. All records follow it directly, so the file is read in one piece.
+struct ADLUtil_CacheFileHeader
+{
+    uint32_t        magic;                                       ///< ADLUTIL_CACHE_MAGIC
+    uint32_t        formatVersion;                               ///< ADLUTIL_CACHE_FORMAT_VERSION
+    uint32_t        headerSize;                                  ///< sizeof(ADLUtil_CacheFileHeader)
+    uint32_t        recordSize;                                  ///< sizeof(ADLUtil_CacheFileRecord)
+    uint32_t        recordCount;                                 ///< number of ADLUtil_CacheFileRecord entries following the header
+    uint32_t        reserved;                                    ///< padding, always 0
+    uint64_t        checksum;                                    ///< FNV-1a hash of everything in the file following this member
+    uint32_t        backend;                                     ///< ADLUtil_CacheStamp::backend
+    uint32_t        reserved2;                                   ///< padding, always 0
+    int64_t         writeTime;                                   ///< ADLUtil_CacheStamp::writeTime
+    uint64_t        driverStamp;                                 ///< ADLUtil_CacheStamp::driverStamp
+    ADLVersionsInfo adlVersionsInfo;                             ///< the driver version info the records were enumerated with
+    char            libraryPath[ADLUTIL_CACHE_MAX_LIBRARY_PATH]; ///< NUL-terminated ADLUtil_CacheStamp::libraryPath
+};
+
+/// Fixed-size on-disk form of an ADLUtil_ASICInfo
+struct ADLUtil_CacheFileRecord
+{
+    int32_t  vendorID;                         ///< the vendor ID
+    int32_t  deviceID;                         ///< the device ID
+    int32_t  revID;                            ///< the revision ID
+    uint32_t subsystemID;                      ///< the subsystem ID
+    int32_t  busNumber;                        ///< the PCI bus number
+    int32_t  deviceNumber;                     ///< the PCI device number
+    int32_t  functionNumber;                   ///< the PCI function number
+    uint32_t gpuIndex;                         ///< GPU index in the system
+    int32_t  adapterIndex;                     ///< the ADL adapter index
+    char     adapterName[ADL_MAX_PATH];        ///< NUL-terminated adapter name
+    char     deviceIDString[ADL_MAX_PATH];     ///< NUL-terminated device ID string
+    char     registryPath[ADL_MAX_PATH];       ///< NUL-terminated adapter registry path
+    char     registryPathExt[ADL_MAX_PATH];    ///< NUL-terminated adapter registry path
+    char     udid[ADL_MAX_PATH];               ///< NUL-terminated adapter UDID
+};
+
+/// Contents of a validated cache file
+struct ADLUtil_CacheContents
+{
+    AsicInfoList    asicInfoList;    ///< the cached ASIC list
+    ADLVersionsInfo    adlVersionsInfo; ///< the cached driver version info
+    ADLUtil_CacheStamp stamp;           ///< what the file was written against
+    uint64_t           checksum;        ///< checksum of the file the contents were read from
+};
+
+/// Reads and validates a cache file.
+/// @param[in]  cachePath the path of the cache file
+/// @param[in]  backend   the backend the records must have been enumerated with
+/// @param[out] contents  the parsed cache contents
+/// @returns    true if the file exists, was written for the backend and passed all format and checksum checks.
+bool ADLUtil_ReadCacheFile(const std::string& cachePath, ADLUtil_Backend backend, ADLUtil_CacheContents& contents);
+
+/// Writes a cache file by writing a temporary file next to it, flushing it to disk and atomically renaming it over the
+/// old one, so that concurrent readers and a crash either leave the old or the new file but never a partial one.
+/// @param[in]  cachePath       the path of the cache file
+/// @param[in]  asicInfoList    the ASIC list to store
+/// @param[in]  adlVersionsInfo the driver version info to store
+/// @param[in]  stamp           what the contents were enumerated against
+/// @param[in]  knownChecksum   checksum of the file currently on disk; if the new contents match it nothing is written
+/// @returns    true if the file on disk holds the given contents when this returns.
+bool ADLUtil_WriteCacheFile(const std::string& cachePath, const AsicInfoList& asicInfoList, const ADLVersionsInfo& adlVersionsInfo,
+                            const ADLUtil_CacheStamp& stamp, uint64_t knownChecksum);
+
+/// Computes the checksum a cache file holding the given contents would have.
+/// @param[in]  asicInfoList    the ASIC list
+/// @param[in]  adlVersionsInfo the driver version info
+/// @param[in]  stamp           what the contents were enumerated against
+/// @returns    the checksum.
+uint64_t ADLUtil_ComputeCacheChecksum(const AsicInfoList& asicInfoList, const ADLVersionsInfo& adlVersionsInfo, const ADLUtil_CacheStamp& stamp);
+
+/// Fingerprints the installed driver without loading it: the size and modification time of the ADL library file for
+/// ADLUtil_Backend::ADL, the amdgpu module version for ADLUtil_Backend::Sysfs. A cache file whose driver stamp differs is revalidated.
+/// @param[in]  backend     the backend
+/// @param[in]  libraryPath the path of the ADL library file, as ADLUtil_GetLibraryPath found it once the library was loaded
+/// @param[in]  sysfsRoot   the root of the sysfs tree
+/// @returns    the stamp, 0 if the driver was not found.
+uint64_t ADLUtil_GetDriverStamp(ADLUtil_Backend backend, const std::string& libraryPath, const std::string& sysfsRoot);
+
+#endif //_ADL_UTIL_CACHE_H_
@@ -0,0 +1,220 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Memoization of ADL queries, keyed by adapter.
+//==============================================================================
+
+#ifndef _ADL_UTIL_CACHED_QUERY_H_
+#define _ADL_UTIL_CACHED_QUERY_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "ADLUtilAtomicSharedPtr.h"
+
+/// Key of queries that are not specific to an adapter
+constexpr int ADLUTIL_ALL_ADAPTERS = -1;
+
+//------------------------------------------------------------------------------------
+/// Memoizes a query per key, by default the ADL adapter index.
+///
+/// The first Get of a key runs the fill function on the calling thread. Concurrent Gets of
+/// the same key wait for that fill instead of running their own; Gets of other keys are not
+/// blocked. Once filled, Get neither locks nor allocates: it reads the published value through
+/// ADLUtil_AtomicSharedPtr and checks that it is neither invalidated nor expired.
+///
+/// Invalidate() advances the generation of the query, which retires the values of all keys
+/// at once without touching them; readers holding a value keep it alive. Values can also
+/// expire after a time to live, so that slowly changing data such as clocks is requeried.
+///
+/// @tparam Value the type of the cached data, served as std::shared_ptr<const Value>
+/// @tparam Fn    callable as std::shared_ptr<const Value>(const Key&); it must not return nullptr
+/// @tparam Key   the key type, hashable with std::hash
+//------------------------------------------------------------------------------------
+template <typename Value, typename Fn, typename Key = int>
+class ADLUtil_CachedQuery
+{
+public:
+    typedef std::shared_ptr<const Value> ValuePtr; ///< a published value
+
+    /// constructor
+    /// @param[in] fill       the query, called with the key to fill
+    /// @param[in] timeToLive how long a value is served after it was filled, 0 to serve it until it is invalidated
+    explicit ADLUtil_CachedQuery(Fn fill, std::chrono::milliseconds timeToLive = std::chrono::milliseconds(0)) :
+        m_fill(std::move(fill)),
+        m_timeToLive(timeToLive),
+        m_generation(0),
+        m_slots(std::make_shared<const SlotMap>())
+    {
+    }
+
+    ADLUtil_CachedQuery(const ADLUtil_CachedQuery&) = delete;
+    ADLUtil_CachedQuery& operator=(const ADLUtil_CachedQuery&) = delete;
+
+    /// Returns the value of a key without filling it
+    /// @param[in] key the key
+    /// @returns   the value, or nullptr if the key was not filled since it was last invalidated or its value expired.
+    ValuePtr Peek(const Key& key) const
+    {
+        // neither the slot map nor the entry is copied out, so the value's reference count is the only shared write
+        typename ADLUtil_AtomicSharedPtr<SlotMap>::Reader slots(m_slots);
+        typename SlotMap::const_iterator                  it = slots.Get()->find(key);
+
+        if (slots.Get()->end() == it)
+        {
+            return nullptr;
+        }
+
+        typename ADLUtil_AtomicSharedPtr<Entry>::Reader entry(it->second->entry);
+        return IsFresh(entry.Get()) ? entry.Get()->value : nullptr;
+    }
+
+    /// Returns the value of a key, filling it first if needed
+    /// @param[in] key the key
+    /// @returns   the value, never nullptr.
+    ValuePtr Get(const Key& key)
+    {
+        ValuePtr value = Peek(key);
+
+        if (nullptr != value)
+        {
+            return value;
+        }
+
+        Slot&                       slot = GetSlot(key);
+        std::lock_guard<std::mutex> lock(slot.fillMutex);
+
+        // another thread may have filled the key while we were waiting for the lock
+        std::shared_ptr<const Entry> entry = slot.entry.Load();
+
+        if (IsFresh(entry.get()))
+        {
+            return entry->value;
+        }
+
+        // a value filled during an Invalidate() belongs to the generation the fill started in, so it is not served afterwards
+        uint64_t generation = m_generation.load(std::memory_order_acquire);
+        value = m_fill(key);
+        std::shared_ptr<const Entry> newEntry = MakeEntry(generation, value);
+
+        // the fill may have stored a value itself; that one is at least as recent, so keep it
+        if (!slot.entry.CompareExchange(entry, newEntry) && IsFresh(entry.get()))
+        {
+            return entry->value;
+        }
+
+        return value;
+    }
+
+    /// Publishes a value for a key, replacing the current one. Gets of the key return it from now on.
+    /// May be called from inside the fill function.
+    /// @param[in] key   the key
+    /// @param[in] value the value, not nullptr
+    void Store(const Key& key, ValuePtr value)
+    {
+        GetSlot(key).entry.Store(MakeEntry(m_generation.load(std::memory_order_acquire), std::move(value)));
+    }
+
+    /// Retires the value of a key; the next Get of the key fills it again
+    /// @param[in] key the key
+    void Invalidate(const Key& key)
+    {
+        typename ADLUtil_AtomicSharedPtr<SlotMap>::Reader slots(m_slots);
+        typename SlotMap::const_iterator                  it = slots.Get()->find(key);
+
+        if (slots.Get()->end() != it)
+        {
+            it->second->entry.Store(nullptr);
+        }
+    }
+
+    /// Retires the values of all keys; the next Get of each key fills it again
+    void Invalidate()
+    {
+        m_generation.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    /// @returns the generation of the query, advanced by each Invalidate().
+    uint64_t GetGeneration() const { return m_generation.load(std::memory_order_acquire); }
+
+private:
+    /// A published value
+    struct Entry
+    {
+        ValuePtr                              value;      ///< the value
+        uint64_t                              generation; ///< generation of the query the value was filled in
+        std::chrono::steady_clock::time_point expiresAt;  ///< when the value expires, only used if m_timeToLive is set
+    };
+
+    /// The state of one key. Slots are never removed, so a slot found once stays valid.
+    struct Slot
+    {
+        std::mutex                     fillMutex; ///< serializes the fills of the key
+        ADLUtil_AtomicSharedPtr<Entry> entry;     ///< the published value
+    };
+
+    typedef std::unordered_map<Key, std::shared_ptr<Slot>> SlotMap; ///< the slots by key
+
+    /// @returns true if entry holds a value of the current generation that has not expired.
+    bool IsFresh(const Entry* entry) const
+    {
+        return nullptr != entry && nullptr != entry->value && m_generation.load(std::memory_order_acquire) == entry->generation &&
+               (0 == m_timeToLive.count() || std::chrono::steady_clock::now() < entry->expiresAt);
+    }
+
+    /// @returns a new entry of the given generation, expiring one time to live from now.
+    std::shared_ptr<const Entry> MakeEntry(uint64_t generation, ValuePtr value) const
+    {
+        std::shared_ptr<Entry> entry = std::make_shared<Entry>();
+        entry->value = std::move(value);
+        entry->generation = generation;
+        entry->expiresAt = std::chrono::steady_clock::now() + m_timeToLive;
+        return entry;
+    }
+
+    /// @returns the slot of a key, adding it if needed. The slot lives as long as the query.
+    Slot& GetSlot(const Key& key)
+    {
+        {
+            typename ADLUtil_AtomicSharedPtr<SlotMap>::Reader slots(m_slots);
+            typename SlotMap::const_iterator                  it = slots.Get()->find(key);
+
+            if (slots.Get()->end() != it)
+            {
+                return *it->second;
+            }
+        }
+
+        // copy on write, so that Peek never locks; keys are few and added once
+        std::lock_guard<std::mutex>    lock(m_slotsMutex);
+        std::shared_ptr<const SlotMap> slots = m_slots.Load();
+        typename SlotMap::const_iterator it = slots->find(key);
+
+        if (slots->end() != it)
+        {
+            return *it->second;
+        }
+
+        std::shared_ptr<SlotMap> newSlots = std::make_shared<SlotMap>(*slots);
+        std::shared_ptr<Slot>    slot = std::make_shared<Slot>();
+        newSlots->emplace(key, slot);
+        m_slots.Store(std::move(newSlots));
+
+        return *slot;
+    }
+
+    Fn                        m_fill;       ///< the query
+    std::chrono::milliseconds m_timeToLive; ///< how long a value is served, 0 for no limit
+    std::atomic<uint64_t>     m_generation; ///< advanced by Invalidate()
+    std::mutex                m_slotsMutex; ///< serializes the addition of slots
+
+    ADLUtil_AtomicSharedPtr<SlotMap> m_slots; ///< the slots, replaced as a whole when a key is added
+};
+
+#endif //_ADL_UTIL_CACHED_QUERY_H_
@@ -0,0 +1,281 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Pool of ADL contexts for querying adapters from several threads at once.
+//==============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <future>
+
+#include "ADLUtilContextPool.h"
+
+// Allocation callback of the pooled contexts. Their queries return data outside of any enumeration,
+// so unlike the singleton's context they never allocate from the callback arena.
+static void* __stdcall PoolMemoryAlloc(int iSize)
+{
+    return malloc(iSize);
+}
+
+ADLUtil_ContextPool::Lease::Lease(ADLUtil_ContextPool* pPool, ADL_CONTEXT_HANDLE adlContext) :
+    m_pPool(pPool),
+    m_adlContext(adlContext)
+{
+}
+
+ADLUtil_ContextPool::Lease::~Lease()
+{
+    if (nullptr != m_pPool)
+    {
+        m_pPool->Release(m_adlContext);
+    }
+}
+
+ADLUtil_ContextPool::Lease::Lease(Lease&& other) noexcept :
+    m_pPool(other.m_pPool),
+    m_adlContext(other.m_adlContext)
+{
+    other.m_pPool = nullptr;
+}
+
+ADLUtil_ContextPool::Lease& ADLUtil_ContextPool::Lease::operator=(Lease&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (nullptr != m_pPool)
+        {
+            m_pPool->Release(m_adlContext);
+        }
+
+        m_pPool = other.m_pPool;
+        m_adlContext = other.m_adlContext;
+        other.m_pPool = nullptr;
+    }
+
+    return *this;
+}
+
+ADLUtil_ContextPool::ADLUtil_ContextPool() :
+    m_isLegacy(false),
+    m_stopping(false)
+{
+}
+
+ADLUtil_ContextPool::~ADLUtil_ContextPool()
+{
+    Destroy();
+}
+
+ADLUtil_Result ADLUtil_ContextPool::Create(unsigned int contextCount, unsigned int threadCount)
+{
+    Destroy();
+
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+    ADLUtil_Result result = pADLUtils->AcquireLease(m_libraryLease);
+
+    if (ADL_SUCCESS != result)
+    {
+        return result;
+    }
+
+    m_isLegacy = !pADLUtils->IsAvailable<ADLUtil_Entrypoint::ADL2_Main_Control_Create>();
+
+    if (m_isLegacy)
+    {
+        // the legacy entry points share the one global context that the library was loaded with
+        m_contexts.push_back(nullptr);
+    }
+    else
+    {
+        for (unsigned int i = 0; i < std::max(contextCount, 1u); ++i)
+        {
+            ADL_CONTEXT_HANDLE adlContext = nullptr;
+            int adlResult = pADLUtils->Call<ADLUtil_Entrypoint::ADL2_Main_Control_Create>(PoolMemoryAlloc, 1, &adlContext);
+
+            if (ADL_OK != adlResult && ADL_OK_WARNING != adlResult)
+            {
+                // keep the contexts created so far; a smaller pool is still usable
+                result = m_contexts.empty() ? ADL_INITIALIZATION_FAILED : ADL_WARNING;
+                break;
+            }
+
+            m_contexts.push_back(adlContext);
+        }
+    }
+
+    m_freeContexts = m_contexts;
+
+    if (!m_contexts.empty())
+    {
+        m_stopping = false;
+
+        for (unsigned int i = 0; i < threadCount; ++i)
+        {
+            m_workers.emplace_back(&ADLUtil_ContextPool::WorkerLoop, this);
+        }
+    }
+
+    return result;
+}
+
+void ADLUtil_ContextPool::Destroy()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_taskMutex);
+        m_stopping = true;
+    }
+
+    m_taskAdded.notify_all();
+
+    for (std::thread& worker : m_workers)
+    {
+        worker.join();
+    }
+
+    m_workers.clear();
+
+    {
+        std::unique_lock<std::mutex> lock(m_freeMutex);
+        m_freeChanged.wait(lock, [this]() { return m_freeContexts.size() == m_contexts.size(); });
+        m_freeContexts.clear();
+    }
+
+    if (!m_isLegacy)
+    {
+        AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+
+        for (ADL_CONTEXT_HANDLE adlContext : m_contexts)
+        {
+            pADLUtils->Call<ADLUtil_Entrypoint::ADL2_Main_Control_Destroy>(adlContext);
+        }
+    }
+
+    m_contexts.clear();
+    m_isLegacy = false;
+    m_libraryLease.Release();
+}
+
+ADLUtil_ContextPool::Lease ADLUtil_ContextPool::Acquire()
+{
+    std::unique_lock<std::mutex> lock(m_freeMutex);
+    m_freeChanged.wait(lock, [this]() { return !m_freeContexts.empty(); });
+
+    ADL_CONTEXT_HANDLE adlContext = m_freeContexts.back();
+    m_freeContexts.pop_back();
+
+    return Lease(this, adlContext);
+}
+
+void ADLUtil_ContextPool::Release(ADL_CONTEXT_HANDLE adlContext)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_freeMutex);
+        m_freeContexts.push_back(adlContext);
+    }
+
+    m_freeChanged.notify_all();
+}
+
+ADLUtil_Result ADLUtil_ContextPool::ForEachPhysicalGPU(const PhysicalGPUQuery& query)
+{
+    AsicInfoListSnapshot                            asicInfoList;
+    std::shared_ptr<const ADLUtil_PhysicalGPUIndex> physicalGPUIndex;
+    ADLUtil_Result                                  result = GetPhysicalGPUs(asicInfoList, physicalGPUIndex);
+
+    RunOnPhysicalGPUs(*asicInfoList, *physicalGPUIndex, query);
+
+    return result;
+}
+
+ADLUtil_Result ADLUtil_ContextPool::GetPhysicalGPUs(AsicInfoListSnapshot& asicInfoList, std::shared_ptr<const ADLUtil_PhysicalGPUIndex>& physicalGPUIndex)
+{
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+
+    ADLUtil_Result result = pADLUtils->GetAsicInfoList(asicInfoList);
+    pADLUtils->GetPhysicalGPUIndex(physicalGPUIndex);
+
+    return result;
+}
+
+void ADLUtil_ContextPool::RunOnPhysicalGPUs(const AsicInfoList& asicInfoList, const ADLUtil_PhysicalGPUIndex& physicalGPUIndex, const PhysicalGPUQuery& query)
+{
+    uint32_t physicalGPUCount = physicalGPUIndex.GetCount();
+
+    if (0 == physicalGPUCount || m_contexts.empty())
+    {
+        return;
+    }
+
+    // each participating thread leases one context and pulls GPUs until none are left
+    std::atomic<uint32_t> nextPhysicalGPU(0);
+
+    auto drain = [this, &asicInfoList, &physicalGPUIndex, &query, &nextPhysicalGPU, physicalGPUCount]()
+    {
+        if (physicalGPUCount <= nextPhysicalGPU.load())
+        {
+            return;
+        }
+
+        Lease lease = Acquire();
+
+        for (uint32_t physicalGPU = nextPhysicalGPU++; physicalGPU < physicalGPUCount; physicalGPU = nextPhysicalGPU++)
+        {
+            uint32_t adapter = physicalGPUIndex.GetFirstLogicalAdapter(physicalGPU);
+
+            if (adapter < asicInfoList.size())
+            {
+                query(lease.GetContext(), physicalGPU, asicInfoList[adapter]);
+            }
+        }
+    };
+
+    // more helpers than contexts or GPUs would only wait for a lease
+    size_t helperCount = std::min({m_workers.size(), m_contexts.size() - 1, static_cast<size_t>(physicalGPUCount - 1)});
+    std::vector<std::future<void>> helpers;
+
+    {
+        std::lock_guard<std::mutex> lock(m_taskMutex);
+
+        for (size_t i = 0; i < helperCount; ++i)
+        {
+            std::shared_ptr<std::packaged_task<void()>> task = std::make_shared<std::packaged_task<void()>>(drain);
+            helpers.push_back(task->get_future());
+            m_tasks.emplace_back([task]() { (*task)(); });
+        }
+    }
+
+    m_taskAdded.notify_all();
+
+    // the calling thread helps, so the fan-out finishes even if the workers are busy with other fan-outs
+    drain();
+
+    for (std::future<void>& helper : helpers)
+    {
+        helper.wait();
+    }
+}
+
+void ADLUtil_ContextPool::WorkerLoop()
+{
+    for (;;)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(m_taskMutex);
+            m_taskAdded.wait(lock, [this]() { return m_stopping || !m_tasks.empty(); });
+
+            if (m_tasks.empty())
+            {
+                return;
+            }
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+
+        task();
+    }
+}
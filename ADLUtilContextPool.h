@@ -0,0 +1,153 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Pool of ADL contexts for querying adapters from several threads at once.
+//==============================================================================
+
+#ifndef _ADL_UTIL_CONTEXT_POOL_H_
+#define _ADL_UTIL_CONTEXT_POOL_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ADLUtilEntrypoints.h"
+#include "ADLUtilPhysicalGPUIndex.h"
+
+//------------------------------------------------------------------------------------
+/// Owns several ADL2 contexts and leases them to threads for scoped use, so that
+/// per-adapter queries made through different contexts do not wait for each other.
+/// When the driver lacks the ADL2 entry points the pool falls back to the single
+/// legacy ADL context: it then holds one context, nullptr, which is leased to one
+/// thread at a time and must be used with the ADL_* entry points.
+/// Destroy the pool before unloading ADL through AMDTADLUtils.
+//------------------------------------------------------------------------------------
+class ADLUtil_ContextPool
+{
+public:
+    //------------------------------------------------------------------------------------
+    /// Exclusive use of one context of the pool, returned to the pool when the lease is destroyed
+    //------------------------------------------------------------------------------------
+    class Lease
+    {
+    public:
+        /// destructor, returns the context to the pool
+        ~Lease();
+
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        /// @returns the leased context; nullptr for the legacy context.
+        ADL_CONTEXT_HANDLE GetContext() const { return m_adlContext; }
+
+    private:
+        friend class ADLUtil_ContextPool;
+
+        /// constructor
+        /// @param[in] pPool      the pool the context belongs to
+        /// @param[in] adlContext the leased context
+        Lease(ADLUtil_ContextPool* pPool, ADL_CONTEXT_HANDLE adlContext);
+
+        ADLUtil_ContextPool* m_pPool;      ///< the pool to return the context to, nullptr once moved from
+        ADL_CONTEXT_HANDLE   m_adlContext; ///< the leased context
+    };
+
+    /// Callback of ForEachPhysicalGPU, called once per physical GPU with a leased context and the first logical adapter of the GPU
+    typedef std::function<void(ADL_CONTEXT_HANDLE adlContext, uint32_t physicalGPU, const ADLUtil_ASICInfo& asicInfo)> PhysicalGPUQuery;
+
+    /// constructor, creates an empty pool
+    ADLUtil_ContextPool();
+
+    /// destructor, destroys the contexts and stops the worker threads
+    ~ADLUtil_ContextPool();
+
+    ADLUtil_ContextPool(const ADLUtil_ContextPool&) = delete;
+    ADLUtil_ContextPool& operator=(const ADLUtil_ContextPool&) = delete;
+
+    /// Loads ADL through AMDTADLUtils, creates the contexts and starts the worker threads of ForEachPhysicalGPU.
+    /// Falls back to the legacy context if ADL2_Main_Control_Create is not exported.
+    /// @param[in] contextCount the number of ADL2 contexts to create, at least 1
+    /// @param[in] threadCount  the number of worker threads, 0 to run ForEachPhysicalGPU on the calling thread only
+    /// @returns   an enum ADLUtil_Result status code.
+    ADLUtil_Result Create(unsigned int contextCount, unsigned int threadCount);
+
+    /// Waits for outstanding leases, then destroys the contexts and stops the worker threads
+    void Destroy();
+
+    /// @returns true if the pool holds the legacy context instead of ADL2 contexts.
+    bool IsLegacy() const { return m_isLegacy; }
+
+    /// @returns the number of contexts in the pool, 0 before Create.
+    size_t GetContextCount() const { return m_contexts.size(); }
+
+    /// Leases a context, waiting until one is free. Only call this on a pool that was created successfully.
+    /// @returns the lease.
+    Lease Acquire();
+
+    /// Runs a query for every physical GPU on the worker threads and the calling thread, and returns once all queries completed.
+    /// Each thread holds one leased context while it works through the GPUs. The query must not throw.
+    /// @param[in] query the query to run
+    /// @returns   an enum ADLUtil_Result status code of the enumeration.
+    ADLUtil_Result ForEachPhysicalGPU(const PhysicalGPUQuery& query);
+
+    /// Runs a query for every physical GPU and gathers the results, indexed by physical GPU
+    /// @param[in]  query   the query to run, returning its result for one GPU
+    /// @param[out] results the result of each physical GPU
+    /// @returns    an enum ADLUtil_Result status code of the enumeration.
+    template <typename T>
+    ADLUtil_Result GatherPhysicalGPUs(const std::function<T(ADL_CONTEXT_HANDLE adlContext, uint32_t physicalGPU, const ADLUtil_ASICInfo& asicInfo)>& query, std::vector<T>& results)
+    {
+        AsicInfoListSnapshot                            asicInfoList;
+        std::shared_ptr<const ADLUtil_PhysicalGPUIndex> physicalGPUIndex;
+        ADLUtil_Result                                  result = GetPhysicalGPUs(asicInfoList, physicalGPUIndex);
+
+        results.assign(physicalGPUIndex->GetCount(), T());
+
+        // every query writes its own element, so the results need no lock
+        RunOnPhysicalGPUs(*asicInfoList, *physicalGPUIndex, [&query, &results](ADL_CONTEXT_HANDLE adlContext, uint32_t physicalGPU, const ADLUtil_ASICInfo& asicInfo)
+        {
+            results[physicalGPU] = query(adlContext, physicalGPU, asicInfo);
+        });
+
+        return result;
+    }
+
+private:
+    /// Gets the enumerated adapters and their physical GPUs
+    /// @param[out] asicInfoList     the logical adapters
+    /// @param[out] physicalGPUIndex the physical GPUs of asicInfoList
+    /// @returns    an enum ADLUtil_Result status code of the enumeration.
+    static ADLUtil_Result GetPhysicalGPUs(AsicInfoListSnapshot& asicInfoList, std::shared_ptr<const ADLUtil_PhysicalGPUIndex>& physicalGPUIndex);
+
+    /// Fans the query out over the physical GPUs on the worker threads and the calling thread
+    void RunOnPhysicalGPUs(const AsicInfoList& asicInfoList, const ADLUtil_PhysicalGPUIndex& physicalGPUIndex, const PhysicalGPUQuery& query);
+
+    /// Returns a leased context to the free list
+    void Release(ADL_CONTEXT_HANDLE adlContext);
+
+    /// Body of the worker threads
+    void WorkerLoop();
+
+    AMDTADLUtils::Lease                m_libraryLease;  ///< keeps the ADL library loaded while the pool has contexts
+    bool                               m_isLegacy;      ///< true if the pool holds the legacy context
+    std::vector<ADL_CONTEXT_HANDLE>    m_contexts;      ///< all contexts of the pool
+
+    std::mutex                         m_freeMutex;     ///< protects m_freeContexts
+    std::condition_variable            m_freeChanged;   ///< signaled when a context is returned
+    std::vector<ADL_CONTEXT_HANDLE>    m_freeContexts;  ///< contexts not leased
+
+    std::mutex                         m_taskMutex;     ///< protects m_tasks and m_stopping
+    std::condition_variable            m_taskAdded;     ///< signaled when a task is queued or the workers are stopped
+    std::deque<std::function<void()>>  m_tasks;         ///< work for the worker threads
+    bool                               m_stopping;      ///< true tells the worker threads to exit
+    std::vector<std::thread>           m_workers;       ///< the worker threads
+};
+
+#endif //_ADL_UTIL_CONTEXT_POOL_H_
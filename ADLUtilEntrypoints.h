@@ -0,0 +1,150 @@
+//==============================================================================
+// Copyright (c) 2011-2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  The ADL entry point table and typed access to it, for code that calls ADL directly.
+///         Includes the ADL SDK and, on Windows, Windows.h; code that only needs the cached
+///         ADLUtil data should include ADLUtil.h instead.
+//==============================================================================
+
+#ifndef _ADL_UTIL_ENTRYPOINTS_H_
+#define _ADL_UTIL_ENTRYPOINTS_H_
+
+#include <atomic>
+#include <cstdint>
+
+#ifdef _WIN32
+#include <Windows.h>
+#elif !defined(__stdcall)
+// ADL callbacks are declared __stdcall, which only means something on 32 bit Windows
+#define __stdcall
+#endif
+
+#include "adl_sdk.h"
+
+#include "ADLUtil.h"
+#include "ADLUtilInstrumentation.h"
+
+/// Converts an ADL AdapterInfo into an ADLUtil_ASICInfo, including the IDs from its UDID and its PCI bus location.
+/// @param[in]  adapterInfo the adapter info returned by ADL
+/// @param[out] asicInfo    the parsed ASIC info
+/// @returns    an enum ADLUtil_UDIDParseResult status code of parsing the UDID.
+ADLUtil_UDIDParseResult ADLUtil_ParseAdapterInfo(const AdapterInfo& adapterInfo, ADLUtil_ASICInfo& asicInfo);
+
+// Typedefs of the ADL function pointers. If additional entry points are needed, add them here
+typedef int(*ADL_Main_Control_Create_fn)(ADL_MAIN_MALLOC_CALLBACK, int);
+typedef int(*ADL_Main_Control_Destroy_fn)();
+typedef int(*ADL2_Main_Control_Create_fn)(ADL_MAIN_MALLOC_CALLBACK, int, ADL_CONTEXT_HANDLE*);
+typedef int(*ADL2_Main_Control_Destroy_fn)(ADL_CONTEXT_HANDLE);
+
+typedef int(*ADL_Adapter_NumberOfAdapters_Get_fn)(int*);
+typedef int(*ADL_Adapter_AdapterInfo_Get_fn)(LPAdapterInfo, int);
+typedef int(*ADL2_Adapter_NumberOfAdapters_Get_fn)(ADL_CONTEXT_HANDLE, int*);
+typedef int(*ADL2_Adapter_AdapterInfo_Get_fn)(ADL_CONTEXT_HANDLE, LPAdapterInfo, int);
+
+typedef int(*ADL_Graphics_Versions_Get_fn)(struct ADLVersionsInfo*);
+typedef int(*ADL2_Graphics_Versions_Get_fn)(ADL_CONTEXT_HANDLE, struct ADLVersionsInfo*);
+
+typedef int(*ADL2_Overdrive5_CurrentActivity_Get_fn)(ADL_CONTEXT_HANDLE, int, ADLPMActivity*);
+typedef int(*ADL2_Overdrive5_Temperature_Get_fn)(ADL_CONTEXT_HANDLE, int, int, ADLTemperature*);
+typedef int(*ADL2_Overdrive5_FanSpeed_Get_fn)(ADL_CONTEXT_HANDLE, int, int, ADLFanSpeedValue*);
+typedef int(*ADL2_Adapter_VRAMUsage_Get_fn)(ADL_CONTEXT_HANDLE, int, int*);
+
+// Table of ADL entry points. If additional entry points are needed, add them to this table. Entry points are resolved on first use,
+// and a driver that lacks one of them only makes that entry point unavailable
+#define ADL_INTERFACE_TABLE                 \
+    X(ADL_Main_Control_Create)              \
+    X(ADL_Main_Control_Destroy)             \
+    X(ADL2_Main_Control_Create)             \
+    X(ADL2_Main_Control_Destroy)            \
+    X(ADL_Adapter_NumberOfAdapters_Get)     \
+    X(ADL_Adapter_AdapterInfo_Get)          \
+    X(ADL2_Adapter_NumberOfAdapters_Get)    \
+    X(ADL2_Adapter_AdapterInfo_Get)         \
+    X(ADL_Graphics_Versions_Get)            \
+    X(ADL2_Graphics_Versions_Get)           \
+    X(ADL2_Overdrive5_CurrentActivity_Get)  \
+    X(ADL2_Overdrive5_Temperature_Get)      \
+    X(ADL2_Overdrive5_FanSpeed_Get)         \
+    X(ADL2_Adapter_VRAMUsage_Get)
+
+/// Identifiers of the ADL entry points, indices into the resolved entry point table
+enum class ADLUtil_Entrypoint : uint32_t
+{
+#define X(SYM) SYM,
+    ADL_INTERFACE_TABLE
+#undef X
+    Count ///< number of entry points
+};
+
+/// Maps an ADLUtil_Entrypoint to its function pointer type
+template <ADLUtil_Entrypoint Sym>
+struct ADLUtil_EntrypointTraits;
+
+#define X(SYM)                                                 \
+    template <>                                                \
+    struct ADLUtil_EntrypointTraits<ADLUtil_Entrypoint::SYM>   \
+    {                                                          \
+        typedef SYM##_fn Type; /* function pointer type */     \
+    };
+ADL_INTERFACE_TABLE
+#undef X
+
+/// @returns the exported name of an ADL entry point.
+const char* ADLUtil_GetEntrypointName(ADLUtil_Entrypoint entrypoint);
+
+/// The resolved entry points, owned by the implementation and read by GetEntrypointAddress without a call into it
+struct AMDTADLUtils::EntrypointTable
+{
+    /// Marks entries that were resolved but are not exported by the library
+    static char s_missingEntrypoint;
+
+    /// Resolved entry points indexed by ADLUtil_Entrypoint: nullptr if not resolved yet, &s_missingEntrypoint if not exported
+    std::atomic<void*> entrypoints[static_cast<uint32_t>(ADLUtil_Entrypoint::Count)];
+};
+
+inline void* AMDTADLUtils::GetEntrypointAddress(ADLUtil_Entrypoint entrypoint)
+{
+    void* pEntrypoint = m_pEntrypointTable->entrypoints[static_cast<uint32_t>(entrypoint)].load(std::memory_order_acquire);
+
+    if (nullptr == pEntrypoint)
+    {
+        pEntrypoint = ResolveEntrypoint(entrypoint);
+    }
+
+    return (&EntrypointTable::s_missingEntrypoint == pEntrypoint) ? nullptr : pEntrypoint;
+}
+
+template <ADLUtil_Entrypoint Sym>
+typename ADLUtil_EntrypointTraits<Sym>::Type AMDTADLUtils::GetEntrypoint()
+{
+    return reinterpret_cast<typename ADLUtil_EntrypointTraits<Sym>::Type>(GetEntrypointAddress(Sym));
+}
+
+template <ADLUtil_Entrypoint Sym>
+bool AMDTADLUtils::IsAvailable()
+{
+    return nullptr != GetEntrypointAddress(Sym);
+}
+
+template <ADLUtil_Entrypoint Sym, typename... Args>
+int AMDTADLUtils::Call(Args... args)
+{
+    typename ADLUtil_EntrypointTraits<Sym>::Type pEntrypoint = GetEntrypoint<Sym>();
+
+    if (nullptr == pEntrypoint)
+    {
+        return ADL_ERR_NOT_SUPPORTED;
+    }
+
+#ifdef ADL_UTIL_ENABLE_INSTRUMENTATION
+    uint64_t startNs = ADLUtil_GetTimestampNs();
+    int adlResult = pEntrypoint(args...);
+    ADLUtil_RecordCall(Sym, adlResult, startNs, ADLUtil_GetTimestampNs());
+    return adlResult;
+#else
+    return pEntrypoint(args...);
+#endif
+}
+
+#endif //_ADL_UTIL_ENTRYPOINTS_H_
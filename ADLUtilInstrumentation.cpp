@@ -0,0 +1,402 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Optional latency and call count instrumentation of the ADL entry points.
+//==============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+#include "ADLUtilEntrypoints.h"
+#include "ADLUtilInstrumentation.h"
+
+static constexpr uint32_t s_entrypointCount = static_cast<uint32_t>(ADLUtil_Entrypoint::Count);
+static constexpr uint32_t s_phaseCount = static_cast<uint32_t>(ADLUtil_Phase::Count);
+
+// Names of the ADLUtil_Phase values
+static const char* const s_phaseNames[] =
+{
+    "LoadAndInit",
+    "LoadLibrary",
+    "CreateContext",
+    "EnumerateAdapters",
+    "QueryVersionsInfo",
+    "ReadPersistentCache",
+    "RevalidatePersistentCache",
+};
+
+static_assert(sizeof(s_phaseNames) / sizeof(s_phaseNames[0]) == s_phaseCount, "a phase name is missing");
+
+bool ADLUtil_IsInstrumentationEnabled()
+{
+#ifdef ADL_UTIL_ENABLE_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+#ifdef ADL_UTIL_ENABLE_INSTRUMENTATION
+
+// Number of trace events each thread keeps; older events are overwritten
+static constexpr size_t s_traceCapacity = 2048;
+
+// Counters of one entry point or phase on one thread. Only the owning thread writes them, so they are
+// updated without atomic read-modify-write operations; the atomics only make the merge on read safe.
+struct ThreadCounters
+{
+    std::atomic<uint64_t> callCount{0};
+    std::atomic<uint64_t> errorCount{0};
+    std::atomic<uint64_t> warningCount{0};
+    std::atomic<uint64_t> totalNs{0};
+    std::atomic<uint64_t> maxNs{0};
+    std::atomic<uint64_t> latencyHistogram[ADLUTIL_LATENCY_BUCKET_COUNT] = {};
+};
+
+// One completed call or phase in the trace. The fields are atomic because an export may copy a slot while the owning
+// thread overwrites it; the export detects that and drops the slot.
+struct TraceEvent
+{
+    std::atomic<uint32_t> id{0};         ///< entry point index, or s_entrypointCount + phase index
+    std::atomic<int32_t>  result{0};     ///< the ADL return code of a call, 0 for a phase
+    std::atomic<uint64_t> startNs{0};    ///< start time
+    std::atomic<uint64_t> durationNs{0}; ///< duration
+};
+
+// A copy of a TraceEvent taken by an export
+struct TraceEventCopy
+{
+    uint32_t threadID;   ///< trace thread ID of the recording thread
+    uint32_t id;         ///< entry point index, or s_entrypointCount + phase index
+    int32_t  result;     ///< the ADL return code of a call, 0 for a phase
+    uint64_t startNs;    ///< start time
+    uint64_t durationNs; ///< duration
+};
+
+// Everything one thread records. Only the owning thread writes it, so recording neither locks nor uses atomic
+// read-modify-write operations. When the thread exits the state is given back and reused by the next new thread,
+// so the states are bounded by the number of concurrent threads while the counts of exited threads are kept.
+struct ThreadState
+{
+    uint32_t              threadID = 0;                               ///< trace thread ID; threads that reuse the state share it
+    ThreadCounters        counters[s_entrypointCount + s_phaseCount]; ///< entry points, then phases
+    TraceEvent            trace[s_traceCapacity];                     ///< ring buffer of recent events
+    std::atomic<uint64_t> traceBegun{0};                              ///< events whose recording began
+    std::atomic<uint64_t> traceCount{0};                              ///< events recorded, the next one goes to trace[traceCount % s_traceCapacity]
+};
+
+// All thread states, in use or free. The states are never destroyed, so that their counts and events are not lost.
+struct ThreadRegistry
+{
+    std::mutex                                mutex;      ///< protects the members, only taken when a thread starts or exits and by exports
+    std::vector<std::unique_ptr<ThreadState>> threads;    ///< all states
+    std::vector<ThreadState*>                 freeStates; ///< states given back by exited threads
+};
+
+// The registry is never destroyed, so that calls made during static destruction, ie by the singleton's destructor, can still record
+static ThreadRegistry& GetThreadRegistry()
+{
+    static ThreadRegistry* s_pRegistry = new ThreadRegistry();
+    return *s_pRegistry;
+}
+
+// The state of the calling thread. It is trivially initialized, so recording pays no thread_local initialization check.
+static thread_local ThreadState* t_pThreadState = nullptr;
+
+// Set once the thread began destroying its thread_local objects, after which t_stateReleaser must not be touched again
+static thread_local bool t_isExiting = false;
+
+// Gives the state of a thread back to the registry when the thread exits
+class ThreadStateReleaser
+{
+public:
+    /// Makes sure the releaser is constructed, and so destroyed when the thread exits
+    void Arm() {}
+
+    ~ThreadStateReleaser()
+    {
+        t_isExiting = true;
+
+        if (nullptr != t_pThreadState)
+        {
+            ThreadRegistry& registry = GetThreadRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.freeStates.push_back(t_pThreadState);
+            t_pThreadState = nullptr;
+        }
+    }
+};
+
+static thread_local ThreadStateReleaser t_stateReleaser;
+
+// Returns the state of the calling thread, taking a free one or registering a new one on first use
+static ThreadState& GetThreadState()
+{
+    if (nullptr == t_pThreadState)
+    {
+        ThreadRegistry& registry = GetThreadRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        if (!registry.freeStates.empty())
+        {
+            t_pThreadState = registry.freeStates.back();
+            registry.freeStates.pop_back();
+        }
+        else
+        {
+            registry.threads.push_back(std::make_unique<ThreadState>());
+            t_pThreadState = registry.threads.back().get();
+            t_pThreadState->threadID = static_cast<uint32_t>(registry.threads.size());
+        }
+
+        // a call recorded while the thread destroys its thread_local objects keeps the state for good
+        if (!t_isExiting)
+        {
+            t_stateReleaser.Arm();
+        }
+    }
+
+    return *t_pThreadState;
+}
+
+// Increments a counter that only the calling thread writes
+static void AddOwned(std::atomic<uint64_t>& counter, uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+static void Record(uint32_t id, int adlResult, uint64_t startNs, uint64_t endNs)
+{
+    ThreadState&    threadState = GetThreadState();
+    ThreadCounters& counters = threadState.counters[id];
+    uint64_t        durationNs = (endNs > startNs) ? endNs - startNs : 0;
+
+    uint32_t bucket = 0;
+
+    for (uint64_t ns = durationNs; 1 < ns && ADLUTIL_LATENCY_BUCKET_COUNT - 1 > bucket; ns >>= 1)
+    {
+        ++bucket;
+    }
+
+    AddOwned(counters.callCount, 1);
+    AddOwned(counters.totalNs, durationNs);
+    AddOwned(counters.latencyHistogram[bucket], 1);
+
+    if (ADL_OK > adlResult)
+    {
+        AddOwned(counters.errorCount, 1);
+    }
+    else if (ADL_OK_WARNING == adlResult)
+    {
+        AddOwned(counters.warningCount, 1);
+    }
+
+    if (durationNs > counters.maxNs.load(std::memory_order_relaxed))
+    {
+        counters.maxNs.store(durationNs, std::memory_order_relaxed);
+    }
+
+    // a sequence lock over the ring: traceBegun is advanced before the slot is overwritten and traceCount after,
+    // so an export can tell which of the slots it copied were overwritten meanwhile
+    uint64_t    traceIndex = threadState.traceCount.load(std::memory_order_relaxed);
+    TraceEvent& event = threadState.trace[traceIndex % s_traceCapacity];
+
+    threadState.traceBegun.store(traceIndex + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    event.id.store(id, std::memory_order_relaxed);
+    event.result.store(adlResult, std::memory_order_relaxed);
+    event.startNs.store(startNs, std::memory_order_relaxed);
+    event.durationNs.store(durationNs, std::memory_order_relaxed);
+    threadState.traceCount.store(traceIndex + 1, std::memory_order_release);
+}
+
+// Copies the recorded events of a thread that were not overwritten while they were copied
+static void CopyTrace(const ThreadState& threadState, std::vector<TraceEventCopy>& events)
+{
+    uint64_t traceCount = threadState.traceCount.load(std::memory_order_acquire);
+    uint64_t first = (s_traceCapacity < traceCount) ? traceCount - s_traceCapacity : 0;
+    size_t   firstCopied = events.size();
+
+    for (uint64_t i = first; i < traceCount; ++i)
+    {
+        const TraceEvent& event = threadState.trace[i % s_traceCapacity];
+        events.push_back({threadState.threadID, event.id.load(std::memory_order_relaxed), event.result.load(std::memory_order_relaxed),
+                          event.startNs.load(std::memory_order_relaxed), event.durationNs.load(std::memory_order_relaxed)});
+    }
+
+    // the slots of events older than traceBegun - s_traceCapacity may have been overwritten during the copy
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t traceBegun = threadState.traceBegun.load(std::memory_order_relaxed);
+    uint64_t firstValid = (s_traceCapacity < traceBegun) ? traceBegun - s_traceCapacity : 0;
+
+    if (firstValid > first)
+    {
+        size_t overwrittenCount = static_cast<size_t>(std::min(firstValid - first, traceCount - first));
+        events.erase(events.begin() + firstCopied, events.begin() + firstCopied + overwrittenCount);
+    }
+}
+
+void ADLUtil_RecordCall(ADLUtil_Entrypoint entrypoint, int adlResult, uint64_t startNs, uint64_t endNs)
+{
+    Record(static_cast<uint32_t>(entrypoint), adlResult, startNs, endNs);
+}
+
+void ADLUtil_RecordPhase(ADLUtil_Phase phase, uint64_t startNs, uint64_t endNs)
+{
+    Record(s_entrypointCount + static_cast<uint32_t>(phase), ADL_OK, startNs, endNs);
+}
+
+#endif // ADL_UTIL_ENABLE_INSTRUMENTATION
+
+// Returns the name of an entry point or phase by its index in the per-thread counters
+static const char* GetRecordName(uint32_t id)
+{
+    return (s_entrypointCount > id) ? ADLUtil_GetEntrypointName(static_cast<ADLUtil_Entrypoint>(id)) : s_phaseNames[id - s_entrypointCount];
+}
+
+void ADLUtil_GetInstrumentationSnapshot(ADLUtil_InstrumentationSnapshot& snapshot)
+{
+    std::vector<ADLUtil_CallStats> stats(s_entrypointCount + s_phaseCount);
+
+    for (uint32_t id = 0; id < stats.size(); ++id)
+    {
+        stats[id].name = GetRecordName(id);
+    }
+
+    snapshot.droppedTraceEvents = 0;
+    snapshot.threadStateCount = 0;
+
+#ifdef ADL_UTIL_ENABLE_INSTRUMENTATION
+    ThreadRegistry& registry = GetThreadRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    snapshot.threadStateCount = static_cast<uint32_t>(registry.threads.size());
+
+    for (const std::unique_ptr<ThreadState>& threadState : registry.threads)
+    {
+        for (uint32_t id = 0; id < stats.size(); ++id)
+        {
+            const ThreadCounters& counters = threadState->counters[id];
+            ADLUtil_CallStats&    sum = stats[id];
+
+            sum.callCount += counters.callCount.load(std::memory_order_relaxed);
+            sum.errorCount += counters.errorCount.load(std::memory_order_relaxed);
+            sum.warningCount += counters.warningCount.load(std::memory_order_relaxed);
+            sum.totalNs += counters.totalNs.load(std::memory_order_relaxed);
+            sum.maxNs = std::max(sum.maxNs, counters.maxNs.load(std::memory_order_relaxed));
+
+            for (uint32_t bucket = 0; bucket < ADLUTIL_LATENCY_BUCKET_COUNT; ++bucket)
+            {
+                sum.latencyHistogram[bucket] += counters.latencyHistogram[bucket].load(std::memory_order_relaxed);
+            }
+        }
+
+        uint64_t traceCount = threadState->traceCount.load(std::memory_order_acquire);
+        snapshot.droppedTraceEvents += (s_traceCapacity < traceCount) ? traceCount - s_traceCapacity : 0;
+    }
+#endif
+
+    snapshot.entrypoints.assign(stats.begin(), stats.begin() + s_entrypointCount);
+    snapshot.phases.assign(stats.begin() + s_entrypointCount, stats.end());
+}
+
+// Writes the counters of the entry points or phases that were called as a JSON array
+static void WriteStatsArray(std::ostream& out, const std::vector<ADLUtil_CallStats>& stats)
+{
+    const char* pSeparator = "";
+    out << "[";
+
+    for (const ADLUtil_CallStats& callStats : stats)
+    {
+        if (0 == callStats.callCount)
+        {
+            continue;
+        }
+
+        out << pSeparator << "\n    {\"name\": \"" << callStats.name << "\", \"callCount\": " << callStats.callCount
+            << ", \"errorCount\": " << callStats.errorCount << ", \"warningCount\": " << callStats.warningCount
+            << ", \"totalNs\": " << callStats.totalNs << ", \"maxNs\": " << callStats.maxNs << ", \"latencyHistogram\": [";
+
+        for (uint32_t bucket = 0; bucket < ADLUTIL_LATENCY_BUCKET_COUNT; ++bucket)
+        {
+            out << ((0 == bucket) ? "" : ", ") << callStats.latencyHistogram[bucket];
+        }
+
+        out << "]}";
+        pSeparator = ",";
+    }
+
+    out << "\n  ]";
+}
+
+bool ADLUtil_WriteChromeTrace(const std::string& path)
+{
+    std::ofstream out(path, std::ios::trunc);
+
+    if (!out)
+    {
+        return false;
+    }
+
+    out.setf(std::ios::fixed);
+    out.precision(3);
+    out << "{\n\"traceEvents\": [";
+
+#ifdef ADL_UTIL_ENABLE_INSTRUMENTATION
+    // copy the events out while the threads keep recording, then format them
+    std::vector<TraceEventCopy> events;
+
+    {
+        ThreadRegistry& registry = GetThreadRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        for (const std::unique_ptr<ThreadState>& threadState : registry.threads)
+        {
+            CopyTrace(*threadState, events);
+        }
+    }
+
+    // timestamps are relative to the earliest event to keep them short
+    uint64_t baseNs = UINT64_MAX;
+
+    for (const TraceEventCopy& event : events)
+    {
+        baseNs = std::min(baseNs, event.startNs);
+    }
+
+    const char* pSeparator = "";
+
+    for (const TraceEventCopy& event : events)
+    {
+        bool isEntrypoint = s_entrypointCount > event.id;
+
+        out << pSeparator << "\n{\"name\": \"" << GetRecordName(event.id) << "\", \"cat\": \"" << (isEntrypoint ? "entrypoint" : "phase")
+            << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << event.threadID
+            << ", \"ts\": " << static_cast<double>(event.startNs - baseNs) / 1000.0
+            << ", \"dur\": " << static_cast<double>(event.durationNs) / 1000.0;
+
+        if (isEntrypoint)
+        {
+            out << ", \"args\": {\"result\": " << event.result << "}";
+        }
+
+        out << "}";
+        pSeparator = ",";
+    }
+#endif
+
+    ADLUtil_InstrumentationSnapshot snapshot;
+    ADLUtil_GetInstrumentationSnapshot(snapshot);
+
+    out << "\n],\n\"displayTimeUnit\": \"ns\",\n\"adlUtilStats\": {\n  \"droppedTraceEvents\": " << snapshot.droppedTraceEvents
+        << ",\n  \"threadStateCount\": " << snapshot.threadStateCount << ",\n  \"entrypoints\": ";
+    WriteStatsArray(out, snapshot.entrypoints);
+    out << ",\n  \"phases\": ";
+    WriteStatsArray(out, snapshot.phases);
+    out << "\n}\n}\n";
+
+    return out.good();
+}
@@ -0,0 +1,122 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Optional latency and call count instrumentation of the ADL entry points.
+//==============================================================================
+
+#ifndef _ADL_UTIL_INSTRUMENTATION_H_
+#define _ADL_UTIL_INSTRUMENTATION_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef ADL_UTIL_ENABLE_INSTRUMENTATION
+#include <chrono>
+#endif
+
+enum class ADLUtil_Entrypoint : uint32_t;
+
+/// Number of buckets of the latency histograms. Bucket i counts latencies in [2^i, 2^(i+1)) nanoseconds,
+/// and the last bucket also counts everything longer.
+constexpr uint32_t ADLUTIL_LATENCY_BUCKET_COUNT = 36;
+
+/// Timed stretches of work inside ADLUtil that are not single ADL calls
+enum class ADLUtil_Phase : uint32_t
+{
+    LoadAndInit,               ///< loading ADL and creating the context
+    LoadLibrary,               ///< loading the ADL library
+    CreateContext,             ///< ADL_Main_Control_Create or ADL2_Main_Control_Create
+    EnumerateAdapters,         ///< querying and parsing the adapter list
+    QueryVersionsInfo,         ///< querying the driver versions
+    ReadPersistentCache,       ///< reading the persistent cache file
+    RevalidatePersistentCache, ///< revalidating the persistent cache file against the driver
+    Count                      ///< number of phases
+};
+
+/// Counters of one ADL entry point or phase, summed over all threads
+struct ADLUtil_CallStats
+{
+    std::string name;                                                ///< the entry point or phase name
+    uint64_t    callCount    = 0;                                    ///< number of completed calls
+    uint64_t    errorCount   = 0;                                    ///< calls that returned an ADL error code
+    uint64_t    warningCount = 0;                                    ///< calls that returned ADL_OK_WARNING
+    uint64_t    totalNs      = 0;                                    ///< summed latency in nanoseconds
+    uint64_t    maxNs        = 0;                                    ///< longest latency in nanoseconds
+    uint64_t    latencyHistogram[ADLUTIL_LATENCY_BUCKET_COUNT] = {}; ///< log2 bucketed latencies
+};
+
+/// The instrumentation counters at one point in time
+struct ADLUtil_InstrumentationSnapshot
+{
+    std::vector<ADLUtil_CallStats> entrypoints;            ///< indexed by ADLUtil_Entrypoint
+    std::vector<ADLUtil_CallStats> phases;                 ///< indexed by ADLUtil_Phase
+    uint64_t                       droppedTraceEvents = 0; ///< trace events overwritten before they were exported
+    uint32_t                       threadStateCount   = 0; ///< per-thread recording states; exited threads give theirs to new ones
+};
+
+/// @returns true if ADLUtil was built with ADL_UTIL_ENABLE_INSTRUMENTATION. Otherwise all counters stay 0 and the trace has no events.
+bool ADLUtil_IsInstrumentationEnabled();
+
+/// Merges the counters of all threads
+/// @param[out] snapshot the summed counters
+void ADLUtil_GetInstrumentationSnapshot(ADLUtil_InstrumentationSnapshot& snapshot);
+
+/// Writes the recent ADL calls and phases of every thread as a Chrome trace (chrome://tracing, Perfetto),
+/// with the counters of the snapshot in the "adlUtilStats" member
+/// @param[in] path the path of the JSON file
+/// @returns   true if the file was written.
+bool ADLUtil_WriteChromeTrace(const std::string& path);
+
+#ifdef ADL_UTIL_ENABLE_INSTRUMENTATION
+
+/// @returns the instrumentation clock in nanoseconds.
+inline uint64_t ADLUtil_GetTimestampNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/// Records a completed ADL call in the counters and the trace of the calling thread
+void ADLUtil_RecordCall(ADLUtil_Entrypoint entrypoint, int adlResult, uint64_t startNs, uint64_t endNs);
+
+/// Records a completed phase in the counters and the trace of the calling thread
+void ADLUtil_RecordPhase(ADLUtil_Phase phase, uint64_t startNs, uint64_t endNs);
+
+/// Times the enclosing scope as a phase
+class ADLUtil_PhaseScope
+{
+public:
+    explicit ADLUtil_PhaseScope(ADLUtil_Phase phase) :
+        m_phase(phase),
+        m_startNs(ADLUtil_GetTimestampNs())
+    {
+    }
+
+    ~ADLUtil_PhaseScope()
+    {
+        ADLUtil_RecordPhase(m_phase, m_startNs, ADLUtil_GetTimestampNs());
+    }
+
+    ADLUtil_PhaseScope(const ADLUtil_PhaseScope&) = delete;
+    ADLUtil_PhaseScope& operator=(const ADLUtil_PhaseScope&) = delete;
+
+private:
+    ADLUtil_Phase m_phase;   ///< the timed phase
+    uint64_t      m_startNs; ///< start of the phase
+};
+
+#define ADLUTIL_CONCAT_INNER(A, B) A##B
+#define ADLUTIL_CONCAT(A, B)       ADLUTIL_CONCAT_INNER(A, B)
+
+/// Times the rest of the enclosing scope as the given ADLUtil_Phase
+#define ADLUTIL_PHASE_SCOPE(PHASE) ADLUtil_PhaseScope ADLUTIL_CONCAT(adlUtilPhaseScope, __LINE__)(ADLUtil_Phase::PHASE)
+
+#else
+
+/// Instrumentation is disabled, phases are not timed
+#define ADLUTIL_PHASE_SCOPE(PHASE)
+
+#endif // ADL_UTIL_ENABLE_INSTRUMENTATION
+
+#endif //_ADL_UTIL_INSTRUMENTATION_H_
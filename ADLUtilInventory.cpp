@@ -0,0 +1,233 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Compact binary inventory records of the adapters and the driver of a host, for collecting them across a fleet.
+//==============================================================================
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+#include "ADLUtilInventory.h"
+
+// Size of the part of the header that must be present to frame a record
+static constexpr size_t s_minHeaderSize = offsetof(ADLUtil_InventoryHeader, adapterCount) + sizeof(uint32_t);
+
+// More adapters than this in one record means the stream is corrupt, and reading on would only waste memory
+static constexpr uint32_t s_maxAdapterCount = 4096;
+
+// 64 bit FNV-1a hash, continuing from hash
+static uint64_t HashBytes(uint64_t hash, const void* pData, size_t size)
+{
+    const unsigned char* pBytes = static_cast<const unsigned char*>(pData);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= pBytes[i];
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+// Hashes a fixed size string field up to its terminator
+template <size_t size>
+static uint64_t HashField(uint64_t hash, const char (&field)[size])
+{
+    return HashBytes(hash, field, strnlen(field, size));
+}
+
+// Copies a string into a fixed size, NUL-terminated and zero-padded field
+template <size_t size>
+static void CopyField(char (&dest)[size], std::string_view src)
+{
+    memset(dest, 0, size);
+    memcpy(dest, src.data(), std::min(src.size(), size - 1));
+}
+
+// Terminates a fixed size field that may not be NUL-terminated if the file was tampered with
+template <size_t size>
+static void TerminateField(char (&field)[size])
+{
+    field[size - 1] = '\0';
+}
+
+// Reads a structure written with a different size: the common prefix is kept, the rest of the structure is zeroed
+// and the trailing bytes of a larger one are skipped
+static bool ReadSized(FILE* pFile, void* pDest, size_t destSize, size_t writtenSize)
+{
+    size_t copySize = std::min(destSize, writtenSize);
+
+    memset(static_cast<char*>(pDest) + copySize, 0, destSize - copySize);
+
+    if (copySize != fread(pDest, 1, copySize, pFile))
+    {
+        return false;
+    }
+
+    char skipBuffer[256];
+
+    for (size_t remaining = writtenSize - copySize; 0 < remaining;)
+    {
+        size_t chunkSize = std::min(remaining, sizeof(skipBuffer));
+
+        if (chunkSize != fread(skipBuffer, 1, chunkSize, pFile))
+        {
+            return false;
+        }
+
+        remaining -= chunkSize;
+    }
+
+    return true;
+}
+
+void ADLUtil_BuildInventoryRecord(const std::string& hostName, const AsicInfoList& asicInfoList, const ADLUtil_VersionsInfo& versionsInfo, ADLUtil_InventoryRecord& record)
+{
+    ADLUtil_InventoryHeader& header = record.header;
+    ADLUtil_DriverVersion    driverVersion = ADLUtil_DriverVersion::FromString(versionsInfo.driverVersion);
+
+    memset(&header, 0, sizeof(header));
+    header.magic = ADLUTIL_INVENTORY_MAGIC;
+    header.formatVersion = ADLUTIL_INVENTORY_FORMAT_VERSION;
+    header.headerSize = sizeof(ADLUtil_InventoryHeader);
+    header.adapterSize = sizeof(ADLUtil_InventoryAdapter);
+    header.adapterCount = static_cast<uint32_t>(asicInfoList.size());
+    header.majorVer = driverVersion.majorVer;
+    header.minorVer = driverVersion.minorVer;
+    header.subMinorVer = driverVersion.subMinorVer;
+    header.buildVer = driverVersion.buildVer;
+    header.buildDate = driverVersion.buildDate;
+    header.changelist = driverVersion.changelist;
+    header.buildDateRevision = driverVersion.buildDateRevision;
+    CopyField(header.hostName, hostName);
+    CopyField(header.driverVersion, versionsInfo.driverVersion);
+    CopyField(header.catalystVersion, versionsInfo.catalystVersion);
+
+    record.adapters.resize(asicInfoList.size());
+
+    for (size_t i = 0; i < asicInfoList.size(); ++i)
+    {
+        const ADLUtil_ASICInfo&   asicInfo = asicInfoList[i];
+        ADLUtil_InventoryAdapter& adapter = record.adapters[i];
+
+        memset(&adapter, 0, sizeof(adapter));
+        adapter.vendorID = asicInfo.vendorID;
+        adapter.deviceID = asicInfo.deviceID;
+        adapter.revID = asicInfo.revID;
+        adapter.subsystemID = asicInfo.subsystemID;
+        adapter.pciDomain = asicInfo.topology.pciDomain;
+        adapter.busNumber = asicInfo.busNumber;
+        adapter.deviceNumber = asicInfo.deviceNumber;
+        adapter.functionNumber = asicInfo.functionNumber;
+        adapter.gpuIndex = asicInfo.gpuIndex;
+        adapter.adapterIndex = asicInfo.adapterIndex;
+        adapter.generation = static_cast<uint8_t>(asicInfo.generation);
+        adapter.asicMatch = static_cast<uint8_t>(asicInfo.asicMatch);
+        adapter.maxLinkWidth = static_cast<uint16_t>(asicInfo.topology.maxLinkWidth);
+        adapter.maxLinkSpeedMTs = asicInfo.topology.maxLinkSpeedMTs;
+        adapter.numaNode = asicInfo.topology.numaNode;
+        CopyField(adapter.family, asicInfo.family);
+        CopyField(adapter.adapterName, asicInfo.adapterName);
+    }
+}
+
+bool ADLUtil_WriteInventoryRecord(FILE* pFile, const ADLUtil_InventoryRecord& record)
+{
+    // written in one call so that records appended by concurrent writers do not interleave
+    std::vector<char> image(sizeof(ADLUtil_InventoryHeader) + record.adapters.size() * sizeof(ADLUtil_InventoryAdapter));
+
+    ADLUtil_InventoryHeader header = record.header;
+    header.adapterCount = static_cast<uint32_t>(record.adapters.size());
+
+    memcpy(image.data(), &header, sizeof(header));
+
+    if (!record.adapters.empty())
+    {
+        memcpy(image.data() + sizeof(header), record.adapters.data(), record.adapters.size() * sizeof(ADLUtil_InventoryAdapter));
+    }
+
+    return image.size() == fwrite(image.data(), 1, image.size(), pFile);
+}
+
+bool ADLUtil_ReadInventoryRecord(FILE* pFile, ADLUtil_InventoryRecord& record)
+{
+    ADLUtil_InventoryHeader& header = record.header;
+
+    // the sizes come first, so read them before the rest of the header
+    if (s_minHeaderSize != fread(&header, 1, s_minHeaderSize, pFile) || ADLUTIL_INVENTORY_MAGIC != header.magic ||
+        s_minHeaderSize > header.headerSize || 0 == header.adapterSize || s_maxAdapterCount < header.adapterCount)
+    {
+        return false;
+    }
+
+    if (!ReadSized(pFile, reinterpret_cast<char*>(&header) + s_minHeaderSize, sizeof(header) - s_minHeaderSize, header.headerSize - s_minHeaderSize))
+    {
+        return false;
+    }
+
+    TerminateField(header.hostName);
+    TerminateField(header.driverVersion);
+    TerminateField(header.catalystVersion);
+
+    record.adapters.resize(header.adapterCount);
+
+    if (sizeof(ADLUtil_InventoryAdapter) == header.adapterSize)
+    {
+        // the common case: the adapters are read in one go
+        if (header.adapterCount != fread(record.adapters.data(), sizeof(ADLUtil_InventoryAdapter), header.adapterCount, pFile))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        for (ADLUtil_InventoryAdapter& adapter : record.adapters)
+        {
+            if (!ReadSized(pFile, &adapter, sizeof(adapter), header.adapterSize))
+            {
+                return false;
+            }
+        }
+    }
+
+    for (ADLUtil_InventoryAdapter& adapter : record.adapters)
+    {
+        TerminateField(adapter.family);
+        TerminateField(adapter.adapterName);
+    }
+
+    return true;
+}
+
+uint64_t ADLUtil_HashInventoryConfiguration(const ADLUtil_InventoryRecord& record)
+{
+    uint64_t hash = HashField(0xcbf29ce484222325ull, record.header.driverVersion);
+
+    for (const ADLUtil_InventoryAdapter& adapter : record.adapters)
+    {
+        // hash the identifying fields one by one, so that neither padding nor the bus location contributes
+        const uint32_t identity[] = {static_cast<uint32_t>(adapter.vendorID), static_cast<uint32_t>(adapter.deviceID), static_cast<uint32_t>(adapter.revID),
+                                     adapter.subsystemID, adapter.maxLinkWidth, adapter.maxLinkSpeedMTs};
+
+        hash = HashBytes(hash, identity, sizeof(identity));
+        hash = HashField(hash, adapter.adapterName);
+    }
+
+    return hash;
+}
+
+ADLUtil_DriverVersion ADLUtil_GetInventoryDriverVersion(const ADLUtil_InventoryHeader& header)
+{
+    ADLUtil_DriverVersion driverVersion;
+    driverVersion.majorVer = header.majorVer;
+    driverVersion.minorVer = header.minorVer;
+    driverVersion.subMinorVer = header.subMinorVer;
+    driverVersion.buildVer = header.buildVer;
+    driverVersion.buildDate = header.buildDate;
+    driverVersion.buildDateRevision = header.buildDateRevision;
+    driverVersion.changelist = header.changelist;
+    return driverVersion;
+}
@@ -0,0 +1,112 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Compact binary inventory records of the adapters and the driver of a host, for collecting them across a fleet.
+//==============================================================================
+
+#ifndef _ADL_UTIL_INVENTORY_H_
+#define _ADL_UTIL_INVENTORY_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "ADLUtilTypes.h"
+
+/// Identifies an adl_util inventory record ("ADLI")
+constexpr uint32_t ADLUTIL_INVENTORY_MAGIC = 0x494C4441;
+
+/// Version of the inventory record layout. Fields are only ever appended to ADLUtil_InventoryHeader and ADLUtil_InventoryAdapter;
+/// bump this whenever they change.
+constexpr uint32_t ADLUTIL_INVENTORY_FORMAT_VERSION = 1;
+
+/// Fixed-size header of an inventory record, followed directly by adapterCount ADLUtil_InventoryAdapter entries.
+/// Records are self-sized and can be concatenated, so a file holds any number of them.
+struct ADLUtil_InventoryHeader
+{
+    uint32_t magic;                  ///< ADLUTIL_INVENTORY_MAGIC
+    uint32_t formatVersion;          ///< ADLUTIL_INVENTORY_FORMAT_VERSION of the writer
+    uint32_t headerSize;             ///< sizeof(ADLUtil_InventoryHeader) of the writer, newer writers may append fields
+    uint32_t adapterSize;            ///< sizeof(ADLUtil_InventoryAdapter) of the writer, newer writers may append fields
+    uint32_t adapterCount;           ///< number of ADLUtil_InventoryAdapter entries following the header
+    int32_t  asicInfoResult;         ///< the ADLUtil_Result of the enumeration
+    int32_t  versionsResult;         ///< the ADLUtil_Result of the driver version query
+    uint32_t reserved;               ///< padding, always 0
+    uint64_t timestamp;              ///< when the record was taken, in seconds since the Unix epoch
+    uint64_t loadNs;                 ///< time to load ADL and create the context
+    uint64_t enumerationNs;          ///< time to enumerate the adapters
+    uint64_t versionsNs;             ///< time to query the driver version
+    uint32_t majorVer;               ///< ADLUtil_DriverVersion::majorVer
+    uint32_t minorVer;               ///< ADLUtil_DriverVersion::minorVer
+    uint32_t subMinorVer;            ///< ADLUtil_DriverVersion::subMinorVer
+    uint32_t buildVer;               ///< ADLUtil_DriverVersion::buildVer
+    uint32_t buildDate;              ///< ADLUtil_DriverVersion::buildDate
+    uint32_t changelist;             ///< ADLUtil_DriverVersion::changelist
+    char     buildDateRevision;      ///< ADLUtil_DriverVersion::buildDateRevision
+    char     reserved2[7];           ///< padding, always 0
+    char     hostName[64];           ///< NUL-terminated host name, truncated
+    char     driverVersion[64];      ///< NUL-terminated driver version string, truncated
+    char     catalystVersion[32];    ///< NUL-terminated Catalyst/Radeon Software version, truncated
+};
+
+/// Fixed-size inventory form of an ADLUtil_ASICInfo
+struct ADLUtil_InventoryAdapter
+{
+    int32_t  vendorID;        ///< the vendor ID
+    int32_t  deviceID;        ///< the device ID
+    int32_t  revID;           ///< the revision ID
+    uint32_t subsystemID;     ///< the subsystem ID
+    int32_t  pciDomain;       ///< the PCI domain
+    int32_t  busNumber;       ///< the PCI bus number
+    int32_t  deviceNumber;    ///< the PCI device number
+    int32_t  functionNumber;  ///< the PCI function number
+    uint32_t gpuIndex;        ///< GPU index in the system
+    int32_t  adapterIndex;    ///< the ADL adapter index
+    uint8_t  generation;      ///< the ADLUtil_ASICGeneration
+    uint8_t  asicMatch;       ///< the ADLUtil_ASICMatch
+    uint16_t maxLinkWidth;    ///< maximum number of PCIe lanes, 0 if unknown
+    uint32_t maxLinkSpeedMTs; ///< maximum PCIe link speed in MT/s per lane, 0 if unknown
+    int32_t  numaNode;        ///< the NUMA node closest to the adapter, -1 if unknown
+    char     family[32];      ///< NUL-terminated ASIC family, truncated
+    char     adapterName[64]; ///< NUL-terminated adapter name, truncated
+};
+
+/// One inventory record in memory
+struct ADLUtil_InventoryRecord
+{
+    ADLUtil_InventoryHeader               header;   ///< the record header
+    std::vector<ADLUtil_InventoryAdapter> adapters; ///< the adapters, header.adapterCount of them
+};
+
+/// Builds an inventory record from the results of the ADLUtil queries
+/// @param[in]  hostName     the host name
+/// @param[in]  asicInfoList the adapters
+/// @param[in]  versionsInfo the driver version strings
+/// @param[out] record       the record; the results and the timings are left 0 for the caller to fill
+void ADLUtil_BuildInventoryRecord(const std::string& hostName, const AsicInfoList& asicInfoList, const ADLUtil_VersionsInfo& versionsInfo, ADLUtil_InventoryRecord& record);
+
+/// Appends an inventory record to a file
+/// @param[in] pFile  the file, opened in binary mode
+/// @param[in] record the record
+/// @returns   true if the record was written.
+bool ADLUtil_WriteInventoryRecord(FILE* pFile, const ADLUtil_InventoryRecord& record);
+
+/// Reads the next inventory record of a file. Fields a newer writer appended are skipped, fields an older writer did not write are 0.
+/// @param[in]  pFile  the file, opened in binary mode
+/// @param[out] record the record; its adapter storage is reused, so reading a stream into one record does not allocate once it is warm
+/// @returns    true if a record was read, false at the end of the file or if the file is not a valid inventory.
+bool ADLUtil_ReadInventoryRecord(FILE* pFile, ADLUtil_InventoryRecord& record);
+
+/// Hashes the configuration an inventory record describes: the driver version and the IDs, names and links of the adapters.
+/// The host, the time, the timings and where the adapters sit on the bus do not contribute, so identical machines hash alike.
+/// @param[in] record the record
+/// @returns   the FNV-1a hash of the configuration.
+uint64_t ADLUtil_HashInventoryConfiguration(const ADLUtil_InventoryRecord& record);
+
+/// @param[in] header the header of an inventory record
+/// @returns   the parsed driver version of the record.
+ADLUtil_DriverVersion ADLUtil_GetInventoryDriverVersion(const ADLUtil_InventoryHeader& header);
+
+#endif //_ADL_UTIL_INVENTORY_H_
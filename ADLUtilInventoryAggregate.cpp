@@ -0,0 +1,278 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  adl_util_inventory_aggregate: streams inventory files, dedupes identical configurations and
+///         prints an index of the adapters by device, revision and driver version.
+//==============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ADLUtilInventory.h"
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+/// Size of the stdio buffer of each input; large reads keep the aggregation from being bound by system calls
+static constexpr size_t s_inputBufferSize = 1 << 20;
+
+/// Key of the index
+struct IndexKey
+{
+    int32_t               vendorID;      ///< the vendor ID
+    int32_t               deviceID;      ///< the device ID
+    int32_t               revID;         ///< the revision ID
+    ADLUtil_DriverVersion driverVersion; ///< the parsed driver version
+
+    /// Orders the keys by vendor, device, revision and then driver version
+    bool operator<(const IndexKey& other) const
+    {
+        if (vendorID != other.vendorID)
+        {
+            return vendorID < other.vendorID;
+        }
+
+        if (deviceID != other.deviceID)
+        {
+            return deviceID < other.deviceID;
+        }
+
+        if (revID != other.revID)
+        {
+            return revID < other.revID;
+        }
+
+        return driverVersion < other.driverVersion;
+    }
+};
+
+/// Counters of one key of the index
+struct IndexEntry
+{
+    uint64_t    hosts = 0;          ///< records that have at least one adapter with the key
+    uint64_t    adapters = 0;       ///< adapters with the key over all records
+    uint64_t    configurations = 0; ///< distinct configurations that have an adapter with the key
+    std::string driverVersion;      ///< the driver version string of the first record with the key
+    std::string family;             ///< the ASIC family of the first adapter with the key
+};
+
+/// Totals over all records
+struct Totals
+{
+    uint64_t files = 0;            ///< inputs read
+    uint64_t records = 0;          ///< records read
+    uint64_t failedRecords = 0;    ///< records whose enumeration failed, left out of the index
+    uint64_t corruptFiles = 0;     ///< inputs that ended in a record that could not be read
+    uint64_t enumerationNs = 0;    ///< summed enumeration time
+    uint64_t maxEnumerationNs = 0; ///< longest enumeration time
+};
+
+/// The aggregation state. It grows with the number of distinct configurations and index keys, not with the number of records.
+struct Aggregation
+{
+    std::unordered_map<uint64_t, uint64_t> configurations; ///< records per configuration hash
+    std::map<IndexKey, IndexEntry>         index;          ///< the index
+    Totals                                 totals;         ///< totals over all records
+    FILE*                                  pUniqueFile = nullptr; ///< receives the first record of each configuration, may be nullptr
+};
+
+// Adds one record to the aggregation
+static void AddRecord(Aggregation& aggregation, const ADLUtil_InventoryRecord& record, std::vector<IndexEntry*>& recordEntries)
+{
+    Totals& totals = aggregation.totals;
+
+    ++totals.records;
+    totals.enumerationNs += record.header.enumerationNs;
+    totals.maxEnumerationNs = std::max(totals.maxEnumerationNs, record.header.enumerationNs);
+
+    if (ADL_SUCCESS != record.header.asicInfoResult && ADL_WARNING != record.header.asicInfoResult && ADL_STALE != record.header.asicInfoResult)
+    {
+        ++totals.failedRecords;
+        return;
+    }
+
+    bool isNewConfiguration = 0 == aggregation.configurations[ADLUtil_HashInventoryConfiguration(record)]++;
+
+    if (isNewConfiguration && nullptr != aggregation.pUniqueFile)
+    {
+        ADLUtil_WriteInventoryRecord(aggregation.pUniqueFile, record);
+    }
+
+    ADLUtil_DriverVersion driverVersion = ADLUtil_GetInventoryDriverVersion(record.header);
+
+    // a host with several identical GPUs counts once per key; records have few adapters, so a linear search is enough
+    recordEntries.clear();
+
+    for (const ADLUtil_InventoryAdapter& adapter : record.adapters)
+    {
+        IndexKey    key = {adapter.vendorID, adapter.deviceID, adapter.revID, driverVersion};
+        IndexEntry& entry = aggregation.index[key];
+
+        if (0 == entry.adapters)
+        {
+            entry.driverVersion = record.header.driverVersion;
+            entry.family = adapter.family;
+        }
+
+        ++entry.adapters;
+
+        if (recordEntries.end() == std::find(recordEntries.begin(), recordEntries.end(), &entry))
+        {
+            recordEntries.push_back(&entry);
+            ++entry.hosts;
+
+            if (isNewConfiguration)
+            {
+                ++entry.configurations;
+            }
+        }
+    }
+}
+
+// Streams the records of one input into the aggregation
+static bool AggregateFile(Aggregation& aggregation, const char* pPath)
+{
+    FILE* pFile = stdin;
+
+    if (0 != strcmp(pPath, "-"))
+    {
+        pFile = fopen(pPath, "rb");
+
+        if (nullptr == pFile)
+        {
+            fprintf(stderr, "adl_util_inventory_aggregate: cannot open %s\n", pPath);
+            return false;
+        }
+    }
+#ifdef _WIN32
+    else
+    {
+        _setmode(_fileno(stdin), _O_BINARY);
+    }
+#endif
+
+    setvbuf(pFile, nullptr, _IOFBF, s_inputBufferSize);
+
+    // the record and the scratch list are reused, so a warm aggregation does not allocate per record
+    ADLUtil_InventoryRecord  record;
+    std::vector<IndexEntry*> recordEntries;
+    uint64_t                 fileRecords = 0;
+
+    // a record may only start where the previous one ended, so anything unreadable after that is a truncated or invalid record
+    for (int nextByte = fgetc(pFile); EOF != nextByte; nextByte = fgetc(pFile))
+    {
+        ungetc(nextByte, pFile);
+
+        if (!ADLUtil_ReadInventoryRecord(pFile, record))
+        {
+            fprintf(stderr, "adl_util_inventory_aggregate: %s has a truncated or invalid record after record %llu\n", pPath,
+                    static_cast<unsigned long long>(fileRecords));
+            ++aggregation.totals.corruptFiles;
+            break;
+        }
+
+        AddRecord(aggregation, record, recordEntries);
+        ++fileRecords;
+    }
+
+    ++aggregation.totals.files;
+
+    if (stdin != pFile)
+    {
+        fclose(pFile);
+    }
+
+    return true;
+}
+
+static void PrintUsage()
+{
+    fprintf(stderr,
+            "usage: adl_util_inventory_aggregate [--unique path] file...\n"
+            "  --unique path  write the first record of each distinct configuration to path\n"
+            "  file           an inventory file written by adl_util_inventory, - for stdin\n");
+}
+
+int main(int argc, char* argv[])
+{
+    Aggregation              aggregation;
+    std::vector<const char*> inputs;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (0 == strcmp(argv[i], "--unique") && i + 1 < argc)
+        {
+            aggregation.pUniqueFile = fopen(argv[++i], "wb");
+
+            if (nullptr == aggregation.pUniqueFile)
+            {
+                fprintf(stderr, "adl_util_inventory_aggregate: cannot open %s\n", argv[i]);
+                return 1;
+            }
+        }
+        else if ('-' == argv[i][0] && '\0' != argv[i][1])
+        {
+            PrintUsage();
+            return 2;
+        }
+        else
+        {
+            inputs.push_back(argv[i]);
+        }
+    }
+
+    if (inputs.empty())
+    {
+        PrintUsage();
+        return 2;
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    int                                   exitCode = 0;
+
+    for (const char* pPath : inputs)
+    {
+        if (!AggregateFile(aggregation, pPath))
+        {
+            exitCode = 1;
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (nullptr != aggregation.pUniqueFile && 0 != fclose(aggregation.pUniqueFile))
+    {
+        fprintf(stderr, "adl_util_inventory_aggregate: cannot write the unique configurations\n");
+        exitCode = 1;
+    }
+
+    printf("vendorID\tdeviceID\trevID\tdriverVersion\tfamily\thosts\tadapters\tconfigurations\n");
+
+    for (const std::pair<const IndexKey, IndexEntry>& item : aggregation.index)
+    {
+        printf("%04X\t%04X\t%02X\t%s\t%s\t%llu\t%llu\t%llu\n", static_cast<unsigned int>(item.first.vendorID), static_cast<unsigned int>(item.first.deviceID),
+               static_cast<unsigned int>(item.first.revID), item.second.driverVersion.c_str(), item.second.family.c_str(),
+               static_cast<unsigned long long>(item.second.hosts), static_cast<unsigned long long>(item.second.adapters),
+               static_cast<unsigned long long>(item.second.configurations));
+    }
+
+    const Totals& totals = aggregation.totals;
+    fprintf(stderr, "%llu records in %llu files, %llu failed, %llu distinct configurations, %llu corrupt files\n",
+            static_cast<unsigned long long>(totals.records), static_cast<unsigned long long>(totals.files),
+            static_cast<unsigned long long>(totals.failedRecords), static_cast<unsigned long long>(aggregation.configurations.size()),
+            static_cast<unsigned long long>(totals.corruptFiles));
+    fprintf(stderr, "enumeration mean %.3f ms, max %.3f ms; %.0f records/s\n",
+            (0 < totals.records) ? static_cast<double>(totals.enumerationNs) / static_cast<double>(totals.records) / 1e6 : 0.0,
+            static_cast<double>(totals.maxEnumerationNs) / 1e6, (0.0 < seconds) ? static_cast<double>(totals.records) / seconds : 0.0);
+
+    return (0 == exitCode && 0 == totals.corruptFiles) ? 0 : 1;
+}
@@ -0,0 +1,157 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  adl_util_inventory: appends an inventory record of this host to a file or writes it to stdout.
+//==============================================================================
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <string>
+
+#include "ADLUtil.h"
+#include "ADLUtilInventory.h"
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <Windows.h>
+#else
+#include <unistd.h>
+#endif
+
+// Returns the host name, empty if it cannot be determined
+static std::string GetHostName()
+{
+    char hostName[256] = {};
+
+#ifdef _WIN32
+    DWORD size = sizeof(hostName);
+
+    if (FALSE == GetComputerNameA(hostName, &size))
+    {
+        return std::string();
+    }
+#else
+    if (0 != gethostname(hostName, sizeof(hostName) - 1))
+    {
+        return std::string();
+    }
+#endif
+
+    return hostName;
+}
+
+// Returns the nanoseconds elapsed since start
+static uint64_t GetElapsedNs(std::chrono::steady_clock::time_point start)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+static void PrintUsage()
+{
+    fprintf(stderr,
+            "usage: adl_util_inventory [--sysfs [root]] [--output path]\n"
+            "  --sysfs [root]  enumerate from the sysfs tree at root (default /sys) instead of loading ADL\n"
+            "  --output path   append the record to path instead of writing it to stdout\n");
+}
+
+int main(int argc, char* argv[])
+{
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+    std::string   outputPath;
+    bool          useSysfs = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (0 == strcmp(argv[i], "--sysfs"))
+        {
+            useSysfs = true;
+
+            if (i + 1 < argc && '-' != argv[i + 1][0])
+            {
+                pADLUtils->SetSysfsRoot(argv[++i]);
+            }
+        }
+        else if (0 == strcmp(argv[i], "--output") && i + 1 < argc)
+        {
+            outputPath = argv[++i];
+        }
+        else
+        {
+            PrintUsage();
+            return 2;
+        }
+    }
+
+    ADLUtil_InventoryRecord record;
+    AsicInfoListSnapshot    asicInfoList;
+    ADLUtil_VersionsInfo    versionsInfo;
+    uint64_t                loadNs = 0;
+
+    if (useSysfs)
+    {
+        pADLUtils->SetBackend(ADLUtil_Backend::Sysfs);
+    }
+    else
+    {
+        std::chrono::steady_clock::time_point loadStart = std::chrono::steady_clock::now();
+        pADLUtils->LoadAndInit();
+        loadNs = GetElapsedNs(loadStart);
+    }
+
+    std::chrono::steady_clock::time_point enumerationStart = std::chrono::steady_clock::now();
+    ADLUtil_Result asicInfoResult = pADLUtils->GetAsicInfoList(asicInfoList);
+    uint64_t enumerationNs = GetElapsedNs(enumerationStart);
+
+    std::chrono::steady_clock::time_point versionsStart = std::chrono::steady_clock::now();
+    ADLUtil_Result versionsResult = pADLUtils->GetVersionsInfo(versionsInfo);
+    uint64_t versionsNs = GetElapsedNs(versionsStart);
+
+    // failed queries are recorded too, so that the fleet view shows the hosts where ADL does not work
+    ADLUtil_BuildInventoryRecord(GetHostName(), (nullptr != asicInfoList) ? *asicInfoList : AsicInfoList(), versionsInfo, record);
+    record.header.asicInfoResult = asicInfoResult;
+    record.header.versionsResult = versionsResult;
+    record.header.timestamp = static_cast<uint64_t>(time(nullptr));
+    record.header.loadNs = loadNs;
+    record.header.enumerationNs = enumerationNs;
+    record.header.versionsNs = versionsNs;
+
+    pADLUtils->Unload();
+
+    FILE* pFile = stdout;
+
+    if (!outputPath.empty())
+    {
+        pFile = fopen(outputPath.c_str(), "ab");
+
+        if (nullptr == pFile)
+        {
+            fprintf(stderr, "adl_util_inventory: cannot open %s\n", outputPath.c_str());
+            return 1;
+        }
+    }
+#ifdef _WIN32
+    else
+    {
+        _setmode(_fileno(stdout), _O_BINARY);
+    }
+#endif
+
+    bool written = ADLUtil_WriteInventoryRecord(pFile, record) && 0 == fflush(pFile);
+
+    if (stdout != pFile)
+    {
+        written = (0 == fclose(pFile)) && written;
+    }
+
+    if (!written)
+    {
+        fprintf(stderr, "adl_util_inventory: cannot write the record\n");
+        return 1;
+    }
+
+    return 0;
+}
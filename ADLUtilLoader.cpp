@@ -0,0 +1,80 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Platform abstraction for loading the ADL shared library.
+//==============================================================================
+
+#include "ADLUtilLoader.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+const char* ADLUtil_GetDefaultLibraryName()
+{
+#ifdef _WIN64
+    // 64 bit Windows library
+    return "atiadlxx.dll";
+#elif defined(_WIN32)
+    // 32 bit Windows library
+    return "atiadlxy.dll";
+#else
+    return "libatiadlxx.so";
+#endif
+}
+
+ADLUtil_LibraryHandle ADLUtil_LoadLibrary(const char* pLibraryName)
+{
+#ifdef _WIN32
+    return LoadLibraryA(pLibraryName);
+#else
+    return dlopen(pLibraryName, RTLD_NOW | RTLD_LOCAL);
+#endif
+}
+
+void* ADLUtil_GetProcAddress(ADLUtil_LibraryHandle libHandle, const char* pSymbolName)
+{
+#ifdef _WIN32
+    return reinterpret_cast<void*>(::GetProcAddress(static_cast<HMODULE>(libHandle), pSymbolName));
+#else
+    return dlsym(libHandle, pSymbolName);
+#endif
+}
+
+void ADLUtil_FreeLibrary(ADLUtil_LibraryHandle libHandle)
+{
+#ifdef _WIN32
+    FreeLibrary(static_cast<HMODULE>(libHandle));
+#else
+    dlclose(libHandle);
+#endif
+}
+
+std::string ADLUtil_GetLibraryPath(const void* pSymbol)
+{
+#ifdef _WIN32
+    HMODULE hModule = nullptr;
+
+    if (!GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, static_cast<LPCSTR>(pSymbol), &hModule))
+    {
+        return std::string();
+    }
+
+    char  path[MAX_PATH];
+    DWORD length = GetModuleFileNameA(hModule, path, MAX_PATH);
+
+    return (0 < length && MAX_PATH > length) ? std::string(path, length) : std::string();
+#else
+    Dl_info info;
+
+    if (0 == dladdr(pSymbol, &info) || nullptr == info.dli_fname)
+    {
+        return std::string();
+    }
+
+    return info.dli_fname;
+#endif
+}
@@ -0,0 +1,39 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Platform abstraction for loading the ADL shared library.
+//==============================================================================
+
+#ifndef _ADL_UTIL_LOADER_H_
+#define _ADL_UTIL_LOADER_H_
+
+#include <string>
+
+/// Opaque handle of a loaded shared library
+typedef void* ADLUtil_LibraryHandle;
+
+/// @returns the file name of the ADL library for the current platform.
+const char* ADLUtil_GetDefaultLibraryName();
+
+/// Loads a shared library (LoadLibraryA on Windows, dlopen elsewhere)
+/// @param[in] pLibraryName the file name or path of the library
+/// @returns   the library handle, or nullptr if the library could not be loaded.
+ADLUtil_LibraryHandle ADLUtil_LoadLibrary(const char* pLibraryName);
+
+/// Looks up an exported symbol (GetProcAddress on Windows, dlsym elsewhere)
+/// @param[in] libHandle   the library handle
+/// @param[in] pSymbolName the name of the symbol
+/// @returns   the address of the symbol, or nullptr if the library does not export it.
+void* ADLUtil_GetProcAddress(ADLUtil_LibraryHandle libHandle, const char* pSymbolName);
+
+/// Unloads a shared library (FreeLibrary on Windows, dlclose elsewhere)
+/// @param[in] libHandle the library handle
+void ADLUtil_FreeLibrary(ADLUtil_LibraryHandle libHandle);
+
+/// Finds the file a loaded library was loaded from (dladdr on Linux, GetModuleHandleExA and GetModuleFileNameA on Windows)
+/// @param[in] pSymbol the address of a symbol the library exports, ie a resolved entry point
+/// @returns   the path of the library file, empty if pSymbol does not belong to a loaded library.
+std::string ADLUtil_GetLibraryPath(const void* pSymbol);
+
+#endif //_ADL_UTIL_LOADER_H_
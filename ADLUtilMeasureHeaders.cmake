@@ -0,0 +1,104 @@
+## Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+# Measures what including each public ADLUtil header costs a translation unit: the preprocessed lines and the time of a
+# syntax-only compile. Fails if ADLUtil.h pulls in the future/async machinery again, which belongs in ADLUtilAsync.h.
+# Usage: cmake -DCOMPILER=<cxx> -DCOMPILER_ID=<id> -DINCLUDE_DIRS=<dir|dir> -DDEFINITIONS=<def|def> -DWORK_DIR=<dir>
+#              -P ADLUtilMeasureHeaders.cmake
+
+cmake_minimum_required(VERSION 3.25)
+
+if (NOT COMPILER OR NOT WORK_DIR)
+    message(FATAL_ERROR "usage: cmake -DCOMPILER=<cxx> -DCOMPILER_ID=<id> -DINCLUDE_DIRS=<dir|dir> -DDEFINITIONS=<def|def> "
+                        "-DWORK_DIR=<dir> -P ADLUtilMeasureHeaders.cmake")
+endif()
+
+set(HEADERS ADLUtil.h ADLUtilAsync.h ADLUtilEntrypoints.h)
+
+# tokens of ADLUtilAsync.h that must not reach code that only includes ADLUtil.h
+set(ASYNC_TOKENS "packaged_task|shared_future|class function<")
+
+if (COMPILER_ID STREQUAL "MSVC")
+    set(PREPROCESS_FLAGS /nologo /std:c++17 /EP)
+    set(SYNTAX_FLAGS /nologo /std:c++17 /Zs)
+    set(INCLUDE_FLAG /I)
+    set(DEFINE_FLAG /D)
+else()
+    set(PREPROCESS_FLAGS -std=c++17 -E -P)
+    set(SYNTAX_FLAGS -std=c++17 -fsyntax-only)
+    set(INCLUDE_FLAG -I)
+    set(DEFINE_FLAG -D)
+endif()
+
+# the lists are passed joined with | so that they survive the command line
+string(REPLACE "|" ";" INCLUDE_DIRS "${INCLUDE_DIRS}")
+string(REPLACE "|" ";" DEFINITIONS "${DEFINITIONS}")
+
+set(COMPILE_FLAGS "")
+
+foreach (DIR IN LISTS INCLUDE_DIRS)
+    if (NOT DIR STREQUAL "")
+        list(APPEND COMPILE_FLAGS "${INCLUDE_FLAG}${DIR}")
+    endif()
+endforeach()
+
+foreach (DEFINITION IN LISTS DEFINITIONS)
+    if (NOT DEFINITION STREQUAL "")
+        list(APPEND COMPILE_FLAGS "${DEFINE_FLAG}${DEFINITION}")
+    endif()
+endforeach()
+
+file(MAKE_DIRECTORY "${WORK_DIR}")
+
+foreach (HEADER IN LISTS HEADERS)
+    string(REPLACE "." "_" NAME "${HEADER}")
+    set(SOURCE "${WORK_DIR}/${NAME}.cpp")
+    set(PREPROCESSED "${WORK_DIR}/${NAME}.ii")
+    file(WRITE "${SOURCE}" "#include \"${HEADER}\"\n")
+
+    execute_process(
+        COMMAND "${COMPILER}" ${PREPROCESS_FLAGS} ${COMPILE_FLAGS} "${SOURCE}"
+        OUTPUT_FILE "${PREPROCESSED}"
+        RESULT_VARIABLE RESULT
+    )
+
+    if (NOT RESULT EQUAL 0)
+        message(FATAL_ERROR "preprocessing ${HEADER} failed")
+    endif()
+
+    file(STRINGS "${PREPROCESSED}" LINES)
+    list(LENGTH LINES LINE_COUNT)
+
+    # best of three, so that a cold file cache does not count
+    set(BEST_US "")
+
+    foreach (RUN RANGE 2)
+        string(TIMESTAMP START_US "%s%f")
+
+        execute_process(
+            COMMAND "${COMPILER}" ${SYNTAX_FLAGS} ${COMPILE_FLAGS} "${SOURCE}"
+            RESULT_VARIABLE RESULT
+        )
+
+        string(TIMESTAMP END_US "%s%f")
+
+        if (NOT RESULT EQUAL 0)
+            message(FATAL_ERROR "compiling ${HEADER} failed")
+        endif()
+
+        math(EXPR ELAPSED_US "${END_US} - ${START_US}")
+
+        if (BEST_US STREQUAL "" OR ELAPSED_US LESS BEST_US)
+            set(BEST_US ${ELAPSED_US})
+        endif()
+    endforeach()
+
+    math(EXPR BEST_MS "${BEST_US} / 1000")
+    message(STATUS "${HEADER}: ${LINE_COUNT} preprocessed non-blank lines, ${BEST_MS} ms syntax-only compile")
+
+    if (HEADER STREQUAL "ADLUtil.h")
+        file(STRINGS "${PREPROCESSED}" ASYNC_LINES REGEX "${ASYNC_TOKENS}" LIMIT_COUNT 1)
+
+        if (ASYNC_LINES)
+            message(FATAL_ERROR "ADLUtil.h includes the async machinery of ADLUtilAsync.h: ${ASYNC_LINES}")
+        endif()
+    endif()
+endforeach()
@@ -0,0 +1,140 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Index of the physical GPUs behind the logical ADL adapters.
+//==============================================================================
+
+#include "ADLUtilPhysicalGPUIndex.h"
+
+// Combines a device ID and a revision ID into one lookup key
+static uint64_t MakeRevisionKey(int deviceID, int revID)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(deviceID)) << 32) | static_cast<uint32_t>(revID);
+}
+
+ADLUtil_PhysicalGPUIndex::ADLUtil_PhysicalGPUIndex(const AsicInfoList& asicInfoList)
+{
+    // first pass: find the physical GPU of every logical adapter
+    std::vector<uint32_t> physicalGPUOfAdapter(asicInfoList.size());
+
+    for (size_t i = 0; i < asicInfoList.size(); ++i)
+    {
+        const ADLUtil_ASICInfo& asicInfo = asicInfoList[i];
+
+        uint64_t busKey = MakeBusKey(asicInfo.topology.pciDomain, asicInfo.busNumber, asicInfo.deviceNumber, asicInfo.functionNumber);
+        // try_emplace, because emplace allocates a node even for the logical adapters of a GPU that is already indexed
+        auto     insert = m_byBusLocation.try_emplace(busKey, GetCount());
+
+        if (insert.second)
+        {
+            m_pciDomains.push_back(asicInfo.topology.pciDomain);
+            m_busNumbers.push_back(asicInfo.busNumber);
+            m_deviceNumbers.push_back(asicInfo.deviceNumber);
+            m_functionNumbers.push_back(asicInfo.functionNumber);
+            m_vendorIDs.push_back(asicInfo.vendorID);
+            m_deviceIDs.push_back(asicInfo.deviceID);
+            m_revIDs.push_back(asicInfo.revID);
+        }
+
+        physicalGPUOfAdapter[i] = insert.first->second;
+    }
+
+    // second pass: group the logical adapters by physical GPU
+    m_logicalAdapterOffsets.assign(GetCount() + 1, 0);
+
+    for (uint32_t physicalGPU : physicalGPUOfAdapter)
+    {
+        ++m_logicalAdapterOffsets[physicalGPU + 1];
+    }
+
+    for (uint32_t i = 0; i < GetCount(); ++i)
+    {
+        m_logicalAdapterOffsets[i + 1] += m_logicalAdapterOffsets[i];
+    }
+
+    m_logicalAdapters.resize(asicInfoList.size());
+    std::vector<uint32_t> insertPos(m_logicalAdapterOffsets.begin(), m_logicalAdapterOffsets.end() - 1);
+
+    for (size_t i = 0; i < physicalGPUOfAdapter.size(); ++i)
+    {
+        m_logicalAdapters[insertPos[physicalGPUOfAdapter[i]]++] = static_cast<uint32_t>(i);
+    }
+
+    // the device ID and revision lookups
+    std::vector<uint64_t> deviceIDKeys(GetCount());
+    std::vector<uint64_t> revisionKeys(GetCount());
+
+    for (uint32_t i = 0; i < GetCount(); ++i)
+    {
+        deviceIDKeys[i] = static_cast<uint32_t>(m_deviceIDs[i]);
+        revisionKeys[i] = MakeRevisionKey(m_deviceIDs[i], m_revIDs[i]);
+    }
+
+    BuildBuckets(deviceIDKeys, m_byDeviceID, m_deviceIDBuckets);
+    BuildBuckets(revisionKeys, m_byRevision, m_revisionBuckets);
+}
+
+uint32_t ADLUtil_PhysicalGPUIndex::FindByBusLocation(int pciDomain, int busNumber, int deviceNumber, int functionNumber) const
+{
+    auto it = m_byBusLocation.find(MakeBusKey(pciDomain, busNumber, deviceNumber, functionNumber));
+    return (m_byBusLocation.end() == it) ? s_notFound : it->second;
+}
+
+ADLUtil_PhysicalGPURange ADLUtil_PhysicalGPUIndex::FindByDeviceID(int deviceID) const
+{
+    return FindBucket(static_cast<uint32_t>(deviceID), m_byDeviceID, m_deviceIDBuckets);
+}
+
+ADLUtil_PhysicalGPURange ADLUtil_PhysicalGPUIndex::FindByRevision(int deviceID, int revID) const
+{
+    return FindBucket(MakeRevisionKey(deviceID, revID), m_byRevision, m_revisionBuckets);
+}
+
+ADLUtil_PhysicalGPURange ADLUtil_PhysicalGPUIndex::GetLogicalAdapters(uint32_t physicalGPU) const
+{
+    ADLUtil_PhysicalGPURange range;
+    range.pBegin = m_logicalAdapters.data() + m_logicalAdapterOffsets[physicalGPU];
+    range.pEnd   = m_logicalAdapters.data() + m_logicalAdapterOffsets[physicalGPU + 1];
+    return range;
+}
+
+void ADLUtil_PhysicalGPUIndex::BuildBuckets(const std::vector<uint64_t>& keys, std::vector<uint32_t>& permutation, std::unordered_map<uint64_t, Bucket>& buckets)
+{
+    // count the members of each bucket, then assign each bucket its slice of the permutation array
+    for (uint64_t key : keys)
+    {
+        ++buckets[key].count;
+    }
+
+    uint32_t offset = 0;
+
+    for (auto& bucket : buckets)
+    {
+        bucket.second.offset = offset;
+        offset += bucket.second.count;
+        bucket.second.count = 0;
+    }
+
+    permutation.resize(keys.size());
+
+    for (uint32_t i = 0; i < static_cast<uint32_t>(keys.size()); ++i)
+    {
+        Bucket& bucket = buckets[keys[i]];
+        permutation[bucket.offset + bucket.count++] = i;
+    }
+}
+
+ADLUtil_PhysicalGPURange ADLUtil_PhysicalGPUIndex::FindBucket(uint64_t key, const std::vector<uint32_t>& permutation, const std::unordered_map<uint64_t, Bucket>& buckets)
+{
+    ADLUtil_PhysicalGPURange range;
+    auto it = buckets.find(key);
+
+    if (buckets.end() != it)
+    {
+        range.pBegin = permutation.data() + it->second.offset;
+        range.pEnd   = range.pBegin + it->second.count;
+    }
+
+    return range;
+}
@@ -0,0 +1,115 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Index of the physical GPUs behind the logical ADL adapters.
+//==============================================================================
+
+#ifndef _ADL_UTIL_PHYSICAL_GPU_INDEX_H_
+#define _ADL_UTIL_PHYSICAL_GPU_INDEX_H_
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "ADLUtil.h"
+
+/// A contiguous range of physical GPU indices, usable in range-based for loops
+struct ADLUtil_PhysicalGPURange
+{
+    const uint32_t* pBegin = nullptr; ///< first physical GPU index in the range
+    const uint32_t* pEnd   = nullptr; ///< one past the last physical GPU index in the range
+
+    const uint32_t* begin() const { return pBegin; }
+    const uint32_t* end() const { return pEnd; }
+    size_t size() const { return static_cast<size_t>(pEnd - pBegin); }
+    bool empty() const { return pBegin == pEnd; }
+};
+
+//------------------------------------------------------------------------------------
+/// Collapses the logical adapters of an AsicInfoList into physical GPUs keyed by PCI
+/// domain/bus/device/function. The per-GPU data is stored column-wise, and the lookups by bus
+/// location, device ID and device/revision ID are hash lookups. The index is immutable
+/// once built; AMDTADLUtils builds one per enumeration and shares it between callers.
+//------------------------------------------------------------------------------------
+class ADLUtil_PhysicalGPUIndex
+{
+public:
+    /// Returned by the single-result lookups when no physical GPU matches
+    static constexpr uint32_t s_notFound = UINT32_MAX;
+
+    /// constructor, creates an empty index
+    ADLUtil_PhysicalGPUIndex() = default;
+
+    /// constructor
+    /// @param[in] asicInfoList the logical adapters to index
+    explicit ADLUtil_PhysicalGPUIndex(const AsicInfoList& asicInfoList);
+
+    /// @returns the number of physical GPUs
+    uint32_t GetCount() const { return static_cast<uint32_t>(m_busNumbers.size()); }
+
+    /// @returns the physical GPU at the given PCI location, or s_notFound
+    uint32_t FindByBusLocation(int pciDomain, int busNumber, int deviceNumber, int functionNumber) const;
+
+    /// @returns the physical GPUs with the given device ID
+    ADLUtil_PhysicalGPURange FindByDeviceID(int deviceID) const;
+
+    /// @returns the physical GPUs with the given device and revision ID
+    ADLUtil_PhysicalGPURange FindByRevision(int deviceID, int revID) const;
+
+    /// @returns the indices into the AsicInfoList of the logical adapters of the given physical GPU
+    ADLUtil_PhysicalGPURange GetLogicalAdapters(uint32_t physicalGPU) const;
+
+    int GetPCIDomain(uint32_t physicalGPU) const { return m_pciDomains[physicalGPU]; }           ///< @returns the PCI domain
+    int GetBusNumber(uint32_t physicalGPU) const { return m_busNumbers[physicalGPU]; }           ///< @returns the PCI bus number
+    int GetDeviceNumber(uint32_t physicalGPU) const { return m_deviceNumbers[physicalGPU]; }     ///< @returns the PCI device number
+    int GetFunctionNumber(uint32_t physicalGPU) const { return m_functionNumbers[physicalGPU]; } ///< @returns the PCI function number
+    int GetVendorID(uint32_t physicalGPU) const { return m_vendorIDs[physicalGPU]; }             ///< @returns the vendor ID
+    int GetDeviceID(uint32_t physicalGPU) const { return m_deviceIDs[physicalGPU]; }             ///< @returns the device ID
+    int GetRevID(uint32_t physicalGPU) const { return m_revIDs[physicalGPU]; }                   ///< @returns the revision ID
+
+    /// @returns the index into the AsicInfoList of the first logical adapter of the given physical GPU
+    uint32_t GetFirstLogicalAdapter(uint32_t physicalGPU) const { return m_logicalAdapters[m_logicalAdapterOffsets[physicalGPU]]; }
+
+    /// Packs a PCI location into the key used by the bus location lookup, the domain in the high 32 bits so that the
+    /// same bus/device/function in two domains are two GPUs
+    static uint64_t MakeBusKey(int pciDomain, int busNumber, int deviceNumber, int functionNumber)
+    {
+        uint32_t bdf = (static_cast<uint32_t>(busNumber) << 8) | ((static_cast<uint32_t>(deviceNumber) & 0x1f) << 3) | (static_cast<uint32_t>(functionNumber) & 0x7);
+        return (static_cast<uint64_t>(static_cast<uint32_t>(pciDomain)) << 32) | bdf;
+    }
+
+private:
+    /// A range inside one of the permutation arrays
+    struct Bucket
+    {
+        uint32_t offset; ///< first element
+        uint32_t count;  ///< number of elements
+    };
+
+    /// Groups the physical GPUs by key into a permutation array and a map of buckets
+    static void BuildBuckets(const std::vector<uint64_t>& keys, std::vector<uint32_t>& permutation, std::unordered_map<uint64_t, Bucket>& buckets);
+
+    /// Looks up a bucket and returns its range of the permutation array
+    static ADLUtil_PhysicalGPURange FindBucket(uint64_t key, const std::vector<uint32_t>& permutation, const std::unordered_map<uint64_t, Bucket>& buckets);
+
+    std::vector<int> m_pciDomains;      ///< PCI domain per physical GPU
+    std::vector<int> m_busNumbers;      ///< PCI bus number per physical GPU
+    std::vector<int> m_deviceNumbers;   ///< PCI device number per physical GPU
+    std::vector<int> m_functionNumbers; ///< PCI function number per physical GPU
+    std::vector<int> m_vendorIDs;       ///< vendor ID per physical GPU
+    std::vector<int> m_deviceIDs;       ///< device ID per physical GPU
+    std::vector<int> m_revIDs;          ///< revision ID per physical GPU
+
+    std::vector<uint32_t> m_logicalAdapterOffsets; ///< per physical GPU plus one, offsets into m_logicalAdapters
+    std::vector<uint32_t> m_logicalAdapters;       ///< AsicInfoList indices grouped by physical GPU
+
+    std::unordered_map<uint64_t, uint32_t> m_byBusLocation; ///< bus key to physical GPU
+
+    std::vector<uint32_t>                  m_byDeviceID;        ///< physical GPUs grouped by device ID
+    std::unordered_map<uint64_t, Bucket>   m_deviceIDBuckets;   ///< device ID to range of m_byDeviceID
+    std::vector<uint32_t>                  m_byRevision;        ///< physical GPUs grouped by device and revision ID
+    std::unordered_map<uint64_t, Bucket>   m_revisionBuckets;   ///< device and revision ID to range of m_byRevision
+};
+
+#endif //_ADL_UTIL_PHYSICAL_GPU_INDEX_H_
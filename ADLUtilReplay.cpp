@@ -0,0 +1,450 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Recording of the ADL calls into a profile, and replay of a profile in place of the ADL library.
+//==============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ADLUtilReplay.h"
+
+static constexpr uint32_t s_entrypointCount = static_cast<uint32_t>(ADLUtil_Entrypoint::Count);
+
+/// One captured ADL call
+struct RecordedCall
+{
+    uint32_t             entrypoint;  ///< the ADLUtil_Entrypoint
+    int32_t              returnCode;  ///< the ADL return code
+    uint64_t             durationNs;  ///< how long the call took
+    std::vector<int32_t> inputs;      ///< the integer arguments, in order
+    std::vector<char>    payload;     ///< the contents of the output arguments after the call, in order
+};
+
+// The calls captured while recording
+static struct
+{
+    std::mutex                mutex;                                  ///< protects exported and calls
+    std::atomic<bool>         isRecording{false};                     ///< true while calls are captured
+    std::atomic<void*>        realEntrypoints[s_entrypointCount] = {}; ///< the wrapped library exports
+    bool                      exported[s_entrypointCount] = {};       ///< entry points the library was found to export
+    std::vector<RecordedCall> calls;                                  ///< the captured calls, in call order
+} s_recorder;
+
+// The profile being replayed
+static struct
+{
+    std::mutex                mutex;                                    ///< protects the members below
+    bool                      isOpen = false;                           ///< true while a profile is loaded
+    bool                      replayLatency = false;                    ///< true to take as long as the recorded calls
+    bool                      exported[s_entrypointCount] = {};         ///< entry points the recorded library exported
+    std::vector<RecordedCall> callsByEntrypoint[s_entrypointCount];     ///< the recorded calls of each entry point, in call order
+    size_t                    cursors[s_entrypointCount] = {};          ///< per entry point, the recorded call to try first
+} s_replay;
+
+// Stands in for the context handle ADL2_Main_Control_Create returns while replaying
+static char s_replayContext;
+
+// Appends the bytes of an output argument to a payload. A null output contributes nothing.
+static void AppendPayload(std::vector<char>& payload, const void* pOutput, size_t size)
+{
+    if (nullptr != pOutput)
+    {
+        const char* pBytes = static_cast<const char*>(pOutput);
+        payload.insert(payload.end(), pBytes, pBytes + size);
+    }
+}
+
+// Copies the next bytes of a payload into an output argument
+static void ExtractPayload(const std::vector<char>& payload, size_t& offset, void* pOutput, size_t size)
+{
+    if (nullptr != pOutput && offset + size <= payload.size())
+    {
+        memcpy(pOutput, payload.data() + offset, size);
+        offset += size;
+    }
+}
+
+/// True for the pointer arguments through which ADL returns a struct or a count
+template <typename T>
+constexpr bool s_isOutputArgument = std::is_pointer_v<T> &&
+                                    (std::is_class_v<std::remove_pointer_t<T>> || std::is_same_v<std::remove_pointer_t<T>, int>);
+
+/// Returns the size of the output of argument I. AdapterInfo arrays are sized by the byte count that follows them.
+template <size_t I, typename Tuple>
+static size_t GetOutputSize(const Tuple& arguments)
+{
+    typedef std::tuple_element_t<I, Tuple> T;
+
+    if constexpr (std::is_same_v<T, LPAdapterInfo>)
+    {
+        static_assert(I + 1 < std::tuple_size_v<Tuple> && std::is_same_v<std::tuple_element_t<I + 1, Tuple>, int>, "an AdapterInfo array must be followed by its size");
+        return static_cast<size_t>(std::max(0, std::get<I + 1>(arguments)));
+    }
+    else
+    {
+        return sizeof(*std::get<I>(arguments));
+    }
+}
+
+/// Captures the integer arguments of a call, and with outputs also the contents of its output arguments
+template <typename Tuple, size_t... I>
+static void EncodeArguments(const Tuple& arguments, RecordedCall& call, [[maybe_unused]] bool withOutputs, std::index_sequence<I...>)
+{
+    (
+        [&]()
+        {
+            typedef std::tuple_element_t<I, Tuple> T;
+
+            if constexpr (std::is_same_v<T, int>)
+            {
+                call.inputs.push_back(std::get<I>(arguments));
+            }
+            else if constexpr (s_isOutputArgument<T>)
+            {
+                if (withOutputs)
+                {
+                    AppendPayload(call.payload, std::get<I>(arguments), GetOutputSize<I>(arguments));
+                }
+            }
+
+            // context handles and the allocation callback carry no data
+        }(),
+        ...);
+}
+
+/// Fills the output arguments of a call from a recorded payload
+template <typename Tuple, size_t... I>
+static void DecodeArguments(const Tuple& arguments, const std::vector<char>& payload, std::index_sequence<I...>)
+{
+    [[maybe_unused]] size_t offset = 0;
+
+    (
+        [&]()
+        {
+            typedef std::tuple_element_t<I, Tuple> T;
+
+            if constexpr (std::is_same_v<T, ADL_CONTEXT_HANDLE*>)
+            {
+                if (nullptr != std::get<I>(arguments))
+                {
+                    *std::get<I>(arguments) = &s_replayContext;
+                }
+            }
+            else if constexpr (s_isOutputArgument<T>)
+            {
+                ExtractPayload(payload, offset, std::get<I>(arguments), GetOutputSize<I>(arguments));
+            }
+        }(),
+        ...);
+}
+
+/// The recording wrapper and the replay stand-in of an entry point
+template <ADLUtil_Entrypoint Sym, typename Fn = typename ADLUtil_EntrypointTraits<Sym>::Type>
+struct EntrypointStub;
+
+template <ADLUtil_Entrypoint Sym, typename... Args>
+struct EntrypointStub<Sym, int (*)(Args...)>
+{
+    static constexpr uint32_t s_index = static_cast<uint32_t>(Sym);
+
+    /// Calls the library and captures the call
+    static int Record(Args... args)
+    {
+        typedef int (*RealFn)(Args...);
+        RealFn pReal = reinterpret_cast<RealFn>(s_recorder.realEntrypoints[s_index].load(std::memory_order_acquire));
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        int adlResult = pReal(args...);
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+        if (s_recorder.isRecording.load(std::memory_order_acquire))
+        {
+            RecordedCall call;
+            call.entrypoint = s_index;
+            call.returnCode = adlResult;
+            call.durationNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            EncodeArguments(std::tuple<Args...>(args...), call, true, std::index_sequence_for<Args...>());
+
+            std::lock_guard<std::mutex> lock(s_recorder.mutex);
+            s_recorder.calls.push_back(std::move(call));
+        }
+
+        return adlResult;
+    }
+
+    /// Answers a call from the profile
+    static int Replay(Args... args)
+    {
+        std::tuple<Args...> arguments(args...);
+        RecordedCall        request;
+        EncodeArguments(arguments, request, false, std::index_sequence_for<Args...>());
+
+        int      adlResult = ADL_ERR;
+        uint64_t durationNs = 0;
+        bool     replayLatency;
+
+        {
+            std::lock_guard<std::mutex> lock(s_replay.mutex);
+
+            const std::vector<RecordedCall>& calls = s_replay.callsByEntrypoint[s_index];
+            size_t&                          cursor = s_replay.cursors[s_index];
+            replayLatency = s_replay.replayLatency;
+
+            // serve the calls in recorded order, so that polling replays the recorded sequence of values
+            for (size_t i = 0; i < calls.size(); ++i)
+            {
+                const RecordedCall& call = calls[(cursor + i) % calls.size()];
+
+                if (call.inputs == request.inputs)
+                {
+                    DecodeArguments(arguments, call.payload, std::index_sequence_for<Args...>());
+                    adlResult = call.returnCode;
+                    durationNs = call.durationNs;
+                    cursor = (cursor + i + 1) % calls.size();
+                    break;
+                }
+            }
+        }
+
+        if (replayLatency && 0 < durationNs)
+        {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(durationNs));
+        }
+
+        return adlResult;
+    }
+};
+
+// Recording wrappers indexed by ADLUtil_Entrypoint
+static void* const s_recordStubs[] =
+{
+#define X(SYM) reinterpret_cast<void*>(&EntrypointStub<ADLUtil_Entrypoint::SYM>::Record),
+    ADL_INTERFACE_TABLE
+#undef X
+};
+
+// Replay stand-ins indexed by ADLUtil_Entrypoint
+static void* const s_replayStubs[] =
+{
+#define X(SYM) reinterpret_cast<void*>(&EntrypointStub<ADLUtil_Entrypoint::SYM>::Replay),
+    ADL_INTERFACE_TABLE
+#undef X
+};
+
+// Appends a value to a profile image in host byte order
+template <typename T>
+static void AppendValue(std::vector<char>& image, T value)
+{
+    AppendPayload(image, &value, sizeof(value));
+}
+
+// Reads a value from a profile image, returns false past its end
+template <typename T>
+static bool ReadValue(const std::vector<char>& image, size_t& offset, T& value)
+{
+    if (offset + sizeof(value) > image.size())
+    {
+        return false;
+    }
+
+    memcpy(&value, image.data() + offset, sizeof(value));
+    offset += sizeof(value);
+    return true;
+}
+
+void ADLUtil_StartRecording()
+{
+    std::lock_guard<std::mutex> lock(s_recorder.mutex);
+
+    std::fill(std::begin(s_recorder.exported), std::end(s_recorder.exported), false);
+    s_recorder.calls.clear();
+    s_recorder.isRecording.store(true, std::memory_order_release);
+}
+
+bool ADLUtil_IsRecording()
+{
+    return s_recorder.isRecording.load(std::memory_order_acquire);
+}
+
+void* ADLUtil_WrapForRecording(ADLUtil_Entrypoint entrypoint, void* pRealEntrypoint)
+{
+    uint32_t index = static_cast<uint32_t>(entrypoint);
+
+    std::lock_guard<std::mutex> lock(s_recorder.mutex);
+    s_recorder.realEntrypoints[index].store(pRealEntrypoint, std::memory_order_release);
+    s_recorder.exported[index] = true;
+
+    return s_recordStubs[index];
+}
+
+bool ADLUtil_StopRecording(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(s_recorder.mutex);
+    s_recorder.isRecording.store(false, std::memory_order_release);
+
+    // the profile only names the entry points that were exported, and refers to them by their position in that list
+    std::vector<uint16_t> profileIndices(s_entrypointCount, 0);
+    std::vector<char>     names;
+    uint32_t              nameCount = 0;
+
+    for (uint32_t i = 0; i < s_entrypointCount; ++i)
+    {
+        if (s_recorder.exported[i])
+        {
+            const char* pName = ADLUtil_GetEntrypointName(static_cast<ADLUtil_Entrypoint>(i));
+            uint8_t     nameLength = static_cast<uint8_t>(strlen(pName));
+
+            profileIndices[i] = static_cast<uint16_t>(nameCount++);
+            AppendValue(names, nameLength);
+            AppendPayload(names, pName, nameLength);
+        }
+    }
+
+    std::vector<char> image;
+    AppendValue(image, ADLUTIL_REPLAY_MAGIC);
+    AppendValue(image, ADLUTIL_REPLAY_FORMAT_VERSION);
+    AppendValue(image, nameCount);
+    AppendValue(image, static_cast<uint32_t>(s_recorder.calls.size()));
+    image.insert(image.end(), names.begin(), names.end());
+
+    for (const RecordedCall& call : s_recorder.calls)
+    {
+        AppendValue(image, profileIndices[call.entrypoint]);
+        AppendValue(image, call.returnCode);
+        AppendValue(image, call.durationNs);
+        AppendValue(image, static_cast<uint16_t>(call.inputs.size()));
+        AppendValue(image, static_cast<uint32_t>(call.payload.size()));
+        AppendPayload(image, call.inputs.data(), call.inputs.size() * sizeof(int32_t));
+        image.insert(image.end(), call.payload.begin(), call.payload.end());
+    }
+
+    s_recorder.calls.clear();
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(image.data(), static_cast<std::streamsize>(image.size()));
+    return file.good();
+}
+
+bool ADLUtil_OpenReplayProfile(const std::string& path, bool replayLatency)
+{
+    std::ifstream     file(path, std::ios::binary);
+    std::vector<char> image((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    size_t   offset = 0;
+    uint32_t magic = 0;
+    uint32_t formatVersion = 0;
+    uint32_t nameCount = 0;
+    uint32_t callCount = 0;
+
+    if (!ReadValue(image, offset, magic) || ADLUTIL_REPLAY_MAGIC != magic ||
+        !ReadValue(image, offset, formatVersion) || ADLUTIL_REPLAY_FORMAT_VERSION != formatVersion ||
+        !ReadValue(image, offset, nameCount) || !ReadValue(image, offset, callCount))
+    {
+        return false;
+    }
+
+    // map the entry points of the profile onto this build's table; ones this build does not know are skipped
+    std::vector<uint32_t> entrypoints(nameCount, s_entrypointCount);
+    bool                  exported[s_entrypointCount] = {};
+
+    for (uint32_t i = 0; i < nameCount; ++i)
+    {
+        uint8_t nameLength = 0;
+
+        if (!ReadValue(image, offset, nameLength) || offset + nameLength > image.size())
+        {
+            return false;
+        }
+
+        std::string name(image.data() + offset, nameLength);
+        offset += nameLength;
+
+        for (uint32_t j = 0; j < s_entrypointCount; ++j)
+        {
+            if (name == ADLUtil_GetEntrypointName(static_cast<ADLUtil_Entrypoint>(j)))
+            {
+                entrypoints[i] = j;
+                exported[j] = true;
+            }
+        }
+    }
+
+    std::vector<RecordedCall> callsByEntrypoint[s_entrypointCount];
+
+    for (uint32_t i = 0; i < callCount; ++i)
+    {
+        uint16_t     profileIndex = 0;
+        uint16_t     inputCount = 0;
+        uint32_t     payloadSize = 0;
+        RecordedCall call;
+
+        if (!ReadValue(image, offset, profileIndex) || nameCount <= profileIndex ||
+            !ReadValue(image, offset, call.returnCode) ||
+            !ReadValue(image, offset, call.durationNs) ||
+            !ReadValue(image, offset, inputCount) ||
+            !ReadValue(image, offset, payloadSize) ||
+            offset + inputCount * sizeof(int32_t) + payloadSize > image.size())
+        {
+            return false;
+        }
+
+        call.entrypoint = entrypoints[profileIndex];
+        call.inputs.resize(inputCount);
+        memcpy(call.inputs.data(), image.data() + offset, inputCount * sizeof(int32_t));
+        offset += inputCount * sizeof(int32_t);
+        call.payload.assign(image.data() + offset, image.data() + offset + payloadSize);
+        offset += payloadSize;
+
+        if (s_entrypointCount != call.entrypoint)
+        {
+            callsByEntrypoint[call.entrypoint].push_back(std::move(call));
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(s_replay.mutex);
+
+    s_replay.isOpen = true;
+    s_replay.replayLatency = replayLatency;
+
+    for (uint32_t i = 0; i < s_entrypointCount; ++i)
+    {
+        s_replay.exported[i] = exported[i];
+        s_replay.callsByEntrypoint[i] = std::move(callsByEntrypoint[i]);
+        s_replay.cursors[i] = 0;
+    }
+
+    return true;
+}
+
+void* ADLUtil_GetReplayEntrypoint(ADLUtil_Entrypoint entrypoint)
+{
+    uint32_t index = static_cast<uint32_t>(entrypoint);
+
+    std::lock_guard<std::mutex> lock(s_replay.mutex);
+    return (s_replay.isOpen && s_replay.exported[index]) ? s_replayStubs[index] : nullptr;
+}
+
+void ADLUtil_CloseReplayProfile()
+{
+    std::lock_guard<std::mutex> lock(s_replay.mutex);
+
+    s_replay.isOpen = false;
+
+    for (uint32_t i = 0; i < s_entrypointCount; ++i)
+    {
+        s_replay.exported[i] = false;
+        s_replay.callsByEntrypoint[i].clear();
+    }
+}
@@ -0,0 +1,56 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Recording of the ADL calls into a profile, and replay of a profile in place of the ADL library.
+//==============================================================================
+
+#ifndef _ADL_UTIL_REPLAY_H_
+#define _ADL_UTIL_REPLAY_H_
+
+#include <cstdint>
+#include <string>
+
+#include "ADLUtilEntrypoints.h"
+
+/// Identifies an adl_util replay profile ("ADLR")
+constexpr uint32_t ADLUTIL_REPLAY_MAGIC = 0x524C4441;
+
+/// Version of the replay profile layout. Bump this whenever the layout changes.
+constexpr uint32_t ADLUTIL_REPLAY_FORMAT_VERSION = 1;
+
+/// Starts capturing the calls made through the entry points wrapped by ADLUtil_WrapForRecording.
+/// Calls captured earlier are discarded.
+void ADLUtil_StartRecording();
+
+/// @returns true between ADLUtil_StartRecording and ADLUtil_StopRecording.
+bool ADLUtil_IsRecording();
+
+/// Wraps an entry point of the loaded library so that its calls are captured with their arguments, output payloads and latency
+/// @param[in] entrypoint      the entry point
+/// @param[in] pRealEntrypoint the address exported by the library
+/// @returns   the address of the recording wrapper, to be called instead of pRealEntrypoint.
+void* ADLUtil_WrapForRecording(ADLUtil_Entrypoint entrypoint, void* pRealEntrypoint);
+
+/// Stops capturing and writes the calls captured since ADLUtil_StartRecording as a replay profile.
+/// Must be called while the wrapped library is still loaded, after its last call.
+/// @param[in] path the path of the profile
+/// @returns   true if the profile was written.
+bool ADLUtil_StopRecording(const std::string& path);
+
+/// Loads a replay profile. The entry points returned by ADLUtil_GetReplayEntrypoint serve its calls from then on.
+/// @param[in] path          the path of the profile
+/// @param[in] replayLatency true to make each replayed call take as long as the recorded call did
+/// @returns   true if the profile was loaded.
+bool ADLUtil_OpenReplayProfile(const std::string& path, bool replayLatency);
+
+/// Returns the replay stand-in of an entry point. A stand-in answers a call with the next recorded call of the entry point
+/// that had the same input arguments, cycling through the recording; it returns ADL_ERR if there is none.
+/// @param[in] entrypoint the entry point
+/// @returns   the address of the stand-in, or nullptr if the recorded library did not export the entry point.
+void* ADLUtil_GetReplayEntrypoint(ADLUtil_Entrypoint entrypoint);
+
+/// Unloads the replay profile
+void ADLUtil_CloseReplayProfile();
+
+#endif //_ADL_UTIL_REPLAY_H_
@@ -0,0 +1,217 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  High-frequency GPU telemetry sampling through ADL.
+//==============================================================================
+
+#include <algorithm>
+#include <chrono>
+
+#include "ADLUtilSampler.h"
+#include "ADLUtilPhysicalGPUIndex.h"
+
+// Sleeping is only accurate to about a millisecond, so the last stretch before a tick is spent yielding instead
+static constexpr std::chrono::nanoseconds s_maxSpinWindow = std::chrono::milliseconds(2);
+
+// At high rates the spin window is capped to this fraction of the period, so that the sampling thread still sleeps every tick
+static constexpr int64_t s_spinWindowPeriodDivisor = 4;
+
+ADLUtil_TelemetrySampler::ADLUtil_TelemetrySampler() :
+    m_running(false),
+    m_periodNs(1000000),
+    m_tickCount(0),
+    m_missedTickCount(0),
+    m_consumers(std::make_shared<const ConsumerList>())
+{
+}
+
+ADLUtil_TelemetrySampler::~ADLUtil_TelemetrySampler()
+{
+    Stop();
+}
+
+ADLUtil_Result ADLUtil_TelemetrySampler::Start(unsigned int rateHz)
+{
+    Stop();
+
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+
+    AsicInfoListSnapshot asicInfoList;
+    ADLUtil_Result result = pADLUtils->GetAsicInfoList(asicInfoList);
+
+    if (ADL_SUCCESS != result && ADL_WARNING != result)
+    {
+        return result;
+    }
+
+    ADLUtil_Result leaseResult = pADLUtils->AcquireLease(m_libraryLease);
+
+    if (ADL_SUCCESS != leaseResult)
+    {
+        return leaseResult;
+    }
+
+    std::shared_ptr<const ADLUtil_PhysicalGPUIndex> physicalGPUIndex;
+    pADLUtils->GetPhysicalGPUIndex(physicalGPUIndex);
+
+    // the logical adapters of a GPU report the same counters, so query one per physical GPU
+    m_physicalGPUs.clear();
+    m_adapterIndices.clear();
+
+    for (uint32_t physicalGPU = 0; physicalGPU < physicalGPUIndex->GetCount(); ++physicalGPU)
+    {
+        m_physicalGPUs.push_back(physicalGPU);
+        m_adapterIndices.push_back((*asicInfoList)[physicalGPUIndex->GetFirstLogicalAdapter(physicalGPU)].adapterIndex);
+    }
+
+    SetRate(rateHz);
+    m_tickCount = 0;
+    m_missedTickCount = 0;
+    m_running = true;
+    m_thread = std::thread(&ADLUtil_TelemetrySampler::SamplingLoop, this);
+
+    return result;
+}
+
+void ADLUtil_TelemetrySampler::Stop()
+{
+    m_running = false;
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+    m_libraryLease.Release();
+}
+
+void ADLUtil_TelemetrySampler::SetRate(unsigned int rateHz)
+{
+    m_periodNs = 1000000000ull / std::max(rateHz, 1u);
+}
+
+std::shared_ptr<ADLUtil_TelemetryConsumer> ADLUtil_TelemetrySampler::AddConsumer(size_t capacity)
+{
+    std::shared_ptr<ADLUtil_TelemetryConsumer> consumer = std::make_shared<ADLUtil_TelemetryConsumer>(capacity);
+
+    std::lock_guard<std::mutex> lock(m_consumersMutex);
+    std::shared_ptr<ConsumerList> consumers = std::make_shared<ConsumerList>(*m_consumers.Load());
+    consumers->push_back(consumer);
+    m_consumers.Store(std::move(consumers));
+
+    return consumer;
+}
+
+void ADLUtil_TelemetrySampler::RemoveConsumer(const std::shared_ptr<ADLUtil_TelemetryConsumer>& consumer)
+{
+    std::lock_guard<std::mutex> lock(m_consumersMutex);
+    std::shared_ptr<ConsumerList> consumers = std::make_shared<ConsumerList>(*m_consumers.Load());
+    consumers->erase(std::remove(consumers->begin(), consumers->end(), consumer), consumers->end());
+    m_consumers.Store(std::move(consumers));
+}
+
+void ADLUtil_TelemetrySampler::SamplingLoop()
+{
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+    std::chrono::steady_clock::time_point nextTick = std::chrono::steady_clock::now();
+
+    std::vector<ADLUtil_TelemetrySample> samples(m_adapterIndices.size());
+
+    while (m_running.load(std::memory_order_relaxed))
+    {
+        uint64_t tick = m_tickCount.load(std::memory_order_relaxed);
+
+        // read every GPU first, then publish, so that the consumers see the adapters of a tick together
+        for (size_t i = 0; i < m_adapterIndices.size(); ++i)
+        {
+            ADLUtil_TelemetrySample& sample = samples[i];
+            sample.timestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+            sample.tick = tick;
+            sample.physicalGPU = m_physicalGPUs[i];
+            sample.adapterIndex = m_adapterIndices[i];
+            ReadAdapter(pADLUtils, m_adapterIndices[i], sample);
+        }
+
+        {
+            ADLUtil_AtomicSharedPtr<ConsumerList>::Reader consumers(m_consumers);
+
+            for (const std::shared_ptr<ADLUtil_TelemetryConsumer>& consumer : *consumers.Get())
+            {
+                for (const ADLUtil_TelemetrySample& sample : samples)
+                {
+                    if (!consumer->m_ringBuffer.TryPush(sample))
+                    {
+                        consumer->m_overrunCount.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        }
+
+        m_tickCount.store(tick + 1, std::memory_order_relaxed);
+
+        // schedule the next tick; if sampling fell behind, skip the ticks that were missed rather than bursting
+        std::chrono::nanoseconds period(m_periodNs.load(std::memory_order_relaxed));
+        nextTick += period;
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+        if (now > nextTick)
+        {
+            uint64_t missedTicks = static_cast<uint64_t>((now - nextTick) / period);
+            m_missedTickCount.fetch_add(missedTicks, std::memory_order_relaxed);
+            nextTick += period * missedTicks;
+        }
+
+        std::chrono::nanoseconds spinWindow = std::min<std::chrono::nanoseconds>(s_maxSpinWindow, period / s_spinWindowPeriodDivisor);
+
+        if (nextTick - now > spinWindow)
+        {
+            std::this_thread::sleep_until(nextTick - spinWindow);
+        }
+
+        while (std::chrono::steady_clock::now() < nextTick && m_running.load(std::memory_order_relaxed))
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void ADLUtil_TelemetrySampler::ReadAdapter(AMDTADLUtils* pADLUtils, int adapterIndex, ADLUtil_TelemetrySample& sample)
+{
+    ADL_CONTEXT_HANDLE adlContext = pADLUtils->GetContext();
+
+    ADLPMActivity activity = {};
+    activity.iSize = sizeof(activity);
+
+    if (ADL_OK == pADLUtils->Call<ADLUtil_Entrypoint::ADL2_Overdrive5_CurrentActivity_Get>(adlContext, adapterIndex, &activity))
+    {
+        sample.activityPercent = activity.iActivityPercent;
+        sample.engineClock = activity.iEngineClock;
+        sample.memoryClock = activity.iMemoryClock;
+    }
+    else
+    {
+        sample.activityPercent = ADLUTIL_TELEMETRY_UNAVAILABLE;
+        sample.engineClock = ADLUTIL_TELEMETRY_UNAVAILABLE;
+        sample.memoryClock = ADLUTIL_TELEMETRY_UNAVAILABLE;
+    }
+
+    ADLTemperature temperature = {};
+    temperature.iSize = sizeof(temperature);
+
+    // thermal controller 0 is the GPU die
+    sample.temperature = (ADL_OK == pADLUtils->Call<ADLUtil_Entrypoint::ADL2_Overdrive5_Temperature_Get>(adlContext, adapterIndex, 0, &temperature)) ?
+                             temperature.iTemperature : ADLUTIL_TELEMETRY_UNAVAILABLE;
+
+    ADLFanSpeedValue fanSpeed = {};
+    fanSpeed.iSize = sizeof(fanSpeed);
+    fanSpeed.iSpeedType = ADL_DL_FANCTRL_SPEED_TYPE_RPM;
+
+    sample.fanSpeedRPM = (ADL_OK == pADLUtils->Call<ADLUtil_Entrypoint::ADL2_Overdrive5_FanSpeed_Get>(adlContext, adapterIndex, 0, &fanSpeed)) ?
+                             fanSpeed.iFanSpeed : ADLUTIL_TELEMETRY_UNAVAILABLE;
+
+    int vramUsageMB = 0;
+    sample.vramUsageMB = (ADL_OK == pADLUtils->Call<ADLUtil_Entrypoint::ADL2_Adapter_VRAMUsage_Get>(adlContext, adapterIndex, &vramUsageMB)) ?
+                             vramUsageMB : ADLUTIL_TELEMETRY_UNAVAILABLE;
+}
@@ -0,0 +1,207 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  High-frequency GPU telemetry sampling through ADL.
+//==============================================================================
+
+#ifndef _ADL_UTIL_SAMPLER_H_
+#define _ADL_UTIL_SAMPLER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ADLUtilAtomicSharedPtr.h"
+#include "ADLUtilEntrypoints.h"
+
+/// Value of an ADLUtil_TelemetrySample counter that the driver could not provide
+constexpr int32_t ADLUTIL_TELEMETRY_UNAVAILABLE = INT32_MIN;
+
+/// One telemetry reading of one physical GPU
+struct ADLUtil_TelemetrySample
+{
+    uint64_t timestampNs;     ///< steady clock time the GPU was read at, in nanoseconds
+    uint64_t tick;            ///< number of the tick that produced the sample
+    uint32_t physicalGPU;     ///< index of the GPU in the ADLUtil_PhysicalGPUIndex the sampler was started with
+    int32_t  adapterIndex;    ///< the ADL adapter index that was queried
+    int32_t  activityPercent; ///< GPU activity in percent
+    int32_t  engineClock;     ///< engine clock in 10 kHz units
+    int32_t  memoryClock;     ///< memory clock in 10 kHz units
+    int32_t  temperature;     ///< temperature in millidegrees Celsius
+    int32_t  fanSpeedRPM;     ///< fan speed in RPM
+    int32_t  vramUsageMB;     ///< dedicated VRAM in use, in MB
+};
+
+//------------------------------------------------------------------------------------
+/// Lock-free ring buffer for exactly one producer thread and one consumer thread
+//------------------------------------------------------------------------------------
+template <typename T>
+class ADLUtil_SPSCRingBuffer
+{
+public:
+    /// constructor
+    /// @param[in] capacity the minimum number of elements the buffer holds, rounded up to a power of two
+    explicit ADLUtil_SPSCRingBuffer(size_t capacity) :
+        m_head(0),
+        m_tail(0)
+    {
+        size_t roundedCapacity = 1;
+
+        while (roundedCapacity < capacity)
+        {
+            roundedCapacity <<= 1;
+        }
+
+        m_elements.resize(roundedCapacity);
+        m_mask = roundedCapacity - 1;
+    }
+
+    /// Appends an element. Only call from the producer thread.
+    /// @returns false if the buffer is full.
+    bool TryPush(const T& element)
+    {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+
+        if (tail - m_head.load(std::memory_order_acquire) > m_mask)
+        {
+            return false;
+        }
+
+        m_elements[tail & m_mask] = element;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Removes the oldest element. Only call from the consumer thread.
+    /// @returns false if the buffer is empty.
+    bool TryPop(T& element)
+    {
+        size_t head = m_head.load(std::memory_order_relaxed);
+
+        if (head == m_tail.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        element = m_elements[head & m_mask];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @returns the number of elements the buffer holds.
+    size_t GetCapacity() const { return m_mask + 1; }
+
+private:
+    std::vector<T>                  m_elements; ///< storage, its size is a power of two
+    size_t                          m_mask;     ///< capacity - 1
+    alignas(64) std::atomic<size_t> m_head;     ///< next element to pop, written by the consumer
+    alignas(64) std::atomic<size_t> m_tail;     ///< next element to push, written by the producer
+};
+
+//------------------------------------------------------------------------------------
+/// A reader of the telemetry stream. Each consumer has its own ring buffer, which must
+/// only be drained from one thread at a time.
+//------------------------------------------------------------------------------------
+class ADLUtil_TelemetryConsumer
+{
+public:
+    /// constructor
+    /// @param[in] capacity the minimum number of samples buffered for this consumer
+    explicit ADLUtil_TelemetryConsumer(size_t capacity) :
+        m_ringBuffer(capacity),
+        m_overrunCount(0)
+    {
+    }
+
+    /// Removes the oldest sample
+    /// @returns false if no sample is buffered.
+    bool TryPop(ADLUtil_TelemetrySample& sample) { return m_ringBuffer.TryPop(sample); }
+
+    /// @returns the number of samples dropped because this consumer's buffer was full.
+    uint64_t GetOverrunCount() const { return m_overrunCount.load(std::memory_order_relaxed); }
+
+private:
+    friend class ADLUtil_TelemetrySampler;
+
+    ADLUtil_SPSCRingBuffer<ADLUtil_TelemetrySample> m_ringBuffer;   ///< samples not read yet
+    std::atomic<uint64_t>                           m_overrunCount; ///< samples dropped on a full buffer
+};
+
+//------------------------------------------------------------------------------------
+/// Polls activity, clocks, temperature, fan speed and VRAM usage of every physical GPU
+/// on a dedicated thread, and hands every sample to every registered consumer.
+/// All GPUs are read back to back in one tick. A consumer that falls behind loses the
+/// samples that do not fit its buffer, which is counted instead of blocking the sampler.
+//------------------------------------------------------------------------------------
+class ADLUtil_TelemetrySampler
+{
+public:
+    /// constructor
+    ADLUtil_TelemetrySampler();
+
+    /// destructor, stops sampling
+    ~ADLUtil_TelemetrySampler();
+
+    ADLUtil_TelemetrySampler(const ADLUtil_TelemetrySampler&) = delete;
+    ADLUtil_TelemetrySampler& operator=(const ADLUtil_TelemetrySampler&) = delete;
+
+    /// Enumerates the physical GPUs and starts the sampling thread
+    /// @param[in] rateHz the number of ticks per second
+    /// @returns   an enum ADLUtil_Result status code of the enumeration.
+    ADLUtil_Result Start(unsigned int rateHz);
+
+    /// Stops the sampling thread. Buffered samples stay readable.
+    void Stop();
+
+    /// Changes the sampling rate of a running sampler
+    /// @param[in] rateHz the number of ticks per second
+    void SetRate(unsigned int rateHz);
+
+    /// Registers a new consumer. Consumers may be added while the sampler is running.
+    /// @param[in] capacity the minimum number of samples buffered for the consumer
+    /// @returns   the consumer.
+    std::shared_ptr<ADLUtil_TelemetryConsumer> AddConsumer(size_t capacity);
+
+    /// Unregisters a consumer
+    /// @param[in] consumer the consumer returned by AddConsumer
+    void RemoveConsumer(const std::shared_ptr<ADLUtil_TelemetryConsumer>& consumer);
+
+    /// @returns the number of ticks sampled since Start.
+    uint64_t GetTickCount() const { return m_tickCount.load(std::memory_order_relaxed); }
+
+    /// @returns the number of ticks skipped because sampling took longer than the tick period.
+    uint64_t GetMissedTickCount() const { return m_missedTickCount.load(std::memory_order_relaxed); }
+
+private:
+    typedef std::vector<std::shared_ptr<ADLUtil_TelemetryConsumer>> ConsumerList; ///< the registered consumers
+
+    /// Body of the sampling thread
+    void SamplingLoop();
+
+    /// Reads the counters of one adapter
+    /// @param[in]  pADLUtils    the ADL wrapper
+    /// @param[in]  adapterIndex the ADL adapter index
+    /// @param[out] sample       the sample to fill
+    static void ReadAdapter(AMDTADLUtils* pADLUtils, int adapterIndex, ADLUtil_TelemetrySample& sample);
+
+    AMDTADLUtils::Lease                 m_libraryLease;    ///< keeps the ADL library loaded while sampling
+    std::thread                         m_thread;          ///< the sampling thread
+    std::atomic<bool>                   m_running;         ///< false tells the sampling thread to exit
+    std::atomic<uint64_t>               m_periodNs;        ///< tick period in nanoseconds
+    std::atomic<uint64_t>               m_tickCount;       ///< ticks sampled since Start
+    std::atomic<uint64_t>               m_missedTickCount; ///< ticks skipped since Start
+    std::vector<uint32_t>               m_physicalGPUs;    ///< physical GPU index of each sampled adapter
+    std::vector<int>                    m_adapterIndices;  ///< ADL adapter index sampled for each physical GPU
+
+    std::mutex                          m_consumersMutex;  ///< serializes changes to m_consumers
+
+    /// The registered consumers, replaced as a whole on changes. The sampling thread reads the list in place, without locking
+    /// or touching its reference count.
+    ADLUtil_AtomicSharedPtr<ConsumerList> m_consumers;
+};
+
+#endif //_ADL_UTIL_SAMPLER_H_
@@ -0,0 +1,235 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Enumeration of AMD adapters from the Linux sysfs tree, without loading the ADL library.
+//==============================================================================
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "ADLUtil.h"
+#include "ADLUtilSysfs.h"
+#include "ADLUtilASICDatabase.h"
+
+// PCI base class of display controllers, in the top byte of the 24 bit class code
+static constexpr unsigned long s_displayControllerClass = 0x03;
+
+bool ADLUtil_ReadSysfsAttribute(const std::string& path, std::string& value)
+{
+    FILE* pFile = fopen(path.c_str(), "r");
+
+    if (nullptr == pFile)
+    {
+        return false;
+    }
+
+    char buffer[256];
+    bool isRead = nullptr != fgets(buffer, sizeof(buffer), pFile);
+    fclose(pFile);
+
+    if (isRead)
+    {
+        value.assign(buffer, strcspn(buffer, "\r\n"));
+    }
+
+    return isRead;
+}
+
+// Reads a sysfs attribute holding a hex number, ie "0x1002"
+static bool ReadHexAttribute(const std::filesystem::path& path, unsigned long& value)
+{
+    std::string text;
+
+    if (!ADLUtil_ReadSysfsAttribute(path.string(), text) || text.empty())
+    {
+        return false;
+    }
+
+    char* pEnd = nullptr;
+    value = strtoul(text.c_str(), &pEnd, 16);
+    return '\0' == *pEnd;
+}
+
+// A PCI display controller found in sysfs
+struct SysfsDevice
+{
+    unsigned int          domain;   ///< the PCI domain
+    unsigned int          bus;      ///< the PCI bus number
+    unsigned int          device;   ///< the PCI device number
+    unsigned int          function; ///< the PCI function number
+    std::filesystem::path path;     ///< the device directory
+};
+
+// Maps the PCI slot name ("0000:03:00.0") of each device with a DRM card to the card directory
+static std::unordered_map<std::string, std::filesystem::path> FindDRMCards(const std::filesystem::path& drmPath)
+{
+    std::unordered_map<std::string, std::filesystem::path> cards;
+    std::error_code                                        error;
+
+    for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(drmPath, error))
+    {
+        // "card0", but not its connectors such as "card0-DP-1"
+        std::string name = entry.path().filename().string();
+
+        if (0 != name.compare(0, 4, "card") || name.size() == 4 || std::string::npos != name.find_first_not_of("0123456789", 4))
+        {
+            continue;
+        }
+
+        // the uevent names the slot whether device is the kernel's symlink or a directory of a fake tree
+        FILE* pFile = fopen((entry.path() / "device" / "uevent").string().c_str(), "r");
+
+        if (nullptr == pFile)
+        {
+            continue;
+        }
+
+        char line[256];
+
+        while (nullptr != fgets(line, sizeof(line), pFile))
+        {
+            static constexpr std::string_view s_slotNameKey = "PCI_SLOT_NAME=";
+
+            if (0 == strncmp(line, s_slotNameKey.data(), s_slotNameKey.size()))
+            {
+                cards[std::string(line + s_slotNameKey.size(), strcspn(line + s_slotNameKey.size(), "\r\n"))] = entry.path();
+                break;
+            }
+        }
+
+        fclose(pFile);
+    }
+
+    return cards;
+}
+
+ADLUtil_Result ADLUtil_EnumerateSysfsAdapters(const std::string& sysfsRoot, AsicInfoList& asicInfoList)
+{
+    std::filesystem::path devicesPath = std::filesystem::path(sysfsRoot) / "bus" / "pci" / "devices";
+    std::error_code       error;
+    std::filesystem::directory_iterator deviceIterator(devicesPath, error);
+
+    if (error)
+    {
+        return ADL_NOT_FOUND;
+    }
+
+    ADLUtil_Result           result = ADL_SUCCESS;
+    std::vector<SysfsDevice> devices;
+
+    for (const std::filesystem::directory_entry& entry : deviceIterator)
+    {
+        SysfsDevice device;
+        device.path = entry.path();
+
+        unsigned long classCode = 0;
+        unsigned long vendorID = 0;
+
+        if (4 != sscanf(device.path.filename().string().c_str(), "%x:%x:%x.%x", &device.domain, &device.bus, &device.device, &device.function) ||
+            !ReadHexAttribute(device.path / "class", classCode) ||
+            s_displayControllerClass != (classCode >> 16) ||
+            !ReadHexAttribute(device.path / "vendor", vendorID) ||
+            ADLUTIL_AMD_VENDOR_ID != static_cast<int>(vendorID))
+        {
+            continue;
+        }
+
+        devices.push_back(device);
+    }
+
+    // directory order is arbitrary; list the adapters in bus order like ADL does
+    std::sort(devices.begin(), devices.end(), [](const SysfsDevice& lhs, const SysfsDevice& rhs)
+    {
+        return std::tie(lhs.domain, lhs.bus, lhs.device, lhs.function) < std::tie(rhs.domain, rhs.bus, rhs.device, rhs.function);
+    });
+
+    std::unordered_map<std::string, std::filesystem::path> cards = FindDRMCards(std::filesystem::path(sysfsRoot) / "class" / "drm");
+
+    asicInfoList.reserve(asicInfoList.size() + devices.size());
+
+    for (const SysfsDevice& device : devices)
+    {
+        unsigned long deviceID = 0;
+        unsigned long revID = 0;
+        unsigned long subsystemVendorID = 0;
+        unsigned long subsystemDeviceID = 0;
+
+        if (!ReadHexAttribute(device.path / "device", deviceID) ||
+            !ReadHexAttribute(device.path / "revision", revID) ||
+            !ReadHexAttribute(device.path / "subsystem_vendor", subsystemVendorID) ||
+            !ReadHexAttribute(device.path / "subsystem_device", subsystemDeviceID))
+        {
+            // keep the adapter, but tell the caller its IDs are incomplete
+            result = ADL_WARNING;
+        }
+
+        char udid[64];
+        snprintf(udid, sizeof(udid), "PCI_VEN_%04X&DEV_%04lX&SUBSYS_%04lX%04lX&REV_%02lX", ADLUTIL_AMD_VENDOR_ID, deviceID, subsystemDeviceID, subsystemVendorID, revID);
+
+        asicInfoList.emplace_back();
+        ADLUtil_ASICInfo& asicInfo = asicInfoList.back();
+
+        asicInfo.udid = udid;
+        asicInfo.gpuIndex = static_cast<unsigned int>(asicInfoList.size() - 1);
+        asicInfo.adapterIndex = static_cast<int>(asicInfoList.size() - 1);
+
+        ADLUtil_PCIIdentity pciIdentity;
+        ADLUtil_ParseUDID(asicInfo.udid, pciIdentity);
+
+        asicInfo.vendorID       = pciIdentity.vendorID;
+        asicInfo.deviceID       = pciIdentity.deviceID;
+        asicInfo.deviceIDString = pciIdentity.deviceIDString;
+        asicInfo.revID          = pciIdentity.revID;
+        asicInfo.subsystemID    = pciIdentity.subsystemID;
+
+        asicInfo.busNumber      = static_cast<int>(device.bus);
+        asicInfo.deviceNumber   = static_cast<int>(device.device);
+        asicInfo.functionNumber = static_cast<int>(device.function);
+
+        // ADL adapters have no domain; keep it so that the topology is read from the right device
+        asicInfo.topology.pciDomain = static_cast<int>(device.domain);
+
+        asicInfo.registryPath = device.path.string();
+
+        std::unordered_map<std::string, std::filesystem::path>::const_iterator card = cards.find(device.path.filename().string());
+
+        if (cards.end() != card)
+        {
+            asicInfo.registryPathExt = card->second.string();
+        }
+
+        ADLUtil_ASICDatabase::Classify(asicInfo);
+
+        // amdgpu only reports a marketing name for some boards
+        std::string productName;
+
+        if (ADLUtil_ReadSysfsAttribute((device.path / "product_name").string(), productName) && !productName.empty())
+        {
+            asicInfo.adapterName = productName;
+        }
+        else
+        {
+            asicInfo.adapterName = asicInfo.family.empty() ? std::string("AMD Radeon Graphics") : "AMD " + asicInfo.family.str();
+        }
+    }
+
+    return result;
+}
+
+ADLUtil_Result ADLUtil_QuerySysfsDriverVersion(const std::string& sysfsRoot, std::string& driverVersion)
+{
+    if (!ADLUtil_ReadSysfsAttribute((std::filesystem::path(sysfsRoot) / "module" / "amdgpu" / "version").string(), driverVersion) || driverVersion.empty())
+    {
+        return ADL_GRAPHICS_VERSIONS_GET_FAILED;
+    }
+
+    return ADL_SUCCESS;
+}
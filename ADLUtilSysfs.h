@@ -0,0 +1,39 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Enumeration of AMD adapters from the Linux sysfs tree, without loading the ADL library.
+//==============================================================================
+
+#ifndef _ADL_UTIL_SYSFS_H_
+#define _ADL_UTIL_SYSFS_H_
+
+#include <string>
+
+#include "ADLUtilTypes.h"
+
+/// Root of the sysfs tree used unless AMDTADLUtils::SetSysfsRoot overrides it
+constexpr const char* ADLUTIL_DEFAULT_SYSFS_ROOT = "/sys";
+
+/// Reads the first line of a small sysfs attribute
+/// @param[in]  path  the path of the attribute
+/// @param[out] value the first line without the trailing newline
+/// @returns    true if the attribute was read.
+bool ADLUtil_ReadSysfsAttribute(const std::string& path, std::string& value);
+
+/// Enumerates the AMD display controllers under <sysfsRoot>/bus/pci/devices, in PCI bus order. The DRM card of each
+/// adapter is looked up under <sysfsRoot>/class/drm. Adapters get a UDID in the format ADL uses, so that they
+/// diff and classify like ADL adapters; adapterIndex and gpuIndex are the position in the list.
+/// @param[in]  sysfsRoot    the root of the sysfs tree, ie "/sys" or a fake tree
+/// @param[out] asicInfoList the list to populate with the available ASICs
+/// @returns    ADL_SUCCESS, ADL_WARNING if an adapter could not be read completely, or ADL_NOT_FOUND if there is no PCI device directory.
+ADLUtil_Result ADLUtil_EnumerateSysfsAdapters(const std::string& sysfsRoot, AsicInfoList& asicInfoList);
+
+/// Reads the version of the loaded amdgpu module from <sysfsRoot>/module/amdgpu/version.
+/// Only out-of-tree (DKMS) builds of the module report a version.
+/// @param[in]  sysfsRoot     the root of the sysfs tree
+/// @param[out] driverVersion the version string
+/// @returns    ADL_SUCCESS, or ADL_GRAPHICS_VERSIONS_GET_FAILED if the module does not report a version.
+ADLUtil_Result ADLUtil_QuerySysfsDriverVersion(const std::string& sysfsRoot, std::string& driverVersion);
+
+#endif //_ADL_UTIL_SYSFS_H_
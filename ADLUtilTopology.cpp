@@ -0,0 +1,194 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  PCI topology and NUMA placement of the adapters, read from the Linux sysfs tree.
+//==============================================================================
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <unordered_map>
+
+#include "ADLUtilTopology.h"
+#include "ADLUtilPhysicalGPUIndex.h"
+#include "ADLUtilSysfs.h"
+
+// Parses a link speed attribute, ie "16.0 GT/s PCIe" or "2.5 GT/s", into MT/s. "Unknown" yields 0.
+static uint32_t ParseLinkSpeed(const std::string& linkSpeed)
+{
+    char*  pEnd = nullptr;
+    double gigaTransfers = strtod(linkSpeed.c_str(), &pEnd);
+
+    return (pEnd == linkSpeed.c_str() || 0.0 >= gigaTransfers) ? 0 : static_cast<uint32_t>(gigaTransfers * 1000.0 + 0.5);
+}
+
+// Parses a decimal attribute such as a link width, 0 if it is not a number
+static uint32_t ParseCount(const std::string& count)
+{
+    char*         pEnd = nullptr;
+    unsigned long value = strtoul(count.c_str(), &pEnd, 10);
+
+    return (pEnd == count.c_str()) ? 0 : static_cast<uint32_t>(value);
+}
+
+bool ADLUtil_ReadPCITopology(const std::string& sysfsRoot, int pciDomain, int busNumber, int deviceNumber, int functionNumber, ADLUtil_PCITopology& topology)
+{
+    topology = ADLUtil_PCITopology();
+    topology.pciDomain = pciDomain;
+
+    char slotName[32];
+    snprintf(slotName, sizeof(slotName), "%04x:%02x:%02x.%x", pciDomain, busNumber, deviceNumber, functionNumber);
+
+    std::string devicePath = sysfsRoot + "/bus/pci/devices/" + slotName + '/';
+    std::string value;
+
+    // every PCI device has a class; without it the device is not there
+    if (!ADLUtil_ReadSysfsAttribute(devicePath + "class", value))
+    {
+        return false;
+    }
+
+    if (ADLUtil_ReadSysfsAttribute(devicePath + "current_link_speed", value))
+    {
+        topology.linkSpeedMTs = ParseLinkSpeed(value);
+    }
+
+    if (ADLUtil_ReadSysfsAttribute(devicePath + "current_link_width", value))
+    {
+        topology.linkWidth = ParseCount(value);
+    }
+
+    if (ADLUtil_ReadSysfsAttribute(devicePath + "max_link_speed", value))
+    {
+        topology.maxLinkSpeedMTs = ParseLinkSpeed(value);
+    }
+
+    if (ADLUtil_ReadSysfsAttribute(devicePath + "max_link_width", value))
+    {
+        topology.maxLinkWidth = ParseCount(value);
+    }
+
+    if (ADLUtil_ReadSysfsAttribute(devicePath + "numa_node", value))
+    {
+        char* pEnd = nullptr;
+        long  numaNode = strtol(value.c_str(), &pEnd, 10);
+        topology.numaNode = (pEnd == value.c_str() || 0 > numaNode) ? -1 : static_cast<int>(numaNode);
+    }
+
+    if (!ADLUtil_ReadSysfsAttribute(devicePath + "local_cpulist", value) || !ADLUtil_ParseCPUList(value, topology.localCPUs))
+    {
+        topology.localCPUs.clear();
+    }
+
+    return true;
+}
+
+void ADLUtil_FillAdapterTopology(const std::string& sysfsRoot, AsicInfoList& asicInfoList)
+{
+    ADLUtil_PhysicalGPUIndex physicalGPUIndex(asicInfoList);
+
+    // the logical adapters of a physical GPU share its topology, so read it once per GPU
+    std::unordered_map<uint32_t, uint32_t> topologySource;
+
+    for (size_t i = 0; i < asicInfoList.size(); ++i)
+    {
+        ADLUtil_ASICInfo& asicInfo = asicInfoList[i];
+        uint32_t          physicalGPU = physicalGPUIndex.FindByBusLocation(asicInfo.topology.pciDomain, asicInfo.busNumber, asicInfo.deviceNumber, asicInfo.functionNumber);
+
+        asicInfo.gpuIndex = physicalGPU;
+
+        std::pair<std::unordered_map<uint32_t, uint32_t>::iterator, bool> insert = topologySource.try_emplace(physicalGPU, static_cast<uint32_t>(i));
+
+        if (insert.second)
+        {
+            ADLUtil_ReadPCITopology(sysfsRoot, asicInfo.topology.pciDomain, asicInfo.busNumber, asicInfo.deviceNumber, asicInfo.functionNumber, asicInfo.topology);
+        }
+        else
+        {
+            asicInfo.topology = asicInfoList[insert.first->second].topology;
+        }
+    }
+}
+
+bool ADLUtil_ParseCPUList(std::string_view cpuList, std::vector<uint32_t>& cpus)
+{
+    cpus.clear();
+
+    while (!cpuList.empty())
+    {
+        uint32_t range[2] = {0, 0};
+        size_t   rangeEnd = std::min(cpuList.find(','), cpuList.size());
+        size_t   pos = 0;
+
+        for (uint32_t& bound : range)
+        {
+            size_t digitStart = pos;
+
+            while (pos < rangeEnd && '0' <= cpuList[pos] && '9' >= cpuList[pos])
+            {
+                bound = bound * 10 + static_cast<uint32_t>(cpuList[pos++] - '0');
+            }
+
+            if (digitStart == pos)
+            {
+                return false;
+            }
+
+            if (pos == rangeEnd)
+            {
+                if (&bound == &range[0])
+                {
+                    // a single CPU rather than a range
+                    range[1] = range[0];
+                }
+
+                break;
+            }
+
+            if ('-' != cpuList[pos++] || &bound == &range[1])
+            {
+                return false;
+            }
+        }
+
+        if (range[1] < range[0])
+        {
+            return false;
+        }
+
+        for (uint32_t cpu = range[0]; cpu <= range[1]; ++cpu)
+        {
+            cpus.push_back(cpu);
+        }
+
+        cpuList.remove_prefix(std::min(rangeEnd + 1, cpuList.size()));
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return true;
+}
+
+bool ADLUtil_GetCPUAffinity(const ADLUtil_ASICInfo& asicInfo, std::vector<uint32_t>& cpus)
+{
+    cpus = asicInfo.topology.localCPUs;
+    return !cpus.empty();
+}
+
+#ifdef __linux__
+bool ADLUtil_GetCPUAffinity(const ADLUtil_ASICInfo& asicInfo, cpu_set_t& cpuSet)
+{
+    CPU_ZERO(&cpuSet);
+
+    for (uint32_t cpu : asicInfo.topology.localCPUs)
+    {
+        if (CPU_SETSIZE > cpu)
+        {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+
+    return 0 < CPU_COUNT(&cpuSet);
+}
+#endif
@@ -0,0 +1,59 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  PCI topology and NUMA placement of the adapters, read from the Linux sysfs tree.
+//==============================================================================
+
+#ifndef _ADL_UTIL_TOPOLOGY_H_
+#define _ADL_UTIL_TOPOLOGY_H_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "ADLUtilTypes.h"
+
+/// Reads the link and NUMA attributes of the PCI device <sysfsRoot>/bus/pci/devices/<domain>:<bus>:<device>.<function>.
+/// The topology is left at its defaults if the device has no sysfs directory, ie on Windows.
+/// @param[in]  sysfsRoot      the root of the sysfs tree, ie "/sys" or a synthetic tree
+/// @param[in]  pciDomain      the PCI domain
+/// @param[in]  busNumber      the PCI bus number
+/// @param[in]  deviceNumber   the PCI device number
+/// @param[in]  functionNumber the PCI function number
+/// @param[out] topology       the topology of the device; pciDomain is set even if nothing else is found
+/// @returns    true if the device directory was found.
+bool ADLUtil_ReadPCITopology(const std::string& sysfsRoot, int pciDomain, int busNumber, int deviceNumber, int functionNumber, ADLUtil_PCITopology& topology);
+
+/// Numbers the physical GPUs of an enumeration and reads their topology. Logical adapters at the same PCI domain and bus location
+/// get the same gpuIndex, numbered in the order they first appear in the list.
+/// @param[in]     sysfsRoot    the root of the sysfs tree
+/// @param[in,out] asicInfoList the adapters; gpuIndex and topology are overwritten
+void ADLUtil_FillAdapterTopology(const std::string& sysfsRoot, AsicInfoList& asicInfoList);
+
+/// Parses a Linux CPU list, ie "0-7,16-23"
+/// @param[in]  cpuList the CPU list
+/// @param[out] cpus    the listed CPUs in ascending order
+/// @returns    true if the whole list was parsed.
+bool ADLUtil_ParseCPUList(std::string_view cpuList, std::vector<uint32_t>& cpus);
+
+/// Returns the CPUs to run the host threads of an adapter on, the CPUs local to its NUMA node
+/// @param[in]  asicInfo the adapter
+/// @param[out] cpus     the CPUs in ascending order
+/// @returns    true if the local CPUs of the adapter are known; otherwise cpus is empty and any CPU is as good as another.
+bool ADLUtil_GetCPUAffinity(const ADLUtil_ASICInfo& asicInfo, std::vector<uint32_t>& cpus);
+
+#ifdef __linux__
+/// Returns the CPU affinity set of an adapter, to pass to sched_setaffinity or pthread_setaffinity_np
+/// @param[in]  asicInfo  the adapter
+/// @param[out] cpuSet    the CPUs local to the adapter; CPUs beyond CPU_SETSIZE are left out
+/// @returns    true if the local CPUs of the adapter are known; otherwise cpuSet is empty.
+bool ADLUtil_GetCPUAffinity(const ADLUtil_ASICInfo& asicInfo, cpu_set_t& cpuSet);
+#endif
+
+#endif //_ADL_UTIL_TOPOLOGY_H_
@@ -0,0 +1,331 @@
+//==============================================================================
+// Copyright (c) 2011-2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  ADLUtil value types. These do not depend on ADL or Windows headers.
+//==============================================================================
+
+#ifndef _ADL_UTIL_TYPES_H_
+#define _ADL_UTIL_TYPES_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/// Architecture generation of an AMD ASIC, resolved from the device database
+enum class ADLUtil_ASICGeneration : uint8_t
+{
+    Unknown, ///< not an AMD GPU, or no ID was parsed
+    GCN1,    ///< Graphics Core Next 1, Southern Islands
+    GCN2,    ///< Graphics Core Next 2, Sea Islands
+    GCN3,    ///< Graphics Core Next 3, Volcanic Islands
+    GCN4,    ///< Graphics Core Next 4, Polaris
+    GCN5,    ///< Graphics Core Next 5, Vega
+    RDNA1,   ///< RDNA 1
+    RDNA2,   ///< RDNA 2
+    RDNA3,   ///< RDNA 3
+    RDNA3_5, ///< RDNA 3.5
+    RDNA4,   ///< RDNA 4
+    CDNA1,   ///< CDNA 1
+    CDNA2,   ///< CDNA 2
+    CDNA3,   ///< CDNA 3
+};
+
+/// How the generation and family of an ASIC were resolved from the device database
+enum class ADLUtil_ASICMatch : uint8_t
+{
+    None,    ///< not resolved, the generation is Unknown
+    Exact,   ///< the device and revision are listed
+    Device,  ///< the device is listed for all of its revisions
+    Nearest, ///< the device is not listed; the generation is that of the listed device with the closest ID, the family is empty
+};
+
+/// PCI Express link and NUMA placement of an adapter. Only filled where the platform exposes it (Linux sysfs).
+struct ADLUtil_PCITopology
+{
+    int                   pciDomain       = 0;  ///< the PCI domain (segment)
+    uint32_t              linkSpeedMTs    = 0;  ///< current link speed in MT/s per lane, ie 16000 for PCIe 4.0, 0 if unknown
+    uint32_t              linkWidth       = 0;  ///< current number of lanes, 0 if unknown
+    uint32_t              maxLinkSpeedMTs = 0;  ///< maximum link speed in MT/s per lane, 0 if unknown
+    uint32_t              maxLinkWidth    = 0;  ///< maximum number of lanes, 0 if unknown
+    int                   numaNode        = -1; ///< the NUMA node closest to the adapter, -1 if unknown or the system is not NUMA
+    std::vector<uint32_t> localCPUs;            ///< the logical CPUs closest to the adapter, in ascending order, empty if unknown
+};
+
+/// String stored in a fixed buffer inside the object, so that filling the adapter records of an enumeration does not
+/// allocate per adapter. Values longer than Capacity - 1 characters are truncated.
+template <size_t Capacity>
+class ADLUtil_InlineString
+{
+public:
+    /// constructor, creates an empty string
+    ADLUtil_InlineString() { m_data[0] = '\0'; }
+
+    /// constructors, copy the value
+    ADLUtil_InlineString(std::string_view value) { assign(value); }
+    ADLUtil_InlineString(const char* value) { assign(std::string_view(value)); }
+    ADLUtil_InlineString(const std::string& value) { assign(std::string_view(value)); }
+
+    ADLUtil_InlineString& operator=(std::string_view value) { assign(value); return *this; }
+    ADLUtil_InlineString& operator=(const char* value) { assign(std::string_view(value)); return *this; }
+    ADLUtil_InlineString& operator=(const std::string& value) { assign(std::string_view(value)); return *this; }
+
+    /// Replaces the value, truncating it to the capacity
+    void assign(std::string_view value)
+    {
+        m_size = (value.size() < Capacity) ? static_cast<uint32_t>(value.size()) : static_cast<uint32_t>(Capacity - 1);
+        memcpy(m_data, value.data(), m_size);
+        m_data[m_size] = '\0';
+    }
+
+    void clear() { assign(std::string_view()); }
+
+    const char* c_str() const { return m_data; }
+    const char* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    size_t length() const { return m_size; }
+    bool empty() const { return 0 == m_size; }
+
+    /// @returns the longest value that is stored without truncation.
+    static constexpr size_t capacity() { return Capacity - 1; }
+
+    operator std::string_view() const { return std::string_view(m_data, m_size); }
+    operator std::string() const { return str(); }
+
+    /// @returns a std::string copy of the value.
+    std::string str() const { return std::string(m_data, m_size); }
+
+    friend bool operator==(const ADLUtil_InlineString& lhs, std::string_view rhs) { return std::string_view(lhs) == rhs; }
+    friend bool operator!=(const ADLUtil_InlineString& lhs, std::string_view rhs) { return std::string_view(lhs) != rhs; }
+    friend bool operator<(const ADLUtil_InlineString& lhs, std::string_view rhs) { return std::string_view(lhs) < rhs; }
+
+private:
+    uint32_t m_size = 0;        ///< length of the value
+    char     m_data[Capacity];  ///< the value, NUL-terminated
+};
+
+/// The strings of ADLUtil_ASICInfo that ADL reports, in buffers of ADL_MAX_PATH (256) characters
+typedef ADLUtil_InlineString<256> ADLUtil_AdapterString;
+
+/// The device ID string of ADLUtil_ASICInfo, the four hex digits of the UDID
+typedef ADLUtil_InlineString<8> ADLUtil_DeviceIDString;
+
+/// The family of ADLUtil_ASICInfo, as long as the family column of the device database allows
+typedef ADLUtil_InlineString<32> ADLUtil_FamilyString;
+
+/// Stores ASIC information that is parsed from data supplied by ADL
+struct ADLUtil_ASICInfo
+{
+    ADLUtil_AdapterString adapterName;     ///< description of the adapter ie "ATI Radeon HD 5800 series"
+    ADLUtil_DeviceIDString deviceIDString; ///< string version of the deviceID (for easy comparing since the deviceID is hex, but stored as int)
+    int vendorID;                 ///< the vendor ID
+    int deviceID;                 ///< the device ID (hex value stored as int)
+    int revID;                    ///< the revision ID (hex value stored as int)
+    unsigned int subsystemID;     ///< the subsystem ID, subsystem device ID in the high and subsystem vendor ID in the low 16 bits
+    int busNumber;                ///< the PCI bus number
+    int deviceNumber;             ///< the PCI device number
+    int functionNumber;           ///< the PCI function number
+    unsigned int gpuIndex;        ///< GPU index in the system, shared by the logical adapters of one physical GPU
+    int adapterIndex;             ///< the ADL adapter index, used to address the adapter in per-adapter ADL calls
+    ADLUtil_AdapterString udid;            ///< the ADL unique device ID, together with the PCI bus location it identifies the adapter across enumerations
+    ADLUtil_AdapterString registryPath;    ///< Adapter registry path
+    ADLUtil_AdapterString registryPathExt; ///< Adapter registry path
+    ADLUtil_ASICGeneration generation = ADLUtil_ASICGeneration::Unknown; ///< architecture generation, resolved from deviceID and revID
+    ADLUtil_ASICMatch asicMatch = ADLUtil_ASICMatch::None;               ///< how generation and family were resolved
+    ADLUtil_FamilyString  family;          ///< ASIC family ie "Navi 21", empty if the device is not in the database
+    ADLUtil_PCITopology topology; ///< PCI link and NUMA placement; link speed and width are not compared when diffing enumerations
+};
+
+typedef std::vector<ADLUtil_ASICInfo> AsicInfoList;
+
+/// Immutable, shared view of the cached AsicInfoList. A snapshot stays valid after Reset() or re-enumeration.
+typedef std::shared_ptr<const AsicInfoList> AsicInfoListSnapshot;
+
+/// Differences between two enumerations of the adapters. Adapters are matched by PCI bus location and UDID.
+struct ADLUtil_AdapterChanges
+{
+    uint64_t                                   previousGeneration = 0; ///< generation of previousList, 0 if there was none
+    uint64_t                                   generation = 0;         ///< generation of currentList
+    AsicInfoListSnapshot                       previousList;           ///< the adapters before the change, may be nullptr
+    AsicInfoListSnapshot                       currentList;            ///< the adapters after the change
+    std::vector<uint32_t>                      added;                  ///< indices into currentList of adapters that are new
+    std::vector<uint32_t>                      removed;                ///< indices into previousList of adapters that are gone
+    std::vector<std::pair<uint32_t, uint32_t>> changed;                ///< index into previousList and into currentList of adapters whose other fields changed
+
+    /// @returns true if any adapter was added, removed or changed.
+    bool HasChanges() const { return !added.empty() || !removed.empty() || !changed.empty(); }
+};
+
+/// Source of the adapter list and the driver version
+enum class ADLUtil_Backend : uint8_t
+{
+    ADL,   ///< query the ADL library
+    Sysfs, ///< read the PCI devices and the amdgpu module from the Linux sysfs tree, without loading ADL
+};
+
+/// Return values from the ADLUtil
+enum ADLUtil_Result
+{
+    ADL_RESULT_NONE,                  ///< Undefined ADL result
+    ADL_SUCCESS = 1,                  ///< Data was retrieved successfully.
+    ADL_NOT_FOUND,                    ///< ADL DLLs were not found.
+    ADL_MISSING_ENTRYPOINTS,          ///< ADL did not expose necessary entrypoints.
+    ADL_INITIALIZATION_FAILED,        ///< ADL could not be initialized.
+    ADL_GET_ADAPTER_COUNT_FAILED,     ///< ADL was unable to return the number of adapters.
+    ADL_GET_ADAPTER_INFO_FAILED,      ///< ADL was unable to return adapter info.
+    ADL_GRAPHICS_VERSIONS_GET_FAILED, ///< ADL was unable to return graphics versions info.
+    ADL_WARNING,                      ///< ADL Operation succeeded, but generated a warning.
+    ADL_STALE,                        ///< ADL did not answer within the call deadline; the data is the last data ADL returned successfully.
+    ADL_TIMED_OUT,                    ///< ADL did not answer within the call deadline and there is no earlier data to return.
+    ADL_LEASES_HELD,                  ///< ADL was not unloaded because leases were still held when the timeout passed.
+};
+
+/// Driver version parsed from ADLVersionsInfo::strDriverVer, ie "13.35.1005-140131a-167669E-ATI".
+/// Values are parsed once and compare field by field in the order they are declared.
+struct ADLUtil_DriverVersion
+{
+    unsigned int majorVer          = 0; ///< the major version number, "13"
+    unsigned int minorVer          = 0; ///< the minor version number, "35"
+    unsigned int subMinorVer       = 0; ///< the sub-minor version number, "1005"
+    unsigned int buildVer          = 0; ///< the fourth dotted number used by newer drivers, 0 if absent
+    unsigned int buildDate         = 0; ///< the build date as the decimal number yymmdd, "140131"
+    char         buildDateRevision = 0; ///< the build letter following the build date, 'a'
+    unsigned int changelist        = 0; ///< the changelist number, "167669"
+
+    /// Parses a driver version string. Missing or malformed fields are left as 0.
+    /// @param[in] driverVersion the driver version string
+    /// @returns   the parsed driver version.
+    static constexpr ADLUtil_DriverVersion FromString(std::string_view driverVersion)
+    {
+        ADLUtil_DriverVersion result;
+
+        // the dotted version number ends at the first dash
+        std::string_view dotted = driverVersion.substr(0, driverVersion.find('-'));
+        driverVersion.remove_prefix(dotted.size());
+
+        unsigned int* dottedFields[] = {&result.majorVer, &result.minorVer, &result.subMinorVer, &result.buildVer};
+
+        for (unsigned int* pField : dottedFields)
+        {
+            if (!ParseNumber(dotted, *pField) || dotted.empty() || '.' != dotted.front())
+            {
+                break;
+            }
+
+            dotted.remove_prefix(1);
+        }
+
+        // "-140131a-167669E-ATI": build date with its revision letter, then the changelist
+        if (!driverVersion.empty())
+        {
+            driverVersion.remove_prefix(1);
+
+            if (ParseNumber(driverVersion, result.buildDate) && !driverVersion.empty() && '-' != driverVersion.front())
+            {
+                result.buildDateRevision = driverVersion.front();
+                driverVersion.remove_prefix(1);
+            }
+
+            if (!driverVersion.empty() && '-' == driverVersion.front())
+            {
+                driverVersion.remove_prefix(1);
+                ParseNumber(driverVersion, result.changelist);
+            }
+        }
+
+        return result;
+    }
+
+    /// Three-way comparison
+    /// @param[in] other the driver version to compare with
+    /// @returns   a negative value, 0 or a positive value if this version is older than, equal to or newer than other.
+    constexpr int Compare(const ADLUtil_DriverVersion& other) const
+    {
+        const unsigned int lhs[] = {majorVer, minorVer, subMinorVer, buildVer, buildDate, static_cast<unsigned char>(buildDateRevision), changelist};
+        const unsigned int rhs[] = {other.majorVer, other.minorVer, other.subMinorVer, other.buildVer, other.buildDate, static_cast<unsigned char>(other.buildDateRevision), other.changelist};
+
+        for (size_t i = 0; i < sizeof(lhs) / sizeof(lhs[0]); ++i)
+        {
+            if (lhs[i] != rhs[i])
+            {
+                return (lhs[i] < rhs[i]) ? -1 : 1;
+            }
+        }
+
+        return 0;
+    }
+
+private:
+    /// Parses the decimal digits at the start of str and removes them
+    /// @returns true if at least one digit was parsed.
+    static constexpr bool ParseNumber(std::string_view& str, unsigned int& value)
+    {
+        size_t digitCount = 0;
+        unsigned int result = 0;
+
+        while (digitCount < str.size() && '0' <= str[digitCount] && '9' >= str[digitCount])
+        {
+            result = result * 10 + static_cast<unsigned int>(str[digitCount] - '0');
+            ++digitCount;
+        }
+
+        str.remove_prefix(digitCount);
+
+        if (0 < digitCount)
+        {
+            value = result;
+        }
+
+        return 0 < digitCount;
+    }
+};
+
+constexpr bool operator==(const ADLUtil_DriverVersion& lhs, const ADLUtil_DriverVersion& rhs) { return 0 == lhs.Compare(rhs); }
+constexpr bool operator!=(const ADLUtil_DriverVersion& lhs, const ADLUtil_DriverVersion& rhs) { return 0 != lhs.Compare(rhs); }
+constexpr bool operator<(const ADLUtil_DriverVersion& lhs, const ADLUtil_DriverVersion& rhs) { return 0 > lhs.Compare(rhs); }
+constexpr bool operator<=(const ADLUtil_DriverVersion& lhs, const ADLUtil_DriverVersion& rhs) { return 0 >= lhs.Compare(rhs); }
+constexpr bool operator>(const ADLUtil_DriverVersion& lhs, const ADLUtil_DriverVersion& rhs) { return 0 < lhs.Compare(rhs); }
+constexpr bool operator>=(const ADLUtil_DriverVersion& lhs, const ADLUtil_DriverVersion& rhs) { return 0 <= lhs.Compare(rhs); }
+
+/// Driver version strings of ADLVersionsInfo, without the fixed size buffers of the ADL struct
+struct ADLUtil_VersionsInfo
+{
+    std::string driverVersion;   ///< the driver version, ie "13.35.1005-140131a-167669E-ATI"
+    std::string catalystVersion; ///< the Catalyst/Radeon Software version
+    std::string catalystWebLink; ///< the web link to the driver release notes
+};
+
+/// Counters of the allocations made through the ADL allocation callback
+struct ADLUtil_AllocationStats
+{
+    uint64_t heapAllocations  = 0; ///< allocations served by malloc
+    uint64_t arenaAllocations = 0; ///< allocations served by the arena
+    uint64_t arenaResets      = 0; ///< number of times the arena was rewound
+};
+
+/// PCI IDs parsed from an ADL adapter UDID
+struct ADLUtil_PCIIdentity
+{
+    int          vendorID = 0;    ///< the vendor ID
+    int          deviceID = 0;    ///< the device ID
+    std::string  deviceIDString;  ///< the device ID as it appears in the UDID
+    unsigned int subsystemID = 0; ///< the subsystem ID, 0 if the UDID has none
+    int          revID = 0;       ///< the revision ID
+};
+
+/// Return values from the UDID parser
+enum ADLUtil_UDIDParseResult
+{
+    ADL_UDID_OK,               ///< vendor, device and revision IDs were parsed.
+    ADL_UDID_MISSING_VENDOR,   ///< the UDID has no VEN_ field.
+    ADL_UDID_MISSING_DEVICE,   ///< the UDID has no DEV_ field.
+    ADL_UDID_MISSING_REVISION, ///< the UDID has no REV_ field.
+    ADL_UDID_MALFORMED_FIELD,  ///< a field is too short or holds non-hex digits.
+};
+
+#endif //_ADL_UTIL_TYPES_H_
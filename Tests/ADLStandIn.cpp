@@ -0,0 +1,303 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Stand-in ADL library. Exports the entry points of ADL_INTERFACE_TABLE and answers them with
+///         synthetic adapters, versions and counters, so that adl_util can be tested and benchmarked without a driver.
+//==============================================================================
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#ifdef _WIN32
+#include <Windows.h>
+#define ADL_STANDIN_EXPORT extern "C" __declspec(dllexport)
+#else
+#define ADL_STANDIN_EXPORT extern "C" __attribute__((visibility("default")))
+#ifndef __stdcall
+#define __stdcall
+#endif
+#endif
+
+#include "adl_sdk.h"
+
+#include "ADLStandIn.h"
+
+// Device ID of the reported GPUs, a Polaris 20 part of the device database
+static constexpr int s_deviceID = 0x67DF;
+
+// Revision ID of the reported GPUs
+static constexpr int s_revID = 0xE7;
+
+static std::mutex        s_configMutex;
+static ADLStandIn_Config s_config = ADLStandIn_GetDefaultConfig();
+
+static std::atomic<uint64_t> s_createCount(0);
+static std::atomic<uint64_t> s_adapterInfoCount(0);
+static std::atomic<uint64_t> s_versionsCount(0);
+static std::atomic<uint64_t> s_telemetryCount(0);
+
+#ifndef ADL_STANDIN_OMIT_ADL2_MAIN_CONTROL_CREATE
+// Handle returned by ADL2_Main_Control_Create; only its address matters
+static int s_context = 0;
+#endif
+
+// Returns the current behavior and waits for the configured latency
+static ADLStandIn_Config BeginCall()
+{
+    ADLStandIn_Config config;
+
+    {
+        std::lock_guard<std::mutex> lock(s_configMutex);
+        config = s_config;
+    }
+
+    if (0 != config.latencyUs)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(config.latencyUs));
+    }
+
+    return config;
+}
+
+// Returns the physical GPU behind a logical adapter, -1 if the adapter does not exist
+static int GetGPU(const ADLStandIn_Config& config, int adapterIndex)
+{
+    int adapterCount = config.gpuCount * config.logicalAdaptersPerGPU;
+    return (0 <= adapterIndex && adapterCount > adapterIndex) ? adapterIndex / config.logicalAdaptersPerGPU : -1;
+}
+
+static int GetAdapterCount(int* lpNumAdapters)
+{
+    ADLStandIn_Config config = BeginCall();
+
+    if (nullptr == lpNumAdapters)
+    {
+        return ADL_ERR;
+    }
+
+    *lpNumAdapters = config.gpuCount * config.logicalAdaptersPerGPU;
+    return (ADL_OK > config.adapterInfoResult) ? config.adapterInfoResult : ADL_OK;
+}
+
+static int GetAdapterInfo(LPAdapterInfo lpInfo, int iInputSize)
+{
+    ADLStandIn_Config config = BeginCall();
+    s_adapterInfoCount.fetch_add(1, std::memory_order_relaxed);
+
+    int adapterCount = config.gpuCount * config.logicalAdaptersPerGPU;
+
+    if (nullptr == lpInfo || static_cast<int>(sizeof(AdapterInfo)) * adapterCount > iInputSize)
+    {
+        return ADL_ERR;
+    }
+
+    for (int i = 0; i < adapterCount; ++i)
+    {
+        int          gpu = i / config.logicalAdaptersPerGPU;
+        AdapterInfo& info = lpInfo[i];
+
+        memset(&info, 0, sizeof(info));
+        info.iSize = sizeof(info);
+        info.iAdapterIndex = i;
+        info.iBusNumber = gpu + 1;
+        info.iDeviceNumber = 0;
+        info.iFunctionNumber = 0;
+        info.iVendorID = 0x1002;
+        info.iPresent = 1;
+        info.iExist = 1;
+        info.iOSDisplayIndex = -1;
+
+        if (config.omitRevision)
+        {
+            snprintf(info.strUDID, sizeof(info.strUDID), "PCI_VEN_1002&DEV_%04X&SUBSYS_E3871DA2_4&%X&0&%04X", s_deviceID, gpu, i);
+        }
+        else
+        {
+            snprintf(info.strUDID, sizeof(info.strUDID), "PCI_VEN_1002&DEV_%04X&SUBSYS_E3871DA2&REV_%02X_4&%X&0&%04X", s_deviceID, s_revID, gpu, i);
+        }
+
+        snprintf(info.strAdapterName, sizeof(info.strAdapterName), config.renameAdapters ? "ADL Stand-In GPU %d (Renamed)" : "ADL Stand-In GPU %d", gpu);
+        snprintf(info.strDisplayName, sizeof(info.strDisplayName), "\\\\.\\DISPLAY%d", i + 1);
+        snprintf(info.strDriverPath, sizeof(info.strDriverPath), "StandIn\\%04d", i);
+    }
+
+    return config.adapterInfoResult;
+}
+
+static int GetVersions(ADLVersionsInfo* lpVersionsInfo)
+{
+    ADLStandIn_Config config = BeginCall();
+    s_versionsCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (0 != config.versionsLatencyUs)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(config.versionsLatencyUs));
+    }
+
+    if (nullptr == lpVersionsInfo)
+    {
+        return ADL_ERR;
+    }
+
+    memset(lpVersionsInfo, 0, sizeof(*lpVersionsInfo));
+    snprintf(lpVersionsInfo->strDriverVer, sizeof(lpVersionsInfo->strDriverVer), "%s", "23.20.1.0-230818a-396094C-AMD-Software-Adrenalin-Edition");
+    snprintf(lpVersionsInfo->strCatalystVersion, sizeof(lpVersionsInfo->strCatalystVersion), "%s", "23.8.1");
+    snprintf(lpVersionsInfo->strCatalystWebLink, sizeof(lpVersionsInfo->strCatalystWebLink), "%s", "https://www.amd.com/");
+
+    return config.versionsResult;
+}
+
+ADL_STANDIN_EXPORT void ADLStandIn_Configure(const ADLStandIn_Config* pConfig)
+{
+    {
+        std::lock_guard<std::mutex> lock(s_configMutex);
+        s_config = (nullptr != pConfig) ? *pConfig : ADLStandIn_GetDefaultConfig();
+        s_config.logicalAdaptersPerGPU = (0 < s_config.logicalAdaptersPerGPU) ? s_config.logicalAdaptersPerGPU : 1;
+    }
+
+    s_createCount = 0;
+    s_adapterInfoCount = 0;
+    s_versionsCount = 0;
+    s_telemetryCount = 0;
+}
+
+ADL_STANDIN_EXPORT void ADLStandIn_GetCounters(ADLStandIn_Counters* pCounters)
+{
+    pCounters->createCount = s_createCount.load(std::memory_order_relaxed);
+    pCounters->adapterInfoCount = s_adapterInfoCount.load(std::memory_order_relaxed);
+    pCounters->versionsCount = s_versionsCount.load(std::memory_order_relaxed);
+    pCounters->telemetryCount = s_telemetryCount.load(std::memory_order_relaxed);
+}
+
+ADL_STANDIN_EXPORT int ADL_Main_Control_Create(ADL_MAIN_MALLOC_CALLBACK callback, int)
+{
+    BeginCall();
+    s_createCount.fetch_add(1, std::memory_order_relaxed);
+    return (nullptr != callback) ? ADL_OK : ADL_ERR;
+}
+
+ADL_STANDIN_EXPORT int ADL_Main_Control_Destroy()
+{
+    return ADL_OK;
+}
+
+// adl_standin_legacy leaves ADL2_Main_Control_Create out, like a driver that only offers the single ADL context
+#ifndef ADL_STANDIN_OMIT_ADL2_MAIN_CONTROL_CREATE
+ADL_STANDIN_EXPORT int ADL2_Main_Control_Create(ADL_MAIN_MALLOC_CALLBACK callback, int, ADL_CONTEXT_HANDLE* pContext)
+{
+    BeginCall();
+    s_createCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (nullptr == callback || nullptr == pContext)
+    {
+        return ADL_ERR;
+    }
+
+    *pContext = &s_context;
+    return ADL_OK;
+}
+#endif
+
+ADL_STANDIN_EXPORT int ADL2_Main_Control_Destroy(ADL_CONTEXT_HANDLE)
+{
+    return ADL_OK;
+}
+
+ADL_STANDIN_EXPORT int ADL_Adapter_NumberOfAdapters_Get(int* lpNumAdapters)
+{
+    return GetAdapterCount(lpNumAdapters);
+}
+
+ADL_STANDIN_EXPORT int ADL_Adapter_AdapterInfo_Get(LPAdapterInfo lpInfo, int iInputSize)
+{
+    return GetAdapterInfo(lpInfo, iInputSize);
+}
+
+ADL_STANDIN_EXPORT int ADL2_Adapter_NumberOfAdapters_Get(ADL_CONTEXT_HANDLE, int* lpNumAdapters)
+{
+    return GetAdapterCount(lpNumAdapters);
+}
+
+ADL_STANDIN_EXPORT int ADL2_Adapter_AdapterInfo_Get(ADL_CONTEXT_HANDLE, LPAdapterInfo lpInfo, int iInputSize)
+{
+    return GetAdapterInfo(lpInfo, iInputSize);
+}
+
+ADL_STANDIN_EXPORT int ADL_Graphics_Versions_Get(ADLVersionsInfo* lpVersionsInfo)
+{
+    return GetVersions(lpVersionsInfo);
+}
+
+ADL_STANDIN_EXPORT int ADL2_Graphics_Versions_Get(ADL_CONTEXT_HANDLE, ADLVersionsInfo* lpVersionsInfo)
+{
+    return GetVersions(lpVersionsInfo);
+}
+
+// The counters are synthetic: activity cycles with the number of calls, everything else is a fixed value per GPU
+
+ADL_STANDIN_EXPORT int ADL2_Overdrive5_CurrentActivity_Get(ADL_CONTEXT_HANDLE, int iAdapterIndex, ADLPMActivity* lpActivity)
+{
+    ADLStandIn_Config config = BeginCall();
+    uint64_t          callCount = s_telemetryCount.fetch_add(1, std::memory_order_relaxed);
+    int               gpu = GetGPU(config, iAdapterIndex);
+
+    if (0 > gpu || nullptr == lpActivity)
+    {
+        return ADL_ERR;
+    }
+
+    lpActivity->iActivityPercent = static_cast<int>(callCount % 101);
+    lpActivity->iEngineClock = 130000 + gpu * 1000;
+    lpActivity->iMemoryClock = 200000 + gpu * 1000;
+    return ADL_OK;
+}
+
+ADL_STANDIN_EXPORT int ADL2_Overdrive5_Temperature_Get(ADL_CONTEXT_HANDLE, int iAdapterIndex, int, ADLTemperature* lpTemperature)
+{
+    ADLStandIn_Config config = BeginCall();
+    s_telemetryCount.fetch_add(1, std::memory_order_relaxed);
+    int gpu = GetGPU(config, iAdapterIndex);
+
+    if (0 > gpu || nullptr == lpTemperature)
+    {
+        return ADL_ERR;
+    }
+
+    lpTemperature->iTemperature = 45000 + gpu * 1000;
+    return ADL_OK;
+}
+
+ADL_STANDIN_EXPORT int ADL2_Overdrive5_FanSpeed_Get(ADL_CONTEXT_HANDLE, int iAdapterIndex, int, ADLFanSpeedValue* lpFanSpeedValue)
+{
+    ADLStandIn_Config config = BeginCall();
+    s_telemetryCount.fetch_add(1, std::memory_order_relaxed);
+    int gpu = GetGPU(config, iAdapterIndex);
+
+    if (0 > gpu || nullptr == lpFanSpeedValue || ADL_DL_FANCTRL_SPEED_TYPE_RPM != lpFanSpeedValue->iSpeedType)
+    {
+        return ADL_ERR;
+    }
+
+    lpFanSpeedValue->iFanSpeed = 1200 + gpu * 100;
+    return ADL_OK;
+}
+
+ADL_STANDIN_EXPORT int ADL2_Adapter_VRAMUsage_Get(ADL_CONTEXT_HANDLE, int iAdapterIndex, int* iVRAMUsageInMB)
+{
+    ADLStandIn_Config config = BeginCall();
+    s_telemetryCount.fetch_add(1, std::memory_order_relaxed);
+    int gpu = GetGPU(config, iAdapterIndex);
+
+    if (0 > gpu || nullptr == iVRAMUsageInMB)
+    {
+        return ADL_ERR;
+    }
+
+    *iVRAMUsageInMB = 512 * (gpu + 1);
+    return ADL_OK;
+}
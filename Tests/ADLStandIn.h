@@ -0,0 +1,51 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Control interface of the stand-in ADL library used by the tests and benchmarks.
+//==============================================================================
+
+#ifndef _ADL_STAND_IN_H_
+#define _ADL_STAND_IN_H_
+
+#include <cstdint>
+
+/// Behavior of the stand-in library. It takes effect with the next call, and survives the library being unloaded by
+/// adl_util as long as the test holds its own handle of the library.
+struct ADLStandIn_Config
+{
+    int      gpuCount;              ///< physical GPUs to report
+    int      logicalAdaptersPerGPU; ///< logical adapters reported for each physical GPU, all at the PCI location of the GPU
+    uint32_t latencyUs;             ///< time each entry point takes before it returns, in microseconds
+    uint32_t versionsLatencyUs;     ///< time the graphics versions entry points take on top of latencyUs, in microseconds
+    int      adapterInfoResult;     ///< ADL return code of the adapter count and adapter info entry points
+    int      versionsResult;        ///< ADL return code of the graphics versions entry points
+    bool     omitRevision;          ///< leave the REV_ field out of the UDIDs
+    bool     renameAdapters;        ///< report other adapter names, as after a driver update, without changing the UDIDs
+};
+
+/// Counters of the calls the stand-in library served since it was loaded or last configured
+struct ADLStandIn_Counters
+{
+    uint64_t createCount;      ///< ADL(2)_Main_Control_Create calls
+    uint64_t adapterInfoCount; ///< ADL(2)_Adapter_AdapterInfo_Get calls
+    uint64_t versionsCount;    ///< ADL(2)_Graphics_Versions_Get calls
+    uint64_t telemetryCount;   ///< ADL2_Overdrive5_* and ADL2_Adapter_VRAMUsage_Get calls
+};
+
+/// Replaces the behavior of the stand-in library and clears its counters
+typedef void (*ADLStandIn_Configure_fn)(const ADLStandIn_Config*);
+
+/// Copies the counters of the stand-in library
+typedef void (*ADLStandIn_GetCounters_fn)(ADLStandIn_Counters*);
+
+/// @returns the default behavior: two GPUs with one logical adapter each, no latency and ADL_OK everywhere.
+inline ADLStandIn_Config ADLStandIn_GetDefaultConfig()
+{
+    ADLStandIn_Config config = {};
+    config.gpuCount = 2;
+    config.logicalAdaptersPerGPU = 1;
+    return config;
+}
+
+#endif //_ADL_STAND_IN_H_
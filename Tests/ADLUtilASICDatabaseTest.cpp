@@ -0,0 +1,100 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests that every row of ADLUtilASICDatabase.csv is found by the compiled lookup, that rebranded parts are
+///         told apart by revision, and the nearest-generation fallback.
+//==============================================================================
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "ADLUtilASICDatabase.h"
+#include "ADLUtilTest.h"
+
+// the lookup is usable in constant expressions
+static_assert(ADLUtil_ASICDatabase::Lookup(0x73BF, 0xC1).generation == ADLUtil_ASICGeneration::RDNA2, "Navi 21 is RDNA 2");
+static_assert(ADLUtil_ASICDatabase::Lookup(0x67DF, 0xE7).family == "Polaris 20", "67DF rev E7 is Polaris 20");
+static_assert(ADLUtil_ASICDatabase::Lookup(0, 0).match == ADLUtil_ASICMatch::None, "device ID 0 is not a device");
+
+// The enumerator names the data file uses, in the order of ADLUtil_ASICGeneration
+static const char* const s_generationNames[] = {"Unknown", "GCN1", "GCN2", "GCN3", "GCN4", "GCN5", "RDNA1", "RDNA2", "RDNA3", "RDNA3_5", "RDNA4", "CDNA1", "CDNA2", "CDNA3"};
+
+// Every row of the data file resolves to itself
+static void TestRows()
+{
+    std::ifstream file(ADLUTIL_ASIC_DATABASE_CSV);
+    ADLUTIL_CHECK(file.is_open());
+
+    std::string line;
+    size_t      rowCount = 0;
+
+    while (std::getline(file, line))
+    {
+        if (line.empty() || '#' == line[0] || 0 == line.compare(0, 10, "device_id,"))
+        {
+            continue;
+        }
+
+        std::istringstream columns(line);
+        std::string        deviceID;
+        std::string        revID;
+        std::string        generation;
+        std::string        family;
+        std::getline(columns, deviceID, ',');
+        std::getline(columns, revID, ',');
+        std::getline(columns, generation, ',');
+        std::getline(columns, family);
+
+        bool              isAnyRevision = "*" == revID;
+        ADLUtil_ASICClass asicClass = ADLUtil_ASICDatabase::Lookup(static_cast<int>(strtol(deviceID.c_str(), nullptr, 16)),
+                                                                   isAnyRevision ? ADLUTIL_ASIC_ANY_REVISION : static_cast<int>(strtol(revID.c_str(), nullptr, 16)));
+
+        ADLUTIL_CHECK((isAnyRevision ? ADLUtil_ASICMatch::Device : ADLUtil_ASICMatch::Exact) == asicClass.match);
+        ADLUTIL_CHECK(family == asicClass.family);
+        ADLUTIL_CHECK(generation == s_generationNames[static_cast<size_t>(asicClass.generation)]);
+
+        ++rowCount;
+    }
+
+    ADLUTIL_CHECK(ADLUtil_ASICDatabase::GetRowCount() == rowCount);
+}
+
+// Revisions, unlisted devices and Classify
+static void TestFallbacks()
+{
+    // a revision that is not listed gets the row for all revisions of the device
+    ADLUtil_ASICClass asicClass = ADLUtil_ASICDatabase::Lookup(0x67DF, 0xFF);
+    ADLUTIL_CHECK(ADLUtil_ASICMatch::Device == asicClass.match && "Polaris 10" == asicClass.family);
+
+    // a device that is not listed gets the generation of its neighbor, but no family
+    asicClass = ADLUtil_ASICDatabase::Lookup(0x73BE, 0xC1);
+    ADLUTIL_CHECK(ADLUtil_ASICMatch::Nearest == asicClass.match && asicClass.family.empty());
+    ADLUTIL_CHECK(ADLUtil_ASICGeneration::RDNA2 == asicClass.generation);
+
+    ADLUTIL_CHECK(ADLUtil_ASICMatch::None == ADLUtil_ASICDatabase::Lookup(0x10000, 0).match);
+
+    ADLUtil_ASICInfo asicInfo = {};
+    asicInfo.vendorID = ADLUTIL_AMD_VENDOR_ID;
+    asicInfo.deviceID = 0x67DF;
+    asicInfo.revID = 0xC7;
+    ADLUtil_ASICDatabase::Classify(asicInfo);
+    ADLUTIL_CHECK(ADLUtil_ASICMatch::Exact == asicInfo.asicMatch && asicInfo.family == "Polaris 10");
+
+    // the same IDs from another vendor are not looked up
+    asicInfo.vendorID = 0x8086;
+    ADLUtil_ASICDatabase::Classify(asicInfo);
+    ADLUTIL_CHECK(ADLUtil_ASICGeneration::Unknown == asicInfo.generation && asicInfo.family.empty());
+
+    ADLUTIL_CHECK("RDNA 3.5" == ADLUtil_ASICDatabase::GetGenerationName(ADLUtil_ASICGeneration::RDNA3_5));
+}
+
+int main()
+{
+    TestRows();
+    TestFallbacks();
+
+    return ADLUtil_GetTestExitCode();
+}
@@ -0,0 +1,186 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Counts the allocations of an enumeration in the heap and arena allocation modes, and checks that ADL allocations
+///         made outside an enumeration are not served from the arena.
+//==============================================================================
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+
+#include "ADLUtilEntrypoints.h"
+#include "ADLUtilTest.h"
+
+// The allocation callback of adl_util, declared here to call it the way ADL does
+void* __stdcall ADL_Main_Memory_Alloc(int iSize);
+void __stdcall ADL_Main_Memory_Free(void** lpBuffer);
+
+// Every operator new of the process, including those made inside adl_util
+static std::atomic<uint64_t> s_newCount(0);
+
+// The replacements are not inlined, so that GCC pairs the new expressions with operator delete rather than with free
+#if defined(__GNUC__)
+    #define ADLUTIL_TEST_NOINLINE __attribute__((noinline))
+#else
+    #define ADLUTIL_TEST_NOINLINE
+#endif
+
+ADLUTIL_TEST_NOINLINE void* operator new(size_t size)
+{
+    ++s_newCount;
+    void* pMemory = malloc(0 == size ? 1 : size);
+
+    if (nullptr == pMemory)
+    {
+        throw std::bad_alloc();
+    }
+
+    return pMemory;
+}
+
+ADLUTIL_TEST_NOINLINE void operator delete(void* pMemory) noexcept
+{
+    free(pMemory);
+}
+
+ADLUTIL_TEST_NOINLINE void operator delete(void* pMemory, size_t) noexcept
+{
+    free(pMemory);
+}
+
+// Physical GPUs of the stand-in; only the logical adapters per GPU vary, so the per-GPU topology reads stay the same
+static constexpr int s_gpuCount = 2;
+
+// @returns the operator new calls plus the callback heap allocations of a Refresh that finds the adapters unchanged.
+static uint64_t CountRefreshAllocations(ADLUtil_StandIn& standIn, int logicalAdaptersPerGPU, bool useArena)
+{
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+
+    ADLStandIn_Config config = ADLStandIn_GetDefaultConfig();
+    config.gpuCount = s_gpuCount;
+    config.logicalAdaptersPerGPU = logicalAdaptersPerGPU;
+    standIn.Configure(config);
+
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->Unload());
+    pADLUtils->SetUseArenaAllocator(useArena);
+
+    // the first Refresh loads the library and publishes the new adapters
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->Refresh());
+
+    ADLUtil_AllocationStats before = pADLUtils->GetAllocationStats();
+    uint64_t                newCount = s_newCount.load();
+
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->Refresh());
+
+    newCount = s_newCount.load() - newCount;
+    ADLUtil_AllocationStats after = pADLUtils->GetAllocationStats();
+
+    if (useArena)
+    {
+        // the AdapterInfo scratch array came from the arena
+        ADLUTIL_CHECK(before.heapAllocations == after.heapAllocations);
+        ADLUTIL_CHECK(before.arenaAllocations < after.arenaAllocations);
+    }
+
+    return newCount + after.heapAllocations - before.heapAllocations;
+}
+
+// The adapter records hold their strings inline, so parsing an adapter does not allocate however long its strings are
+static void TestParseAdapterInfo()
+{
+    AdapterInfo adapterInfo = {};
+    snprintf(adapterInfo.strAdapterName, sizeof(adapterInfo.strAdapterName), "AMD Radeon RX 6800 XT with a name beyond any small string buffer");
+    snprintf(adapterInfo.strUDID, sizeof(adapterInfo.strUDID), "PCI_VEN_1002&DEV_73BF&SUBSYS_0E3A1002&REV_C1_4&2A3D0B5A&0&0008");
+    snprintf(adapterInfo.strDriverPath, sizeof(adapterInfo.strDriverPath), "\\Registry\\Machine\\System\\CurrentControlSet\\Control\\Class\\{4d36e968}\\0000");
+    snprintf(adapterInfo.strDriverPathExt, sizeof(adapterInfo.strDriverPathExt), "\\Registry\\Machine\\System\\CurrentControlSet\\Control\\Class\\{4d36e968}\\0001");
+
+    ADLUtil_ASICInfo asicInfo;
+    uint64_t         newCount = s_newCount.load();
+
+    ADLUTIL_CHECK(ADL_UDID_OK == ADLUtil_ParseAdapterInfo(adapterInfo, asicInfo));
+    ADLUTIL_CHECK(newCount == s_newCount.load());
+
+    ADLUTIL_CHECK(asicInfo.adapterName == adapterInfo.strAdapterName);
+    ADLUTIL_CHECK(asicInfo.registryPathExt == adapterInfo.strDriverPathExt);
+    ADLUTIL_CHECK(0x73BF == asicInfo.deviceID);
+
+    // the fields convert to std::string where callers still need one
+    std::string deviceIDString = asicInfo.deviceIDString;
+    ADLUTIL_CHECK("73BF" == deviceIDString);
+    ADLUTIL_CHECK(asicInfo.adapterName.str() == adapterInfo.strAdapterName);
+}
+
+// In arena mode only the enumeration is served from the arena; an ADL allocation made by a user call, the sampler or a
+// context pool comes from the heap and is freed, because the next rewind would reclaim it while it is still in use
+static void TestAllocationOutsideEnumeration()
+{
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+
+    AMDTADLUtils::Lease lease;
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->AcquireLease(lease));
+
+    ADLUtil_AllocationStats before = pADLUtils->GetAllocationStats();
+    void*                   pBuffer = ADL_Main_Memory_Alloc(64);
+    ADLUtil_AllocationStats after = pADLUtils->GetAllocationStats();
+
+    ADLUTIL_CHECK(nullptr != pBuffer);
+    ADLUTIL_CHECK(before.heapAllocations + 1 == after.heapAllocations);
+    ADLUTIL_CHECK(before.arenaAllocations == after.arenaAllocations);
+
+    // an enumeration in between rewinds the arena, which must not affect the buffer
+    memset(pBuffer, 0x5a, 64);
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->Refresh());
+    ADLUTIL_CHECK(0x5a == static_cast<unsigned char*>(pBuffer)[63]);
+
+    ADL_Main_Memory_Free(&pBuffer);
+    ADLUTIL_CHECK(nullptr == pBuffer);
+
+    // the buffer is the allocation itself, so a caller that owns it may also free it directly
+    pBuffer = ADL_Main_Memory_Alloc(64);
+    ADLUTIL_CHECK(nullptr != pBuffer);
+    free(pBuffer);
+}
+
+int main()
+{
+    ADLUtil_StandIn standIn;
+    AMDTADLUtils*   pADLUtils = AMDTADLUtils::Instance();
+
+    // no topology to read, so that only the enumeration itself is counted
+    pADLUtils->SetSysfsRoot("adl_util_test_allocation_no_sysfs");
+
+    TestParseAdapterInfo();
+
+    // the first enumerations of the process also size the hazard pointer lists of the caches, so leave them out
+    CountRefreshAllocations(standIn, 1, false);
+
+    const int logicalAdapterCounts[] = {1, 4, 16};
+    uint64_t  heapModeCounts[3];
+    uint64_t  arenaModeCounts[3];
+
+    for (int i = 0; i < 3; ++i)
+    {
+        heapModeCounts[i] = CountRefreshAllocations(standIn, logicalAdapterCounts[i], false);
+        arenaModeCounts[i] = CountRefreshAllocations(standIn, logicalAdapterCounts[i], true);
+
+        printf("{\"gpus\": %d, \"logicalAdaptersPerGPU\": %d, \"heapModeAllocations\": %llu, \"arenaModeAllocations\": %llu}\n", s_gpuCount,
+               logicalAdapterCounts[i], static_cast<unsigned long long>(heapModeCounts[i]), static_cast<unsigned long long>(arenaModeCounts[i]));
+    }
+
+    // the allocations of an enumeration do not grow with the number of adapters, and the arena saves the scratch allocation
+    ADLUTIL_CHECK(arenaModeCounts[0] == arenaModeCounts[1] && arenaModeCounts[1] == arenaModeCounts[2]);
+    ADLUTIL_CHECK(heapModeCounts[0] == heapModeCounts[1] && heapModeCounts[1] == heapModeCounts[2]);
+    ADLUTIL_CHECK(arenaModeCounts[0] < heapModeCounts[0]);
+
+    TestAllocationOutsideEnumeration();
+
+    pADLUtils->SetUseArenaAllocator(false);
+    pADLUtils->SetSysfsRoot("");
+
+    return ADLUtil_GetTestExitCode();
+}
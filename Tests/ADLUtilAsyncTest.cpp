@@ -0,0 +1,129 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests ADLUtil_PrefetchAsync and the asynchronous getters on a cold and on a warm cache.
+//==============================================================================
+
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include "ADLUtilAsync.h"
+#include "ADLUtilEntrypoints.h"
+#include "ADLUtilTest.h"
+
+// Latency of every stand-in entry point, long enough for a cold query not to be done when its future is returned
+static constexpr uint32_t s_latencyUs = 20000;
+
+// @returns true if the future holds its result already
+template <typename Future>
+static bool IsReady(const Future& future)
+{
+    return std::future_status::ready == future.wait_for(std::chrono::seconds(0));
+}
+
+int main()
+{
+    ADLUtil_StandIn standIn;
+
+    ADLStandIn_Config config = ADLStandIn_GetDefaultConfig();
+    config.latencyUs = s_latencyUs;
+    standIn.Configure(config);
+
+    AMDTADLUtils*   pADLUtils = AMDTADLUtils::Instance();
+    std::thread::id mainThread = std::this_thread::get_id();
+
+    AsicInfoListSnapshot asicInfoList;
+    ADLVersionsInfo      adlVersionInfo;
+    ADLStandIn_Counters  counters;
+
+    // a prefetch with both caches already filled has nothing to do, and is done when it is returned
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(asicInfoList));
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetADLVersionsInfo(adlVersionInfo));
+
+    std::shared_future<ADLUtil_Result> prefetch = ADLUtil_PrefetchAsync();
+    ADLUTIL_CHECK(IsReady(prefetch));
+    ADLUTIL_CHECK(ADL_SUCCESS == prefetch.get());
+
+    counters = standIn.GetCounters();
+    ADLUTIL_CHECK(1 == counters.adapterInfoCount);
+    ADLUTIL_CHECK(1 == counters.versionsCount);
+
+    // a cold prefetch runs in the background, and asking again while it runs does not start another
+    pADLUtils->Reset();
+    standIn.Configure(config);
+
+    prefetch = ADLUtil_PrefetchAsync();
+    ADLUTIL_CHECK(!IsReady(prefetch));
+    ADLUtil_PrefetchAsync();
+    ADLUTIL_CHECK(ADL_SUCCESS == prefetch.get());
+    ADLUTIL_CHECK(ADL_SUCCESS == ADLUtil_PrefetchAsync().get());
+
+    counters = standIn.GetCounters();
+    ADLUTIL_CHECK(1 == counters.adapterInfoCount);
+    ADLUTIL_CHECK(1 == counters.versionsCount);
+
+    // on a warm cache the getters complete on the calling thread, before they return, without calling ADL
+    std::thread::id callbackThread;
+    size_t          adapterCount = 0;
+
+    std::future<ADLUtil_Result> asicInfoFuture = ADLUtil_GetAsicInfoListAsync([&](ADLUtil_Result, const AsicInfoListSnapshot& callbackList)
+    {
+        callbackThread = std::this_thread::get_id();
+        adapterCount = callbackList->size();
+    });
+
+    ADLUTIL_CHECK(IsReady(asicInfoFuture));
+    ADLUTIL_CHECK(ADL_SUCCESS == asicInfoFuture.get());
+    ADLUTIL_CHECK(mainThread == callbackThread);
+    ADLUTIL_CHECK(2 == adapterCount);
+
+    callbackThread = std::thread::id();
+
+    std::future<ADLUtil_Result> versionsFuture = ADLUtil_GetADLVersionsInfoAsync([&](ADLUtil_Result, const ADLVersionsInfo&)
+    {
+        callbackThread = std::this_thread::get_id();
+    });
+
+    ADLUTIL_CHECK(IsReady(versionsFuture));
+    ADLUTIL_CHECK(ADL_SUCCESS == versionsFuture.get());
+    ADLUTIL_CHECK(mainThread == callbackThread);
+
+    counters = standIn.GetCounters();
+    ADLUTIL_CHECK(1 == counters.adapterInfoCount);
+    ADLUTIL_CHECK(1 == counters.versionsCount);
+
+    // on a cold cache the getters return at once and deliver the callback from a background thread
+    pADLUtils->Reset();
+    callbackThread = std::thread::id();
+    adapterCount = 0;
+
+    asicInfoFuture = ADLUtil_GetAsicInfoListAsync([&](ADLUtil_Result, const AsicInfoListSnapshot& callbackList)
+    {
+        callbackThread = std::this_thread::get_id();
+        adapterCount = callbackList->size();
+    });
+
+    ADLUTIL_CHECK(!IsReady(asicInfoFuture));
+    ADLUTIL_CHECK(ADL_SUCCESS == asicInfoFuture.get());
+    ADLUTIL_CHECK(std::thread::id() != callbackThread && mainThread != callbackThread);
+    ADLUTIL_CHECK(2 == adapterCount);
+
+    callbackThread = std::thread::id();
+
+    versionsFuture = ADLUtil_GetADLVersionsInfoAsync([&](ADLUtil_Result, const ADLVersionsInfo&)
+    {
+        callbackThread = std::this_thread::get_id();
+    });
+
+    ADLUTIL_CHECK(!IsReady(versionsFuture));
+    ADLUTIL_CHECK(ADL_SUCCESS == versionsFuture.get());
+    ADLUTIL_CHECK(std::thread::id() != callbackThread && mainThread != callbackThread);
+
+    counters = standIn.GetCounters();
+    ADLUTIL_CHECK(2 == counters.adapterInfoCount);
+    ADLUTIL_CHECK(2 == counters.versionsCount);
+
+    return ADLUtil_GetTestExitCode();
+}
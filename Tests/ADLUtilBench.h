@@ -0,0 +1,180 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Minimal benchmark harness of the adl_util benchmarks. Results are written as JSON so that CI can track them.
+//==============================================================================
+
+#ifndef _ADL_UTIL_BENCH_H_
+#define _ADL_UTIL_BENCH_H_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// Result of one benchmark
+struct ADLUtil_BenchResult
+{
+    std::string name;       ///< name of the benchmark
+    uint32_t    threads;    ///< number of threads running the operation concurrently
+    uint64_t    iterations; ///< operations per thread
+    double      nsPerOp;    ///< mean wall time per operation of one thread
+    double      opsPerSec;  ///< operations per second over all threads
+};
+
+//------------------------------------------------------------------------------------
+/// Runs the benchmarks of one executable and writes their results. Every benchmark executable
+/// accepts "--iterations n" to scale its iteration counts and "--output path" to write the JSON
+/// to a file instead of stdout; ctest runs them with few iterations as smoke tests.
+//------------------------------------------------------------------------------------
+class ADLUtil_Bench
+{
+public:
+    /// constructor, parses the command line
+    /// @param[in] argc the argument count of main
+    /// @param[in] argv the arguments of main
+    ADLUtil_Bench(int argc, char* argv[]) :
+        m_iterations(10000)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            if (0 == strcmp(argv[i], "--iterations") && i + 1 < argc)
+            {
+                m_iterations = std::max<uint64_t>(strtoull(argv[++i], nullptr, 10), 1);
+            }
+            else if (0 == strcmp(argv[i], "--output") && i + 1 < argc)
+            {
+                m_outputPath = argv[++i];
+            }
+        }
+    }
+
+    /// @returns the iteration count requested on the command line, scaled by a factor and at least 1.
+    uint64_t GetIterations(double scale = 1.0) const { return std::max<uint64_t>(static_cast<uint64_t>(static_cast<double>(m_iterations) * scale), 1); }
+
+    /// Times an operation on one thread
+    /// @param[in] name       name of the benchmark
+    /// @param[in] iterations number of times to run the operation
+    /// @param[in] operation  the operation, called with the iteration number
+    template <typename Operation>
+    void Run(const std::string& name, uint64_t iterations, Operation operation)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        for (uint64_t i = 0; i < iterations; ++i)
+        {
+            operation(i);
+        }
+
+        Add(name, 1, iterations, std::chrono::steady_clock::now() - start);
+    }
+
+    /// Times an operation run concurrently by several threads. The threads start together, and the wall time of
+    /// the slowest one is reported.
+    /// @param[in] name       name of the benchmark
+    /// @param[in] threads    number of threads
+    /// @param[in] iterations number of times each thread runs the operation
+    /// @param[in] operation  the operation, called with the iteration number
+    template <typename Operation>
+    void RunConcurrent(const std::string& name, uint32_t threads, uint64_t iterations, Operation operation)
+    {
+        std::atomic<uint32_t>    readyCount(0);
+        std::atomic<bool>        go(false);
+        std::vector<std::thread> workers;
+
+        for (uint32_t thread = 0; thread < threads; ++thread)
+        {
+            workers.emplace_back([&]()
+            {
+                ++readyCount;
+
+                while (!go.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    operation(i);
+                }
+            });
+        }
+
+        while (threads != readyCount.load())
+        {
+            std::this_thread::yield();
+        }
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        go.store(true, std::memory_order_release);
+
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+
+        Add(name, threads, iterations, std::chrono::steady_clock::now() - start);
+    }
+
+    /// Writes the results as JSON
+    /// @returns the exit code of the benchmark executable: 0 if the results were written.
+    int Finish() const
+    {
+        FILE* pFile = m_outputPath.empty() ? stdout : fopen(m_outputPath.c_str(), "w");
+
+        if (nullptr == pFile)
+        {
+            fprintf(stderr, "cannot open %s\n", m_outputPath.c_str());
+            return 1;
+        }
+
+        fprintf(pFile, "{\n  \"benchmarks\": [");
+
+        for (size_t i = 0; i < m_results.size(); ++i)
+        {
+            const ADLUtil_BenchResult& result = m_results[i];
+            fprintf(pFile, "%s\n    {\"name\": \"%s\", \"threads\": %u, \"iterations\": %llu, \"nsPerOp\": %.1f, \"opsPerSec\": %.0f}",
+                    (0 == i) ? "" : ",", result.name.c_str(), result.threads, static_cast<unsigned long long>(result.iterations), result.nsPerOp,
+                    result.opsPerSec);
+        }
+
+        fprintf(pFile, "\n  ]\n}\n");
+
+        bool written = 0 == fflush(pFile);
+
+        if (stdout != pFile)
+        {
+            written = (0 == fclose(pFile)) && written;
+        }
+
+        return written ? 0 : 1;
+    }
+
+private:
+    /// Adds the result of a benchmark
+    void Add(const std::string& name, uint32_t threads, uint64_t iterations, std::chrono::steady_clock::duration elapsed)
+    {
+        double elapsedNs = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+        ADLUtil_BenchResult result;
+        result.name = name;
+        result.threads = threads;
+        result.iterations = iterations;
+        result.nsPerOp = elapsedNs / static_cast<double>(iterations);
+        result.opsPerSec = (0.0 < elapsedNs) ? static_cast<double>(iterations) * threads * 1e9 / elapsedNs : 0.0;
+        m_results.push_back(result);
+    }
+
+    uint64_t                         m_iterations; ///< the base iteration count
+    std::string                      m_outputPath; ///< where to write the JSON, empty for stdout
+    std::vector<ADLUtil_BenchResult> m_results;    ///< the results so far
+};
+
+#endif //_ADL_UTIL_BENCH_H_
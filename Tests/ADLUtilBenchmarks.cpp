@@ -0,0 +1,111 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  adl_util_bench: cold init, warm cache hits, Reset() + re-enumeration and multi-thread contention
+///         against the stand-in ADL library, and cold init of the sysfs backend against a fake sysfs tree.
+//==============================================================================
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include "ADLUtil.h"
+#include "ADLUtilBench.h"
+#include "ADLUtilFakeSysfs.h"
+#include "ADLUtilTest.h"
+
+int main(int argc, char* argv[])
+{
+    ADLUtil_Bench   bench(argc, argv);
+    ADLUtil_StandIn standIn;
+    AMDTADLUtils*   pADLUtils = AMDTADLUtils::Instance();
+
+    for (int gpuCount : {1, 4, 16})
+    {
+        ADLStandIn_Config config = ADLStandIn_GetDefaultConfig();
+        config.gpuCount = gpuCount;
+        standIn.Configure(config);
+
+        // loading the library, creating the context and the first enumeration
+        bench.Run("cold_init/gpus:" + std::to_string(gpuCount), bench.GetIterations(0.01), [&](uint64_t)
+        {
+            AsicInfoListSnapshot asicInfoList;
+            pADLUtils->LoadAndInit();
+            pADLUtils->GetAsicInfoList(asicInfoList);
+            pADLUtils->Unload();
+        });
+
+        bench.Run("reset_reenumerate/gpus:" + std::to_string(gpuCount), bench.GetIterations(0.1), [&](uint64_t)
+        {
+            AsicInfoListSnapshot asicInfoList;
+            pADLUtils->Reset();
+            pADLUtils->GetAsicInfoList(asicInfoList);
+        });
+
+        bench.Run("warm_snapshot/gpus:" + std::to_string(gpuCount), bench.GetIterations(10.0), [&](uint64_t)
+        {
+            AsicInfoListSnapshot asicInfoList;
+            pADLUtils->GetAsicInfoList(asicInfoList);
+        });
+
+        bench.Run("warm_copy/gpus:" + std::to_string(gpuCount), bench.GetIterations(), [&](uint64_t)
+        {
+            AsicInfoList asicInfoList;
+            pADLUtils->GetAsicInfoList(asicInfoList);
+        });
+    }
+
+    // the sysfs backend enumerates without loading ADL, so its cold init is the cost of walking the tree
+    for (int gpuCount : {1, 4, 16})
+    {
+        ADLUtil_FakeSysfs sysfs("adl_util_bench_sysfs");
+
+        for (int gpu = 0; gpu < gpuCount; ++gpu)
+        {
+            char slotName[32];
+            snprintf(slotName, sizeof(slotName), "0000:%02x:00.0", gpu + 1);
+            sysfs.AddDevice(ADLUtil_MakeFakeAMDDevice(slotName, "0x73bf"));
+            sysfs.AddDRMCard("card" + std::to_string(gpu), slotName);
+        }
+
+        pADLUtils->SetBackend(ADLUtil_Backend::Sysfs);
+        pADLUtils->SetSysfsRoot(sysfs.GetRoot());
+
+        bench.Run("cold_init_sysfs/gpus:" + std::to_string(gpuCount), bench.GetIterations(0.01), [&](uint64_t)
+        {
+            AsicInfoListSnapshot asicInfoList;
+            pADLUtils->Reset();
+            pADLUtils->GetAsicInfoList(asicInfoList);
+        });
+
+        pADLUtils->SetBackend(ADLUtil_Backend::ADL);
+        pADLUtils->SetSysfsRoot("");
+        pADLUtils->Reset();
+    }
+
+    standIn.Configure(ADLStandIn_GetDefaultConfig());
+
+    bench.Run("warm_driver_version", bench.GetIterations(10.0), [&](uint64_t)
+    {
+        ADLUtil_DriverVersion driverVersion;
+        pADLUtils->GetDriverVersion(driverVersion);
+    });
+
+    uint32_t threadCount = std::max(std::thread::hardware_concurrency(), 2u);
+
+    bench.RunConcurrent("contended_snapshot", threadCount, bench.GetIterations(10.0), [&](uint64_t)
+    {
+        AsicInfoListSnapshot asicInfoList;
+        pADLUtils->GetAsicInfoList(asicInfoList);
+    });
+
+    bench.RunConcurrent("contended_copy", threadCount, bench.GetIterations(), [&](uint64_t)
+    {
+        AsicInfoList asicInfoList;
+        pADLUtils->GetAsicInfoList(asicInfoList);
+    });
+
+    return bench.Finish();
+}
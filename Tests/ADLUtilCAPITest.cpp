@@ -0,0 +1,167 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests the count/fill protocol of the C records, their republication when the adapters change while they are
+///         read, and that the deprecated C++ wrappers read the C++ cache rather than the records.
+//==============================================================================
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "ADLUtilCAPI.h"
+#include "ADLUtilEntrypoints.h"
+#include "ADLUtilTest.h"
+
+// The deprecated wrappers are what this test is about
+#if defined(__GNUC__)
+    #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#elif defined(_MSC_VER)
+    #pragma warning(disable : 4996)
+#endif
+
+// The deprecated wrappers return the cached C++ data field for field, and leave the C records alone
+static void TestDeprecatedWrappers()
+{
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+
+    AsicInfoList asicInfoList;
+    AsicInfoList cachedList;
+    ADLUTIL_CHECK(ADL_SUCCESS == ADLUtil_GetASICInfo(asicInfoList));
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(cachedList));
+    ADLUTIL_CHECK(2 == asicInfoList.size() && cachedList.size() == asicInfoList.size());
+
+    for (size_t i = 0; i < asicInfoList.size() && i < cachedList.size(); ++i)
+    {
+        ADLUTIL_CHECK(cachedList[i].adapterName == asicInfoList[i].adapterName);
+        ADLUTIL_CHECK(cachedList[i].udid == asicInfoList[i].udid);
+        ADLUTIL_CHECK(cachedList[i].family == asicInfoList[i].family);
+        ADLUTIL_CHECK(cachedList[i].busNumber == asicInfoList[i].busNumber);
+        ADLUTIL_CHECK(cachedList[i].topology.pciDomain == asicInfoList[i].topology.pciDomain);
+    }
+
+    ADLVersionsInfo versionsInfo = {};
+    ADLVersionsInfo cachedVersionsInfo = {};
+    ADLUTIL_CHECK(ADL_SUCCESS == ADLUtil_GetVersionsInfo(versionsInfo));
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetADLVersionsInfo(cachedVersionsInfo));
+    ADLUTIL_CHECK(0 == strcmp(cachedVersionsInfo.strDriverVer, versionsInfo.strDriverVer));
+
+    // no round trip through the records
+    uint32_t count = 0;
+    ADLUTIL_CHECK(ADLUTIL_RECORD_NOT_INITIALIZED == ADLUtil_GetAdapterRecords(nullptr, &count, nullptr));
+}
+
+// @returns the published adapter records, read with the count/fill protocol.
+static std::vector<ADLUtil_AdapterRecord> GetAdapterRecords()
+{
+    uint32_t count = 0;
+    ADLUTIL_CHECK(ADLUTIL_RECORD_OK == ADLUtil_GetAdapterRecords(nullptr, &count, nullptr));
+
+    std::vector<ADLUtil_AdapterRecord> records(count);
+    int32_t                            queryResult = ADL_RESULT_NONE;
+    ADLUTIL_CHECK(ADLUTIL_RECORD_OK == ADLUtil_GetAdapterRecords(records.data(), &count, &queryResult));
+    ADLUTIL_CHECK(ADL_SUCCESS == queryResult);
+
+    return records;
+}
+
+// The records match the C++ cache, a short buffer is reported, and a Refresh that finds other adapters republishes them
+static void TestRecords(ADLUtil_StandIn& standIn)
+{
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+
+    ADLUTIL_CHECK(ADL_SUCCESS == ADLUtil_InitRecords());
+
+    std::vector<ADLUtil_AdapterRecord> records = GetAdapterRecords();
+    AsicInfoList                       asicInfoList;
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(asicInfoList));
+    ADLUTIL_CHECK(asicInfoList.size() == records.size());
+
+    for (size_t i = 0; i < records.size() && i < asicInfoList.size(); ++i)
+    {
+        ADLUTIL_CHECK(asicInfoList[i].adapterName == records[i].adapterName);
+        ADLUTIL_CHECK(asicInfoList[i].udid == records[i].udid);
+        ADLUTIL_CHECK(asicInfoList[i].deviceID == records[i].deviceID);
+        ADLUTIL_CHECK(static_cast<uint8_t>(asicInfoList[i].generation) == records[i].generation);
+        ADLUTIL_CHECK(asicInfoList[i].topology.pciDomain == records[i].pciDomain);
+        ADLUTIL_CHECK(asicInfoList[i].topology.numaNode == records[i].numaNode);
+    }
+
+    ADLUtil_AdapterRecord firstRecord;
+    uint32_t              count = 1;
+    ADLUTIL_CHECK(ADLUTIL_RECORD_MORE_DATA == ADLUtil_GetAdapterRecords(&firstRecord, &count, nullptr));
+    ADLUTIL_CHECK(2 == count && 0 == strcmp(firstRecord.udid, records[0].udid));
+
+    ADLUtil_DriverVersionRecord versionRecord;
+    ADLUTIL_CHECK(ADLUTIL_RECORD_OK == ADLUtil_GetDriverVersionRecord(&versionRecord, nullptr));
+    ADLUTIL_CHECK(0 != versionRecord.driverVersion[0]);
+
+    ADLStandIn_Config config = ADLStandIn_GetDefaultConfig();
+    config.gpuCount = 3;
+    standIn.Configure(config);
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->Refresh());
+    ADLUTIL_CHECK(3 == GetAdapterRecords().size());
+}
+
+// Readers copy the records while the adapters change back and forth, so that every republication retires a snapshot a
+// reader may hold; run under a sanitizer, this catches a retired snapshot freed too early
+static void TestRepublishWhileReading(ADLUtil_StandIn& standIn)
+{
+    AMDTADLUtils*     pADLUtils = AMDTADLUtils::Instance();
+    ADLStandIn_Config config = ADLStandIn_GetDefaultConfig();
+
+    std::atomic<bool>        stop(false);
+    std::atomic<int>         badCounts(0);
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        readers.emplace_back([&]()
+        {
+            ADLUtil_AdapterRecord       records[4];
+            ADLUtil_DriverVersionRecord versionRecord;
+
+            while (!stop.load())
+            {
+                uint32_t count = 4;
+                ADLUtil_GetAdapterRecords(records, &count, nullptr);
+                ADLUtil_GetDriverVersionRecord(&versionRecord, nullptr);
+
+                if (2 != count && 3 != count)
+                {
+                    ++badCounts;
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < 50; ++i)
+    {
+        config.gpuCount = 2 + (i % 2);
+        standIn.Configure(config);
+        ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->Refresh());
+    }
+
+    stop = true;
+
+    for (std::thread& reader : readers)
+    {
+        reader.join();
+    }
+
+    ADLUTIL_CHECK(0 == badCounts.load());
+    ADLUTIL_CHECK(3 == GetAdapterRecords().size());
+}
+
+int main()
+{
+    ADLUtil_StandIn standIn;
+
+    TestDeprecatedWrappers();
+    TestRecords(standIn);
+    TestRepublishWhileReading(standIn);
+
+    return ADLUtil_GetTestExitCode();
+}
@@ -0,0 +1,284 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Concurrency stress tests of ADLUtil_CachedQuery and ADLUtil_AtomicSharedPtr.
+//==============================================================================
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "ADLUtilAtomicSharedPtr.h"
+#include "ADLUtilCachedQuery.h"
+#include "ADLUtilTest.h"
+
+// Number of reader threads of the stress tests
+static constexpr uint32_t s_readerCount = 8;
+
+// A cached value that detects being read after it was freed
+struct TestValue
+{
+    static constexpr uint64_t s_aliveMagic = 0xA11CEA11CEA11CEull;
+
+    explicit TestValue(uint64_t value) : magic(s_aliveMagic), value(value) { ++GetLiveCount(); }
+    ~TestValue() { magic = 0; --GetLiveCount(); }
+
+    bool IsAlive() const { return s_aliveMagic == magic; }
+
+    static std::atomic<int64_t>& GetLiveCount()
+    {
+        static std::atomic<int64_t> s_liveCount(0);
+        return s_liveCount;
+    }
+
+    volatile uint64_t magic; ///< s_aliveMagic until the value is destroyed
+    uint64_t          value; ///< the payload
+};
+
+typedef std::function<std::shared_ptr<const TestValue>(const int&)> TestFillFn;
+typedef ADLUtil_CachedQuery<TestValue, TestFillFn>                   TestQuery;
+
+// Starts the threads together and waits for them
+static void RunThreads(uint32_t threadCount, const std::function<void(uint32_t)>& body)
+{
+    std::vector<std::thread> threads;
+
+    for (uint32_t thread = 0; thread < threadCount; ++thread)
+    {
+        threads.emplace_back(body, thread);
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// Concurrent Gets of a cold key run the fill once and all return its value
+static void TestOnceOnlyFill()
+{
+    std::atomic<int> fillCount(0);
+    TestQuery query([&](const int& key)
+    {
+        ++fillCount;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return std::make_shared<const TestValue>(static_cast<uint64_t>(key));
+    });
+
+    std::vector<const TestValue*> values(s_readerCount);
+
+    RunThreads(s_readerCount, [&](uint32_t thread) { values[thread] = query.Get(7).get(); });
+
+    ADLUTIL_CHECK(1 == fillCount);
+
+    for (const TestValue* pValue : values)
+    {
+        ADLUTIL_CHECK(values[0] == pValue && 7 == pValue->value);
+    }
+}
+
+// A slow fill of one key does not block the Gets of another
+static void TestKeysFillIndependently()
+{
+    std::atomic<bool> otherKeyFilled(false);
+    TestQuery query([&](const int& key)
+    {
+        if (0 == key)
+        {
+            // wait for the fill of key 1, which only happens if it is not blocked behind this one
+            for (int i = 0; i < 5000 && !otherKeyFilled; ++i)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+        else
+        {
+            otherKeyFilled = true;
+        }
+
+        return std::make_shared<const TestValue>(static_cast<uint64_t>(key));
+    });
+
+    RunThreads(2, [&](uint32_t thread)
+    {
+        if (1 == thread)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+
+        query.Get(static_cast<int>(thread));
+    });
+
+    ADLUTIL_CHECK(otherKeyFilled);
+}
+
+// A value filled while the query is invalidated belongs to the old generation and is not served afterwards
+static void TestInvalidateDuringFill()
+{
+    TestQuery* pQuery = nullptr;
+    TestQuery  query([&](const int&)
+    {
+        pQuery->Invalidate();
+        return std::make_shared<const TestValue>(1);
+    });
+    pQuery = &query;
+
+    ADLUTIL_CHECK(nullptr != query.Get(0));
+    ADLUTIL_CHECK(nullptr == query.Peek(0));
+}
+
+// Values expire after the time to live
+static void TestTimeToLive()
+{
+    std::atomic<int> fillCount(0);
+    TestQuery query([&](const int&) { return std::make_shared<const TestValue>(static_cast<uint64_t>(++fillCount)); },
+                    std::chrono::milliseconds(20));
+
+    ADLUTIL_CHECK(1 == query.Get(0)->value);
+    ADLUTIL_CHECK(1 == query.Get(0)->value);
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    ADLUTIL_CHECK(nullptr == query.Peek(0));
+    ADLUTIL_CHECK(2 == query.Get(0)->value);
+}
+
+// Readers hammer a few keys while another thread invalidates, stores and adds keys. Every value read must be alive,
+// and every value must be freed once the query is.
+static void TestReadersAgainstWriters()
+{
+    {
+        std::atomic<uint64_t> fillCount(0);
+        std::atomic<bool>     stop(false);
+        TestQuery query([&](const int& key) { return std::make_shared<const TestValue>(static_cast<uint64_t>(key) + (++fillCount << 16)); });
+
+        RunThreads(s_readerCount + 1, [&](uint32_t thread)
+        {
+            if (s_readerCount == thread)
+            {
+                for (int i = 0; i < 2000; ++i)
+                {
+                    query.Invalidate();
+                    query.Invalidate(i % 4);
+                    query.Store(i % 4, std::make_shared<const TestValue>(static_cast<uint64_t>(i % 4)));
+                    query.Get(100 + i % 64);
+                }
+
+                stop = true;
+                return;
+            }
+
+            while (!stop)
+            {
+                int key = static_cast<int>(thread % 4);
+                std::shared_ptr<const TestValue> value = query.Get(key);
+                ADLUTIL_CHECK(value->IsAlive() && static_cast<uint64_t>(key) == (value->value & 0xFFFF));
+
+                std::shared_ptr<const TestValue> peeked = query.Peek(key);
+                ADLUTIL_CHECK(nullptr == peeked || peeked->IsAlive());
+            }
+        });
+    }
+
+    ADLUTIL_CHECK(0 == TestValue::GetLiveCount());
+}
+
+// Readers read in place while a writer replaces the value; the replaced values are freed once no reader reads them
+static void TestAtomicSharedPtrReclamation()
+{
+    {
+        ADLUtil_AtomicSharedPtr<TestValue> pointer(std::make_shared<const TestValue>(0));
+        std::atomic<bool>                  stop(false);
+        std::atomic<uint64_t>              readCount(0);
+
+        RunThreads(s_readerCount + 1, [&](uint32_t thread)
+        {
+            if (s_readerCount == thread)
+            {
+                for (uint64_t i = 1; i <= 20000; ++i)
+                {
+                    pointer.Store(std::make_shared<const TestValue>(i));
+
+                    // the retired values are bounded by the readers, not by the stores
+                    ADLUTIL_CHECK(static_cast<int64_t>(s_readerCount * ADLUTIL_HAZARDS_PER_THREAD + 2) >= TestValue::GetLiveCount());
+                }
+
+                stop = true;
+                return;
+            }
+
+            uint64_t lastValue = 0;
+
+            while (!stop)
+            {
+                ADLUtil_AtomicSharedPtr<TestValue>::Reader reader(pointer);
+                ADLUTIL_CHECK(reader.Get()->IsAlive() && lastValue <= reader.Get()->value);
+                lastValue = reader.Get()->value;
+                ++readCount;
+            }
+        });
+
+        ADLUTIL_CHECK(0 < readCount);
+        ADLUTIL_CHECK(20000 == pointer.Load()->value);
+    }
+
+    ADLUTIL_CHECK(0 == TestValue::GetLiveCount());
+}
+
+// Reads the pointer in nested readers, replacing the value each of them holds before reading one level deeper
+static void ReadNested(ADLUtil_AtomicSharedPtr<TestValue>& pointer, uint32_t depth)
+{
+    ADLUtil_AtomicSharedPtr<TestValue>::Reader reader(pointer);
+    const TestValue*                           pValue = reader.Get();
+    pointer.Store(std::make_shared<const TestValue>(pValue->value + 1));
+
+    if (0 < depth)
+    {
+        ReadNested(pointer, depth - 1);
+    }
+
+    ADLUTIL_CHECK(pValue == reader.Get() && pValue->IsAlive());
+}
+
+static void TestAtomicSharedPtrNestingAndThreadExit()
+{
+    {
+        ADLUtil_AtomicSharedPtr<TestValue> pointer(std::make_shared<const TestValue>(0));
+
+        // readers beyond the hazard pointers of the thread fall back to holding their value
+        ReadNested(pointer, 3 * ADLUTIL_HAZARDS_PER_THREAD);
+        ADLUTIL_CHECK(3 * ADLUTIL_HAZARDS_PER_THREAD + 1 == pointer.Load()->value);
+
+        // threads that read get a hazard record each, which is freed when they exit
+        size_t initialRecordCount = ADLUtil_GetHazardRecordCount();
+
+        RunThreads(s_readerCount, [&](uint32_t)
+        {
+            ADLUtil_AtomicSharedPtr<TestValue>::Reader reader(pointer);
+            ADLUTIL_CHECK(reader.Get()->IsAlive());
+        });
+
+        ADLUTIL_CHECK(initialRecordCount == ADLUtil_GetHazardRecordCount());
+
+        // the next store frees the values the nested readers held
+        pointer.Store(nullptr);
+        ADLUTIL_CHECK(0 == TestValue::GetLiveCount());
+    }
+
+    ADLUTIL_CHECK(0 == TestValue::GetLiveCount());
+}
+
+int main()
+{
+    TestOnceOnlyFill();
+    TestKeysFillIndependently();
+    TestInvalidateDuringFill();
+    TestTimeToLive();
+    TestReadersAgainstWriters();
+    TestAtomicSharedPtrReclamation();
+    TestAtomicSharedPtrNestingAndThreadExit();
+
+    return ADLUtil_GetTestExitCode();
+}
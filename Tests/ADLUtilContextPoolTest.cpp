@@ -0,0 +1,181 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests ADLUtil_ContextPool: the fan-out over several GPUs on worker threads, the placement of gathered results,
+///         Destroy waiting for a held lease, and the fallback to the legacy context.
+//==============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "ADLUtilContextPool.h"
+#include "ADLUtilTest.h"
+
+// GPUs reported by the stand-in library; each has two logical adapters, so that a physical GPU is not a logical adapter
+static constexpr int s_gpuCount = 6;
+
+// Time each query takes, long enough for the workers to pick up GPUs while the calling thread is busy
+static constexpr std::chrono::milliseconds s_queryTime(20);
+
+// Runs a query on every GPU of a pool with four contexts and three workers, and checks that they run at once
+static void TestFanOut()
+{
+    ADLUtil_StandIn     standIn;
+    ADLStandIn_Config   config = ADLStandIn_GetDefaultConfig();
+    ADLUtil_ContextPool pool;
+
+    config.gpuCount = s_gpuCount;
+    config.logicalAdaptersPerGPU = 2;
+    standIn.Configure(config);
+
+    ADLUTIL_CHECK(ADL_SUCCESS == pool.Create(4, 3));
+    ADLUTIL_CHECK(!pool.IsLegacy());
+    ADLUTIL_CHECK(4 == pool.GetContextCount());
+    ADLUTIL_CHECK(5 == standIn.GetCounters().createCount);
+
+    std::mutex                    mutex;
+    std::vector<uint32_t>         visits(s_gpuCount, 0);
+    std::set<std::thread::id>     threads;
+    std::atomic<int>              running(0);
+    std::atomic<int>              maxRunning(0);
+
+    ADLUTIL_CHECK(ADL_SUCCESS == pool.ForEachPhysicalGPU([&](ADL_CONTEXT_HANDLE adlContext, uint32_t physicalGPU, const ADLUtil_ASICInfo& asicInfo)
+    {
+        int nowRunning = ++running;
+        int previousMax = maxRunning.load();
+
+        while (previousMax < nowRunning && !maxRunning.compare_exchange_weak(previousMax, nowRunning))
+        {
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ADLUTIL_CHECK(nullptr != adlContext);
+            ADLUTIL_CHECK(static_cast<int>(physicalGPU) + 1 == asicInfo.busNumber);
+            ++visits[physicalGPU];
+            threads.insert(std::this_thread::get_id());
+        }
+
+        std::this_thread::sleep_for(s_queryTime);
+        --running;
+    }));
+
+    // every GPU was queried once, by more than the calling thread, and never by more threads than there are contexts
+    ADLUTIL_CHECK(std::all_of(visits.begin(), visits.end(), [](uint32_t count) { return 1 == count; }));
+    ADLUTIL_CHECK(1 < threads.size());
+    ADLUTIL_CHECK(1 < maxRunning.load() && 4 >= maxRunning.load());
+    ADLUTIL_CHECK(0 == running.load());
+
+    // the results land at the index of their GPU whatever order the threads finish in
+    std::vector<int> busNumbers;
+
+    ADLUTIL_CHECK(ADL_SUCCESS == pool.GatherPhysicalGPUs<int>([](ADL_CONTEXT_HANDLE, uint32_t physicalGPU, const ADLUtil_ASICInfo& asicInfo)
+    {
+        // later GPUs finish first
+        std::this_thread::sleep_for(std::chrono::milliseconds(2 * (s_gpuCount - physicalGPU)));
+        return asicInfo.busNumber;
+    }, busNumbers));
+
+    ADLUTIL_CHECK(s_gpuCount == busNumbers.size());
+
+    for (size_t physicalGPU = 0; physicalGPU < busNumbers.size(); ++physicalGPU)
+    {
+        ADLUTIL_CHECK(static_cast<int>(physicalGPU) + 1 == busNumbers[physicalGPU]);
+    }
+
+    std::vector<uint32_t> adapterIndices;
+
+    ADLUTIL_CHECK(ADL_SUCCESS == pool.GatherPhysicalGPUs<uint32_t>([](ADL_CONTEXT_HANDLE, uint32_t, const ADLUtil_ASICInfo& asicInfo)
+    {
+        return static_cast<uint32_t>(asicInfo.adapterIndex);
+    }, adapterIndices));
+
+    ADLUTIL_CHECK((std::vector<uint32_t>{0, 2, 4, 6, 8, 10}) == adapterIndices);
+}
+
+// Checks that Destroy waits for a lease held by another thread, and destroys the contexts once it is returned
+static void TestDestroyWithLease()
+{
+    ADLUtil_StandIn     standIn;
+    ADLUtil_ContextPool pool;
+
+    ADLUTIL_CHECK(ADL_SUCCESS == pool.Create(2, 1));
+
+    ADLUtil_ContextPool::Lease lease = pool.Acquire();
+    std::atomic<bool>          destroyed(false);
+
+    std::thread destroyer([&]()
+    {
+        pool.Destroy();
+        destroyed = true;
+    });
+
+    std::this_thread::sleep_for(s_queryTime * 5);
+    ADLUTIL_CHECK(!destroyed.load());
+
+    // the library stays leased by the pool until Destroy completes
+    ADLUTIL_CHECK(ADL_LEASES_HELD == AMDTADLUtils::Instance()->Unload(0));
+
+    {
+        ADLUtil_ContextPool::Lease released = std::move(lease);
+    }
+
+    destroyer.join();
+    ADLUTIL_CHECK(destroyed.load());
+    ADLUTIL_CHECK(0 == pool.GetContextCount());
+    ADLUTIL_CHECK(ADL_SUCCESS == AMDTADLUtils::Instance()->Unload(0));
+}
+
+// Checks that a pool on a library without ADL2_Main_Control_Create holds the legacy context alone and still visits every GPU
+static void TestLegacy()
+{
+    ADLUtil_StandIn     standIn(ADL_STANDIN_LEGACY_LIBRARY);
+    ADLStandIn_Config   config = ADLStandIn_GetDefaultConfig();
+    ADLUtil_ContextPool pool;
+
+    config.gpuCount = s_gpuCount;
+    standIn.Configure(config);
+
+    ADLUTIL_CHECK(ADL_SUCCESS == pool.Create(4, 3));
+    ADLUTIL_CHECK(pool.IsLegacy());
+    ADLUTIL_CHECK(1 == pool.GetContextCount());
+    ADLUTIL_CHECK(1 == standIn.GetCounters().createCount);
+
+    std::vector<uint32_t> visits(s_gpuCount, 0);
+    std::atomic<int>      running(0);
+    std::atomic<bool>     overlapped(false);
+
+    // the one context is leased to one thread at a time, so the visits need no lock
+    ADLUTIL_CHECK(ADL_SUCCESS == pool.ForEachPhysicalGPU([&](ADL_CONTEXT_HANDLE adlContext, uint32_t physicalGPU, const ADLUtil_ASICInfo&)
+    {
+        overlapped = overlapped || (1 != ++running);
+        ADLUTIL_CHECK(nullptr == adlContext);
+        ++visits[physicalGPU];
+        std::this_thread::sleep_for(s_queryTime / 4);
+        --running;
+    }));
+
+    ADLUTIL_CHECK(!overlapped.load());
+    ADLUTIL_CHECK(std::all_of(visits.begin(), visits.end(), [](uint32_t count) { return 1 == count; }));
+
+    // the legacy context belongs to the library, so destroying the pool only returns its library lease
+    pool.Destroy();
+    ADLUTIL_CHECK(!pool.IsLegacy());
+    ADLUTIL_CHECK(0 == pool.GetContextCount());
+    ADLUTIL_CHECK(ADL_SUCCESS == AMDTADLUtils::Instance()->Unload(0));
+}
+
+int main()
+{
+    TestFanOut();
+    TestDestroyWithLease();
+    TestLegacy();
+
+    return ADLUtil_GetTestExitCode();
+}
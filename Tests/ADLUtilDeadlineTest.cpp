@@ -0,0 +1,133 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests the call deadline against a slow stand-in library, and that each kind of query has its own worker thread.
+//==============================================================================
+
+#include <chrono>
+#include <future>
+#include <thread>
+
+#ifdef __linux__
+    #include <dirent.h>
+#endif
+
+#include "ADLUtilTest.h"
+
+// The deadline, and the latency of every stand-in entry point, far longer than the deadline
+static constexpr uint32_t s_deadlineMs = 10;
+static constexpr uint32_t s_latencyUs = 50000;
+
+// A longer deadline, and a version query that hangs well past it, for the queries that must not wait for each other
+static constexpr uint32_t s_isolationDeadlineMs = 1000;
+static constexpr uint32_t s_hangUs = 2000000;
+
+// The backoff the circuit breaker starts with, once three queries in a row missed the deadline
+static constexpr std::chrono::milliseconds s_backoff(1000);
+
+// @returns the number of threads of the process, 0 where it is not known.
+static int GetThreadCount()
+{
+    int threadCount = 0;
+
+#ifdef __linux__
+    DIR* pDir = opendir("/proc/self/task");
+
+    if (nullptr != pDir)
+    {
+        for (dirent* pEntry = readdir(pDir); nullptr != pEntry; pEntry = readdir(pDir))
+        {
+            if ('.' != pEntry->d_name[0])
+            {
+                ++threadCount;
+            }
+        }
+
+        closedir(pDir);
+    }
+#endif
+
+    return threadCount;
+}
+
+int main()
+{
+    ADLUtil_StandIn standIn;
+
+    ADLStandIn_Config config = ADLStandIn_GetDefaultConfig();
+    config.latencyUs = s_latencyUs;
+    standIn.Configure(config);
+
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+    pADLUtils->SetCallDeadline(s_deadlineMs);
+
+    int initialThreadCount = GetThreadCount();
+
+    // nothing was ever returned, so the callers that are not answered in time get nothing
+    AsicInfoList         asicInfoList;
+    ADLUtil_VersionsInfo versionsInfo;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    ADLUTIL_CHECK(ADL_TIMED_OUT == pADLUtils->GetAsicInfoList(asicInfoList));
+    ADLUTIL_CHECK(asicInfoList.empty());
+    ADLUTIL_CHECK(ADL_TIMED_OUT == pADLUtils->GetVersionsInfo(versionsInfo));
+    ADLUTIL_CHECK(ADL_STALE == pADLUtils->Refresh());
+    ADLUTIL_CHECK(std::chrono::microseconds(s_latencyUs) > std::chrono::steady_clock::now() - start);
+
+    // three kinds of queries are queued or running, each on its own deadline worker
+    if (0 < initialThreadCount)
+    {
+        ADLUTIL_CHECK(initialThreadCount + 3 == GetThreadCount());
+    }
+
+    // the queries keep running after the deadline and publish their results
+    ADLUtil_Result result = ADL_TIMED_OUT;
+
+    for (int i = 0; i < 400 && ADL_SUCCESS != result; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        result = pADLUtils->GetAsicInfoList(asicInfoList);
+    }
+
+    ADLUTIL_CHECK(ADL_SUCCESS == result);
+    ADLUTIL_CHECK(2 == asicInfoList.size());
+
+    // the workers outlive the queries, ready for the next ones
+    if (0 < initialThreadCount)
+    {
+        ADLUTIL_CHECK(initialThreadCount + 3 == GetThreadCount());
+    }
+
+    // a version query that hangs does not hold up the ASIC list, which has a worker of its own
+    std::this_thread::sleep_for(s_backoff);
+    pADLUtils->Reset();
+    pADLUtils->SetCallDeadline(s_isolationDeadlineMs);
+
+    config.latencyUs = 0;
+    config.versionsLatencyUs = s_hangUs;
+    standIn.Configure(config);
+
+    std::future<ADLUtil_Result> versionsResult = std::async(std::launch::async, [&]()
+    {
+        ADLUtil_VersionsInfo hungVersionsInfo;
+        return pADLUtils->GetVersionsInfo(hungVersionsInfo);
+    });
+
+    while (0 == standIn.GetCounters().versionsCount)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    start = std::chrono::steady_clock::now();
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(asicInfoList));
+    ADLUTIL_CHECK(2 == asicInfoList.size());
+    ADLUTIL_CHECK(std::chrono::milliseconds(s_isolationDeadlineMs) > std::chrono::steady_clock::now() - start);
+
+    // the version info that was returned before serves the caller of the hung query
+    ADLUTIL_CHECK(ADL_STALE == versionsResult.get());
+
+    pADLUtils->SetCallDeadline(0);
+
+    return ADLUtil_GetTestExitCode();
+}
@@ -0,0 +1,43 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests the driver version cache against the return codes of ADL2_Graphics_Versions_Get.
+//==============================================================================
+
+#include "ADLUtilEntrypoints.h"
+#include "ADLUtilTest.h"
+
+// Queries the driver version with the stand-in returning adlResult
+static ADLUtil_Result QueryDriverVersion(ADLUtil_StandIn& standIn, int adlResult, ADLUtil_DriverVersion& driverVersion, ADLUtil_VersionsInfo& versionsInfo)
+{
+    ADLStandIn_Config config = ADLStandIn_GetDefaultConfig();
+    config.versionsResult = adlResult;
+    standIn.Configure(config);
+
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+    pADLUtils->Reset();
+    pADLUtils->GetVersionsInfo(versionsInfo);
+    return pADLUtils->GetDriverVersion(driverVersion);
+}
+
+int main()
+{
+    ADLUtil_StandIn       standIn;
+    ADLUtil_DriverVersion driverVersion;
+    ADLUtil_VersionsInfo  versionsInfo;
+
+    ADLUTIL_CHECK(ADL_SUCCESS == QueryDriverVersion(standIn, ADL_OK, driverVersion, versionsInfo));
+    ADLUTIL_CHECK(23 == driverVersion.majorVer && 20 == driverVersion.minorVer && 1 == driverVersion.subMinorVer);
+    ADLUTIL_CHECK("23.8.1" == versionsInfo.catalystVersion);
+
+    // ADL still fills the versions when it returns a warning
+    ADLUTIL_CHECK(ADL_WARNING == QueryDriverVersion(standIn, ADL_OK_WARNING, driverVersion, versionsInfo));
+    ADLUTIL_CHECK(23 == driverVersion.majorVer && 20 == driverVersion.minorVer && 1 == driverVersion.subMinorVer);
+    ADLUTIL_CHECK("23.8.1" == versionsInfo.catalystVersion);
+
+    ADLUTIL_CHECK(ADL_GRAPHICS_VERSIONS_GET_FAILED == QueryDriverVersion(standIn, ADL_ERR, driverVersion, versionsInfo));
+    ADLUTIL_CHECK(0 == driverVersion.majorVer && versionsInfo.driverVersion.empty());
+
+    return ADLUtil_GetTestExitCode();
+}
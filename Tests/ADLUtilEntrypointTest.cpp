@@ -0,0 +1,48 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests the entry points of a library that does not export ADL2_Main_Control_Create: the missing one reports
+///         that it is not available, and the queries fall back to the legacy ADL context.
+//==============================================================================
+
+#include "ADLUtilEntrypoints.h"
+#include "ADLUtilTest.h"
+
+int main()
+{
+    ADLUtil_StandIn standIn(ADL_STANDIN_LEGACY_LIBRARY);
+
+    AMDTADLUtils*        pADLUtils = AMDTADLUtils::Instance();
+    AMDTADLUtils::Lease  lease;
+    AsicInfoListSnapshot asicInfoList;
+    ADLVersionsInfo      adlVersionInfo;
+
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->AcquireLease(lease));
+
+    // the missing entry point is resolved to nothing, and calling it does not reach the library
+    ADL_CONTEXT_HANDLE context = nullptr;
+
+    ADLUTIL_CHECK(!pADLUtils->IsAvailable<ADLUtil_Entrypoint::ADL2_Main_Control_Create>());
+    ADLUTIL_CHECK(nullptr == pADLUtils->GetEntrypoint<ADLUtil_Entrypoint::ADL2_Main_Control_Create>());
+    ADLUTIL_CHECK(ADL_ERR_NOT_SUPPORTED == pADLUtils->Call<ADLUtil_Entrypoint::ADL2_Main_Control_Create>(nullptr, 1, &context));
+    ADLUTIL_CHECK(nullptr == context);
+
+    // looking it up again gives the same answer from the resolved table
+    ADLUTIL_CHECK(!pADLUtils->IsAvailable<ADLUtil_Entrypoint::ADL2_Main_Control_Create>());
+
+    // the library was initialized through the legacy entry point, and the other entry points still resolve
+    ADLUTIL_CHECK(pADLUtils->IsAvailable<ADLUtil_Entrypoint::ADL_Main_Control_Create>());
+    ADLUTIL_CHECK(pADLUtils->IsAvailable<ADLUtil_Entrypoint::ADL2_Adapter_AdapterInfo_Get>());
+    ADLUTIL_CHECK(nullptr == pADLUtils->GetContext());
+    ADLUTIL_CHECK(1 == standIn.GetCounters().createCount);
+
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(asicInfoList));
+    ADLUTIL_CHECK(2 == asicInfoList->size());
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetADLVersionsInfo(adlVersionInfo));
+    ADLUTIL_CHECK(0 != adlVersionInfo.strDriverVer[0]);
+
+    lease.Release();
+
+    return ADLUtil_GetTestExitCode();
+}
@@ -0,0 +1,124 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Synthetic sysfs tree of the sysfs backend tests and benchmarks.
+//==============================================================================
+
+#ifndef _ADL_UTIL_FAKE_SYSFS_H_
+#define _ADL_UTIL_FAKE_SYSFS_H_
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+/// One PCI device of the fake tree. Attributes that are empty are not written.
+struct ADLUtil_FakePCIDevice
+{
+    std::string slotName;        ///< the PCI slot name, ie "0000:03:00.0"
+    std::string vendor;          ///< the vendor attribute, ie "0x1002"
+    std::string device;          ///< the device attribute, ie "0x73bf"
+    std::string classCode;       ///< the class attribute, ie "0x030000" for a VGA controller
+    std::string revision;        ///< the revision attribute, ie "0xc1"
+    std::string subsystemVendor; ///< the subsystem_vendor attribute
+    std::string subsystemDevice; ///< the subsystem_device attribute
+    std::string productName;     ///< the product_name attribute amdgpu writes for some boards
+    std::string linkWidth;       ///< the current_link_width attribute, ie "16"
+    std::string numaNode;        ///< the numa_node attribute, ie "0"
+    std::string localCPUList;    ///< the local_cpulist attribute, ie "0-7,16-23"
+};
+
+/// @returns an AMD display controller at the given slot with all of its IDs.
+inline ADLUtil_FakePCIDevice ADLUtil_MakeFakeAMDDevice(const std::string& slotName, const std::string& device)
+{
+    ADLUtil_FakePCIDevice fakeDevice;
+    fakeDevice.slotName = slotName;
+    fakeDevice.vendor = "0x1002";
+    fakeDevice.device = device;
+    fakeDevice.classCode = "0x030000";
+    fakeDevice.revision = "0xc1";
+    fakeDevice.subsystemVendor = "0x1da2";
+    fakeDevice.subsystemDevice = "0xe387";
+    return fakeDevice;
+}
+
+//------------------------------------------------------------------------------------
+/// A bus/pci/devices and class/drm tree under the temporary directory, laid out like the
+/// kernel's except that the device links of the DRM cards are plain directories. The tree
+/// is removed when the object goes away.
+//------------------------------------------------------------------------------------
+class ADLUtil_FakeSysfs
+{
+public:
+    /// constructor, creates an empty tree
+    /// @param[in] name the name of the tree's directory, unique per test
+    explicit ADLUtil_FakeSysfs(const std::string& name) :
+        m_root(std::filesystem::temp_directory_path() / name)
+    {
+        std::filesystem::remove_all(m_root);
+        std::filesystem::create_directories(m_root / "bus" / "pci" / "devices");
+        std::filesystem::create_directories(m_root / "class" / "drm");
+    }
+
+    /// destructor, removes the tree
+    ~ADLUtil_FakeSysfs()
+    {
+        std::error_code error;
+        std::filesystem::remove_all(m_root, error);
+    }
+
+    ADLUtil_FakeSysfs(const ADLUtil_FakeSysfs&) = delete;
+    ADLUtil_FakeSysfs& operator=(const ADLUtil_FakeSysfs&) = delete;
+
+    /// @returns the root of the tree, to pass to AMDTADLUtils::SetSysfsRoot.
+    std::string GetRoot() const { return m_root.string(); }
+
+    /// Adds a PCI device
+    void AddDevice(const ADLUtil_FakePCIDevice& device)
+    {
+        std::filesystem::path devicePath = m_root / "bus" / "pci" / "devices" / device.slotName;
+        std::filesystem::create_directories(devicePath);
+        WriteAttribute(devicePath / "vendor", device.vendor);
+        WriteAttribute(devicePath / "device", device.device);
+        WriteAttribute(devicePath / "class", device.classCode);
+        WriteAttribute(devicePath / "revision", device.revision);
+        WriteAttribute(devicePath / "subsystem_vendor", device.subsystemVendor);
+        WriteAttribute(devicePath / "subsystem_device", device.subsystemDevice);
+        WriteAttribute(devicePath / "product_name", device.productName);
+        WriteAttribute(devicePath / "current_link_width", device.linkWidth);
+        WriteAttribute(devicePath / "numa_node", device.numaNode);
+        WriteAttribute(devicePath / "local_cpulist", device.localCPUList);
+    }
+
+    /// Adds a DRM card, or one of its connectors, driven by the PCI device at the given slot
+    /// @param[in] cardName the name of the card, ie "card0" or "card0-DP-1"
+    /// @param[in] slotName the PCI slot name the card's uevent reports
+    void AddDRMCard(const std::string& cardName, const std::string& slotName)
+    {
+        std::filesystem::path devicePath = m_root / "class" / "drm" / cardName / "device";
+        std::filesystem::create_directories(devicePath);
+        WriteAttribute(devicePath / "uevent", "DRIVER=amdgpu\nPCI_SLOT_NAME=" + slotName);
+    }
+
+    /// Sets the version the amdgpu module reports
+    void SetDriverVersion(const std::string& version)
+    {
+        std::filesystem::path modulePath = m_root / "module" / "amdgpu";
+        std::filesystem::create_directories(modulePath);
+        WriteAttribute(modulePath / "version", version);
+    }
+
+private:
+    /// Writes an attribute with its trailing newline, unless the value is empty
+    static void WriteAttribute(const std::filesystem::path& path, const std::string& value)
+    {
+        if (!value.empty())
+        {
+            std::ofstream(path) << value << '\n';
+        }
+    }
+
+    std::filesystem::path m_root; ///< the root of the tree
+};
+
+#endif //_ADL_UTIL_FAKE_SYSFS_H_
@@ -0,0 +1,89 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests that the per-thread instrumentation states are recycled and that exports run while threads record.
+//==============================================================================
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ADLUtilEntrypoints.h"
+#include "ADLUtilTest.h"
+
+// Threads alive at the same time, and waves of them started one after the other
+static constexpr uint32_t s_concurrentThreadCount = 4;
+static constexpr uint32_t s_waveCount = 32;
+
+// Calls each thread records, more than a thread's trace keeps so that the ring wraps
+static constexpr uint32_t s_callsPerThread = 3000;
+
+// @returns the calls recorded for ADL2_Adapter_VRAMUsage_Get so far.
+static uint64_t GetRecordedCallCount(ADLUtil_InstrumentationSnapshot& snapshot)
+{
+    ADLUtil_GetInstrumentationSnapshot(snapshot);
+    return snapshot.entrypoints[static_cast<uint32_t>(ADLUtil_Entrypoint::ADL2_Adapter_VRAMUsage_Get)].callCount;
+}
+
+int main()
+{
+    ADLUTIL_CHECK(ADLUtil_IsInstrumentationEnabled());
+
+    ADLUtil_InstrumentationSnapshot snapshot;
+    uint64_t                        initialCallCount = GetRecordedCallCount(snapshot);
+    uint32_t                        initialStateCount = snapshot.threadStateCount;
+
+    std::atomic<bool> stop(false);
+    std::string       tracePath = "adl_util_test_instrumentation_trace.json";
+
+    // exports the counters and the trace while the threads record into them
+    std::thread exporter([&]()
+    {
+        while (!stop)
+        {
+            ADLUtil_InstrumentationSnapshot exportSnapshot;
+            ADLUtil_GetInstrumentationSnapshot(exportSnapshot);
+            ADLUTIL_CHECK(ADLUtil_WriteChromeTrace(tracePath));
+        }
+    });
+
+    for (uint32_t wave = 0; wave < s_waveCount; ++wave)
+    {
+        std::vector<std::thread> threads;
+
+        for (uint32_t thread = 0; thread < s_concurrentThreadCount; ++thread)
+        {
+            threads.emplace_back([]()
+            {
+                for (uint32_t call = 0; call < s_callsPerThread; ++call)
+                {
+                    uint64_t startNs = ADLUtil_GetTimestampNs();
+                    ADLUtil_RecordCall(ADLUtil_Entrypoint::ADL2_Adapter_VRAMUsage_Get, ADL_OK, startNs, startNs + call);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    stop = true;
+    exporter.join();
+
+    // the exited threads gave their states to the next waves, so the states are bounded by the concurrent threads
+    // (plus the exporter), and the counts of the exited threads are kept
+    uint64_t callCount = GetRecordedCallCount(snapshot);
+    ADLUTIL_CHECK(static_cast<uint64_t>(s_waveCount) * s_concurrentThreadCount * s_callsPerThread == callCount - initialCallCount);
+    ADLUTIL_CHECK(initialStateCount + s_concurrentThreadCount + 1 >= snapshot.threadStateCount);
+    ADLUTIL_CHECK(0 < snapshot.droppedTraceEvents);
+
+    ADLUTIL_CHECK(ADLUtil_WriteChromeTrace(tracePath));
+    remove(tracePath.c_str());
+
+    return ADLUtil_GetTestExitCode();
+}
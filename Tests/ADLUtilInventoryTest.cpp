@@ -0,0 +1,130 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests that inventory records round-trip through a file, that records of a newer writer can be read, and that
+///         the configuration hash tells configurations rather than hosts apart.
+//==============================================================================
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "ADLUtilInventory.h"
+#include "ADLUtilTest.h"
+
+// @returns an inventory record of the stand-in adapters, as the export tool builds it.
+static ADLUtil_InventoryRecord MakeRecord(const char* pHostName)
+{
+    AMDTADLUtils*        pADLUtils = AMDTADLUtils::Instance();
+    AsicInfoList         asicInfoList;
+    ADLUtil_VersionsInfo versionsInfo;
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(asicInfoList));
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetVersionsInfo(versionsInfo));
+
+    ADLUtil_InventoryRecord record;
+    ADLUtil_BuildInventoryRecord(pHostName, asicInfoList, versionsInfo, record);
+    record.header.enumerationNs = 12345;
+    return record;
+}
+
+// @returns true if two records hold the same header and adapters.
+static bool IsEqual(const ADLUtil_InventoryRecord& lhs, const ADLUtil_InventoryRecord& rhs)
+{
+    return 0 == memcmp(&lhs.header, &rhs.header, sizeof(lhs.header)) && lhs.adapters.size() == rhs.adapters.size() &&
+           (lhs.adapters.empty() || 0 == memcmp(lhs.adapters.data(), rhs.adapters.data(), lhs.adapters.size() * sizeof(ADLUtil_InventoryAdapter)));
+}
+
+// Records written to a file read back unchanged, and hash by configuration
+static void TestRoundTrip(ADLUtil_StandIn& standIn)
+{
+    ADLUtil_InventoryRecord first = MakeRecord("host-a");
+    ADLUtil_InventoryRecord second = MakeRecord("host-b");
+
+    ADLStandIn_Config config = ADLStandIn_GetDefaultConfig();
+    config.gpuCount = 3;
+    standIn.Configure(config);
+    ADLUTIL_CHECK(ADL_SUCCESS == AMDTADLUtils::Instance()->Refresh());
+    ADLUtil_InventoryRecord third = MakeRecord("host-c");
+    standIn.Configure(ADLStandIn_GetDefaultConfig());
+    ADLUTIL_CHECK(ADL_SUCCESS == AMDTADLUtils::Instance()->Refresh());
+
+    ADLUTIL_CHECK(2 == first.adapters.size() && 3 == third.adapters.size());
+    ADLUTIL_CHECK(0 == strcmp("host-a", first.header.hostName) && ADLUTIL_INVENTORY_MAGIC == first.header.magic);
+
+    FILE* pFile = tmpfile();
+    ADLUTIL_CHECK(nullptr != pFile);
+
+    if (nullptr == pFile)
+    {
+        return;
+    }
+
+    ADLUTIL_CHECK(ADLUtil_WriteInventoryRecord(pFile, first));
+    ADLUTIL_CHECK(ADLUtil_WriteInventoryRecord(pFile, second));
+    ADLUTIL_CHECK(ADLUtil_WriteInventoryRecord(pFile, third));
+    rewind(pFile);
+
+    // one record object for the whole stream, as the aggregator reads
+    ADLUtil_InventoryRecord record;
+    ADLUTIL_CHECK(ADLUtil_ReadInventoryRecord(pFile, record) && IsEqual(first, record));
+    ADLUTIL_CHECK(ADLUtil_ReadInventoryRecord(pFile, record) && IsEqual(second, record));
+    ADLUTIL_CHECK(ADLUtil_ReadInventoryRecord(pFile, record) && IsEqual(third, record));
+    ADLUTIL_CHECK(!ADLUtil_ReadInventoryRecord(pFile, record));
+    fclose(pFile);
+
+    // the host and the timings do not make a configuration, the adapters do
+    ADLUTIL_CHECK(ADLUtil_HashInventoryConfiguration(first) == ADLUtil_HashInventoryConfiguration(second));
+    ADLUTIL_CHECK(ADLUtil_HashInventoryConfiguration(first) != ADLUtil_HashInventoryConfiguration(third));
+}
+
+// A newer writer may append fields to the header and the adapters; an older reader skips them
+static void TestNewerWriter()
+{
+    ADLUtil_InventoryRecord record = MakeRecord("host-new");
+
+    static constexpr size_t s_appendedSize = 8;
+    ADLUtil_InventoryHeader header = record.header;
+    header.headerSize += s_appendedSize;
+    header.adapterSize += s_appendedSize;
+
+    std::vector<char> appended(s_appendedSize, '\x7f');
+    FILE*             pFile = tmpfile();
+    ADLUTIL_CHECK(nullptr != pFile);
+
+    if (nullptr == pFile)
+    {
+        return;
+    }
+
+    fwrite(&header, sizeof(header), 1, pFile);
+    fwrite(appended.data(), 1, appended.size(), pFile);
+
+    for (const ADLUtil_InventoryAdapter& adapter : record.adapters)
+    {
+        fwrite(&adapter, sizeof(adapter), 1, pFile);
+        fwrite(appended.data(), 1, appended.size(), pFile);
+    }
+
+    // garbage after the record is not a record
+    fwrite("garbage", 1, 7, pFile);
+    rewind(pFile);
+
+    ADLUtil_InventoryRecord readRecord;
+    ADLUTIL_CHECK(ADLUtil_ReadInventoryRecord(pFile, readRecord));
+    ADLUTIL_CHECK(record.adapters.size() == readRecord.adapters.size() && 0 == strcmp("host-new", readRecord.header.hostName));
+    ADLUTIL_CHECK(!record.adapters.empty() && !readRecord.adapters.empty() &&
+                  0 == memcmp(&record.adapters.back(), &readRecord.adapters.back(), sizeof(ADLUtil_InventoryAdapter)));
+    ADLUTIL_CHECK(!ADLUtil_ReadInventoryRecord(pFile, readRecord));
+    fclose(pFile);
+}
+
+int main()
+{
+    ADLUtil_StandIn standIn;
+
+    TestRoundTrip(standIn);
+    TestNewerWriter();
+
+    return ADLUtil_GetTestExitCode();
+}
@@ -0,0 +1,110 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests leased calls against the idle unload, and that Unload gives up on leases that are never released.
+//==============================================================================
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "ADLUtilEntrypoints.h"
+#include "ADLUtilSampler.h"
+#include "ADLUtilTest.h"
+
+// Threads making leased calls while the library unloads whenever it is idle for a moment
+static constexpr uint32_t s_callerCount = 4;
+static constexpr uint32_t s_callsPerCaller = 200;
+
+// Leased calls succeed, and entry points resolve without a lease, while the idle unload frees and reloads the library
+static void TestCallsAgainstIdleUnload(ADLUtil_StandIn& standIn)
+{
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+    pADLUtils->SetIdleUnloadTimeout(1);
+
+    std::atomic<bool>        stop(false);
+    std::vector<std::thread> threads;
+
+    // resolves entry points without holding a lease, racing the unloads
+    threads.emplace_back([&]()
+    {
+        while (!stop)
+        {
+            pADLUtils->IsAvailable<ADLUtil_Entrypoint::ADL2_Adapter_VRAMUsage_Get>();
+            pADLUtils->IsAvailable<ADLUtil_Entrypoint::ADL2_Overdrive5_Temperature_Get>();
+        }
+    });
+
+    for (uint32_t caller = 0; caller < s_callerCount; ++caller)
+    {
+        threads.emplace_back([&]()
+        {
+            for (uint32_t call = 0; call < s_callsPerCaller; ++call)
+            {
+                AMDTADLUtils::Lease lease;
+                ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->AcquireLease(lease));
+
+                int vramUsageMB = 0;
+                ADLUTIL_CHECK(ADL_OK == pADLUtils->Call<ADLUtil_Entrypoint::ADL2_Adapter_VRAMUsage_Get>(
+                                            static_cast<ADL_CONTEXT_HANDLE>(pADLUtils->GetContext()), 0, &vramUsageMB));
+                ADLUTIL_CHECK(512 == vramUsageMB);
+
+                lease.Release();
+                std::this_thread::sleep_for(std::chrono::microseconds(500 * (call % 4)));
+            }
+        });
+    }
+
+    for (size_t thread = 1; thread < threads.size(); ++thread)
+    {
+        threads[thread].join();
+    }
+
+    stop = true;
+    threads[0].join();
+
+    pADLUtils->SetIdleUnloadTimeout(0);
+
+    // the library was unloaded and loaded again while the threads called it
+    ADLUTIL_CHECK(1 < standIn.GetCounters().createCount);
+}
+
+// Unload returns ADL_LEASES_HELD instead of waiting forever for a lease of the calling thread or a running sampler
+static void TestUnloadWithHeldLeases(ADLUtil_StandIn& standIn)
+{
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+
+    AMDTADLUtils::Lease lease;
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->AcquireLease(lease));
+    ADLUTIL_CHECK(ADL_LEASES_HELD == pADLUtils->Unload(20));
+
+    // the library stayed loaded for the lease holder
+    int vramUsageMB = 0;
+    ADLUTIL_CHECK(ADL_OK == pADLUtils->Call<ADLUtil_Entrypoint::ADL2_Adapter_VRAMUsage_Get>(
+                                static_cast<ADL_CONTEXT_HANDLE>(pADLUtils->GetContext()), 0, &vramUsageMB));
+
+    lease.Release();
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->Unload(20));
+
+    ADLUtil_TelemetrySampler sampler;
+    ADLUTIL_CHECK(ADL_SUCCESS == sampler.Start(100));
+    ADLUTIL_CHECK(ADL_LEASES_HELD == pADLUtils->Unload(20));
+
+    sampler.Stop();
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->Unload(20));
+
+    ADLStandIn_Counters counters = standIn.GetCounters();
+    ADLUTIL_CHECK(0 < counters.telemetryCount);
+}
+
+int main()
+{
+    ADLUtil_StandIn standIn;
+
+    TestCallsAgainstIdleUnload(standIn);
+    TestUnloadWithHeldLeases(standIn);
+
+    return ADLUtil_GetTestExitCode();
+}
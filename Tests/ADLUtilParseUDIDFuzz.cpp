@@ -0,0 +1,174 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  adl_util_bench_parse_udid: ADLUtil_ParseUDID and ADLUtil_ParseAdapterInfo over synthetic AdapterInfo arrays.
+///         Built with ADL_UTIL_FUZZER, the same file is adl_util_fuzz_parse_udid, a libFuzzer target that checks the
+///         invariants of both parsers on arbitrary input.
+//==============================================================================
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ADLUtil.h"
+#include "ADLUtilEntrypoints.h"
+
+#ifndef ADL_UTIL_FUZZER
+    #include "ADLUtilBench.h"
+    #include "ADLUtilTest.h"
+#endif
+
+// Checks what the parsers promise for any input. The UDID also fills the adapter info, truncated and unterminated if
+// it does not fit, and the adapter name is the UDID reversed, so that both strings see the same bytes.
+// @returns true if the invariants hold.
+static bool CheckParsers(std::string_view udid, int busLocation)
+{
+    ADLUtil_PCIIdentity     pciIdentity;
+    ADLUtil_UDIDParseResult result = ADLUtil_ParseUDID(udid, pciIdentity);
+
+    if (ADL_UDID_OK > result || ADL_UDID_MALFORMED_FIELD < result)
+    {
+        return false;
+    }
+
+    if (0 > pciIdentity.vendorID || 0xffff < pciIdentity.vendorID || 0 > pciIdentity.deviceID || 0xffff < pciIdentity.deviceID ||
+        0 > pciIdentity.revID || 0xff < pciIdentity.revID)
+    {
+        return false;
+    }
+
+    if (!pciIdentity.deviceIDString.empty() &&
+        (4 != pciIdentity.deviceIDString.size() || pciIdentity.deviceID != static_cast<int>(strtoul(pciIdentity.deviceIDString.c_str(), nullptr, 16))))
+    {
+        return false;
+    }
+
+    if (ADL_UDID_OK == result && pciIdentity.deviceIDString.empty())
+    {
+        return false;
+    }
+
+    AdapterInfo adapterInfo = {};
+    size_t      udidLength = std::min(udid.size(), sizeof(adapterInfo.strUDID));
+    memcpy(adapterInfo.strUDID, udid.data(), udidLength);
+    std::string adapterName(udid.rbegin(), udid.rbegin() + static_cast<ptrdiff_t>(std::min(udid.size(), sizeof(adapterInfo.strAdapterName))));
+    memcpy(adapterInfo.strAdapterName, adapterName.data(), adapterName.size());
+    adapterInfo.iBusNumber = busLocation >> 8;
+    adapterInfo.iDeviceNumber = (busLocation >> 3) & 0x1f;
+    adapterInfo.iFunctionNumber = busLocation & 0x7;
+
+    // ADL strings end at the first NUL or at the end of the buffer
+    std::string_view storedUDID(adapterInfo.strUDID, strnlen(adapterInfo.strUDID, sizeof(adapterInfo.strUDID)));
+
+    ADLUtil_PCIIdentity storedIdentity;
+    ADLUtil_ASICInfo    asicInfo;
+
+    if (ADLUtil_ParseUDID(storedUDID, storedIdentity) != ADLUtil_ParseAdapterInfo(adapterInfo, asicInfo))
+    {
+        return false;
+    }
+
+    return asicInfo.vendorID == storedIdentity.vendorID && asicInfo.deviceID == storedIdentity.deviceID && asicInfo.revID == storedIdentity.revID &&
+           asicInfo.deviceIDString == storedIdentity.deviceIDString && asicInfo.busNumber == adapterInfo.iBusNumber &&
+           asicInfo.udid == storedUDID.substr(0, asicInfo.udid.capacity()) && sizeof(adapterInfo.strAdapterName) >= asicInfo.adapterName.size() &&
+           (asicInfo.adapterName.empty() || ' ' != asicInfo.adapterName.c_str()[asicInfo.adapterName.size() - 1]);
+}
+
+#ifdef ADL_UTIL_FUZZER
+
+// The first two bytes are the bus location, the rest is the UDID
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* pData, size_t size)
+{
+    if (2 > size)
+    {
+        return 0;
+    }
+
+    int busLocation = (pData[0] << 8) | pData[1];
+
+    if (!CheckParsers(std::string_view(reinterpret_cast<const char*>(pData + 2), size - 2), busLocation))
+    {
+        abort();
+    }
+
+    return 0;
+}
+
+#else
+
+// @returns an AdapterInfo as ADL fills it for the given adapter
+static AdapterInfo MakeAdapterInfo(int adapter)
+{
+    AdapterInfo adapterInfo = {};
+    adapterInfo.iSize = sizeof(adapterInfo);
+    adapterInfo.iAdapterIndex = adapter;
+    adapterInfo.iBusNumber = adapter + 1;
+    adapterInfo.iVendorID = 0x1002;
+    snprintf(adapterInfo.strUDID, sizeof(adapterInfo.strUDID), "PCI_VEN_1002&DEV_%04X&SUBSYS_E3871DA2&REV_%02X_4&%X&0&%04X",
+             0x73A0 + adapter % 32, 0xC0 + adapter % 8, adapter, adapter * 8);
+    snprintf(adapterInfo.strAdapterName, sizeof(adapterInfo.strAdapterName), "AMD Radeon RX %d      ", 6000 + adapter);
+    snprintf(adapterInfo.strDriverPath, sizeof(adapterInfo.strDriverPath), "\\Registry\\Machine\\System\\Class\\%04d", adapter);
+    return adapterInfo;
+}
+
+int main(int argc, char* argv[])
+{
+    ADLUtil_Bench bench(argc, argv);
+
+    // inputs that are malformed, truncated or not terminated
+    std::string fullUDID(ADL_MAX_PATH, 'F');
+    memcpy(&fullUDID[0], "PCI_VEN_1002&DEV_73BF&REV_C1&", 29);
+
+    for (std::string_view udid : {"", "PCI_VEN_1002", "PCI_VEN_1002&DEV_73B", "PCI_VEN_1002&DEV_73BG&REV_C1", "PCI_VEN_&DEV_&REV_",
+                                  "VEN_1002\\DEV_73BF\\REV_C1", "&&&\\\\", "PCI_VEN_1002&DEV_73BF&SUBSYS_E3871DA&REV_C1"})
+    {
+        ADLUTIL_CHECK(CheckParsers(udid, 0x300));
+    }
+
+    ADLUTIL_CHECK(CheckParsers(fullUDID, 0xffff));
+
+    for (int adapterCount : {1, 16, 256})
+    {
+        std::vector<AdapterInfo> adapterInfos;
+
+        for (int adapter = 0; adapter < adapterCount; ++adapter)
+        {
+            adapterInfos.push_back(MakeAdapterInfo(adapter));
+            ADLUTIL_CHECK(CheckParsers(adapterInfos.back().strUDID, adapter << 3));
+        }
+
+        uint64_t iterations = bench.GetIterations(16.0 / adapterCount);
+
+        bench.Run("parse_udid/adapters:" + std::to_string(adapterCount), iterations, [&](uint64_t)
+        {
+            for (const AdapterInfo& adapterInfo : adapterInfos)
+            {
+                ADLUtil_PCIIdentity pciIdentity;
+                ADLUTIL_CHECK(ADL_UDID_OK == ADLUtil_ParseUDID(adapterInfo.strUDID, pciIdentity));
+            }
+        });
+
+        ADLUtil_ASICInfo asicInfo;
+
+        bench.Run("parse_adapter_info/adapters:" + std::to_string(adapterCount), iterations, [&](uint64_t)
+        {
+            for (const AdapterInfo& adapterInfo : adapterInfos)
+            {
+                ADLUTIL_CHECK(ADL_UDID_OK == ADLUtil_ParseAdapterInfo(adapterInfo, asicInfo));
+            }
+        });
+    }
+
+    int benchResult = bench.Finish();
+    int testResult = ADLUtil_GetTestExitCode();
+
+    return (0 != testResult) ? testResult : benchResult;
+}
+
+#endif
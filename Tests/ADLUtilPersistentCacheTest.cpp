@@ -0,0 +1,103 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests when the persistent enumeration cache is served, revalidated and cancelled.
+//==============================================================================
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+
+#include "ADLUtilCache.h"
+#include "ADLUtilTest.h"
+
+// The cache file of the test, in the working directory of the test
+static const char* const s_cachePath = "adl_util_test_persistent_cache.bin";
+
+// The default revalidation age
+static constexpr uint32_t s_dayInSeconds = 24 * 60 * 60;
+
+// Waits up to 5 seconds for a condition
+static bool WaitFor(const std::function<bool()>& condition)
+{
+    for (int i = 0; i < 500; ++i)
+    {
+        if (condition())
+        {
+            return true;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    return condition();
+}
+
+// Simulates a new launch: drops everything the singleton holds and enables the cache again, so that the next query reads the file
+static void Relaunch(ADLUtil_StandIn& standIn, const ADLStandIn_Config& config, uint32_t revalidationAgeSeconds)
+{
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+    pADLUtils->SetPersistentCachePath("");
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->Unload());
+    standIn.Configure(config);
+    pADLUtils->SetPersistentCachePath(s_cachePath, revalidationAgeSeconds);
+}
+
+int main()
+{
+    ADLUtil_StandIn   standIn;
+    AMDTADLUtils*     pADLUtils = AMDTADLUtils::Instance();
+    ADLStandIn_Config config = ADLStandIn_GetDefaultConfig();
+    AsicInfoList      asicInfoList;
+
+    remove(s_cachePath);
+
+    // cold launch: the callers enumerate live and the revalidation writes their result to the file
+    Relaunch(standIn, config, s_dayInSeconds);
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(asicInfoList) && 2 == asicInfoList.size());
+
+    ADLUtil_CacheContents contents;
+    ADLUTIL_CHECK(WaitFor([&]() { return ADLUtil_ReadCacheFile(s_cachePath, ADLUtil_Backend::ADL, contents); }));
+    ADLUTIL_CHECK(2 == contents.asicInfoList.size() && 0 != contents.stamp.driverStamp);
+
+    // the stamp is taken from the library file the entry points were resolved in
+    ADLUTIL_CHECK(ADL_STANDIN_LIBRARY == contents.stamp.libraryPath);
+
+    // the file is keyed by the backend
+    ADLUTIL_CHECK(!ADLUtil_ReadCacheFile(s_cachePath, ADLUtil_Backend::Sysfs, contents));
+
+    // warm launch with the same driver: the file is served and ADL is not loaded, not even in the background
+    Relaunch(standIn, config, s_dayInSeconds);
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(asicInfoList) && 2 == asicInfoList.size());
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    ADLUTIL_CHECK(0 == standIn.GetCounters().createCount);
+
+    // warm launch after the hardware changed, with a file that aged out: the file is served, then the revalidation
+    // publishes the live adapters and rewrites the file
+    config.gpuCount = 3;
+    Relaunch(standIn, config, 0);
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(asicInfoList) && 2 == asicInfoList.size());
+    ADLUTIL_CHECK(WaitFor([&]() { return ADL_SUCCESS == pADLUtils->GetAsicInfoList(asicInfoList) && 3 == asicInfoList.size(); }));
+    ADLUTIL_CHECK(WaitFor([&]() { return ADLUtil_ReadCacheFile(s_cachePath, ADLUtil_Backend::ADL, contents) && 3 == contents.asicInfoList.size(); }));
+
+    // a file of the ADL backend is not served to the sysfs backend
+    pADLUtils->SetBackend(ADLUtil_Backend::Sysfs);
+    pADLUtils->SetSysfsRoot("adl_util_test_persistent_cache_no_sysfs");
+    Relaunch(standIn, config, s_dayInSeconds);
+    ADLUTIL_CHECK(ADL_NOT_FOUND == pADLUtils->GetAsicInfoList(asicInfoList) && asicInfoList.empty());
+    pADLUtils->SetBackend(ADLUtil_Backend::ADL);
+
+    // disabling the cache, like the destructor, cancels the revalidation before its version query
+    config.latencyUs = 100000;
+    Relaunch(standIn, config, 0);
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(asicInfoList) && 3 == asicInfoList.size());
+    pADLUtils->SetPersistentCachePath("");
+    ADLUTIL_CHECK(0 == standIn.GetCounters().versionsCount);
+
+    remove(s_cachePath);
+
+    return ADLUtil_GetTestExitCode();
+}
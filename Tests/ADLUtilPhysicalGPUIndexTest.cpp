@@ -0,0 +1,79 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests the lookups of the physical GPU index over logical adapters of several GPUs, one of them with two
+///         logical adapters that are not adjacent in the list.
+//==============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "ADLUtilPhysicalGPUIndex.h"
+#include "ADLUtilTest.h"
+
+// @returns a logical adapter of the GPU at the given bus
+static ADLUtil_ASICInfo MakeAdapter(int busNumber, int deviceID, int revID, int adapterIndex)
+{
+    ADLUtil_ASICInfo asicInfo = {};
+    asicInfo.vendorID = 0x1002;
+    asicInfo.deviceID = deviceID;
+    asicInfo.revID = revID;
+    asicInfo.busNumber = busNumber;
+    asicInfo.adapterIndex = adapterIndex;
+    return asicInfo;
+}
+
+// @returns the physical GPUs of a range in ascending order
+static std::vector<uint32_t> Sorted(ADLUtil_PhysicalGPURange range)
+{
+    std::vector<uint32_t> physicalGPUs(range.begin(), range.end());
+    std::sort(physicalGPUs.begin(), physicalGPUs.end());
+    return physicalGPUs;
+}
+
+int main()
+{
+    // GPUs on buses 1 to 4 in the order of their first logical adapter; the GPU on bus 1 has a second one further down
+    AsicInfoList asicInfoList = {MakeAdapter(1, 0x73BF, 0xC1, 0), MakeAdapter(2, 0x73BF, 0xC3, 1), MakeAdapter(1, 0x73BF, 0xC1, 2),
+                                 MakeAdapter(3, 0x73A0, 0xC1, 3), MakeAdapter(4, 0x73BF, 0xC1, 4)};
+
+    ADLUtil_PhysicalGPUIndex physicalGPUIndex(asicInfoList);
+    ADLUTIL_CHECK(4 == physicalGPUIndex.GetCount());
+
+    for (uint32_t physicalGPU = 0; physicalGPU < physicalGPUIndex.GetCount(); ++physicalGPU)
+    {
+        ADLUTIL_CHECK(static_cast<int>(physicalGPU) + 1 == physicalGPUIndex.GetBusNumber(physicalGPU));
+        ADLUTIL_CHECK(physicalGPU == physicalGPUIndex.FindByBusLocation(0, static_cast<int>(physicalGPU) + 1, 0, 0));
+    }
+
+    // both logical adapters of the first GPU, the first of them in list order
+    ADLUTIL_CHECK((std::vector<uint32_t>{0, 2}) == Sorted(physicalGPUIndex.GetLogicalAdapters(0)));
+    ADLUTIL_CHECK(0 == physicalGPUIndex.GetFirstLogicalAdapter(0));
+    ADLUTIL_CHECK(1 == physicalGPUIndex.GetFirstLogicalAdapter(1));
+    ADLUTIL_CHECK(3 == physicalGPUIndex.GetFirstLogicalAdapter(2));
+    ADLUTIL_CHECK(4 == physicalGPUIndex.GetFirstLogicalAdapter(3));
+    ADLUTIL_CHECK(1 == physicalGPUIndex.GetLogicalAdapters(3).size());
+
+    // every GPU is found once by its device ID, and by its revision only with the matching one
+    ADLUTIL_CHECK((std::vector<uint32_t>{0, 1, 3}) == Sorted(physicalGPUIndex.FindByDeviceID(0x73BF)));
+    ADLUTIL_CHECK((std::vector<uint32_t>{2}) == Sorted(physicalGPUIndex.FindByDeviceID(0x73A0)));
+    ADLUTIL_CHECK(physicalGPUIndex.FindByDeviceID(0x1234).empty());
+
+    ADLUTIL_CHECK((std::vector<uint32_t>{0, 3}) == Sorted(physicalGPUIndex.FindByRevision(0x73BF, 0xC1)));
+    ADLUTIL_CHECK((std::vector<uint32_t>{1}) == Sorted(physicalGPUIndex.FindByRevision(0x73BF, 0xC3)));
+    ADLUTIL_CHECK((std::vector<uint32_t>{2}) == Sorted(physicalGPUIndex.FindByRevision(0x73A0, 0xC1)));
+    ADLUTIL_CHECK(physicalGPUIndex.FindByRevision(0x73BF, 0xC2).empty());
+    ADLUTIL_CHECK(physicalGPUIndex.FindByRevision(0x73A0, 0xC3).empty());
+
+    ADLUTIL_CHECK(ADLUtil_PhysicalGPUIndex::s_notFound == physicalGPUIndex.FindByBusLocation(0, 5, 0, 0));
+    ADLUTIL_CHECK(ADLUtil_PhysicalGPUIndex::s_notFound == physicalGPUIndex.FindByBusLocation(0, 1, 0, 1));
+
+    // an index without adapters finds nothing
+    ADLUtil_PhysicalGPUIndex emptyIndex(AsicInfoList{});
+    ADLUTIL_CHECK(0 == emptyIndex.GetCount());
+    ADLUTIL_CHECK(emptyIndex.FindByDeviceID(0x73BF).empty() && emptyIndex.FindByRevision(0x73BF, 0xC1).empty());
+    ADLUTIL_CHECK(ADLUtil_PhysicalGPUIndex::s_notFound == emptyIndex.FindByBusLocation(0, 1, 0, 0));
+
+    return ADLUtil_GetTestExitCode();
+}
@@ -0,0 +1,143 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests AMDTADLUtils::Refresh: the adapters added, removed and changed between enumerations, the generations,
+///         and that ADLUtil_Unsubscribe stops the notifications.
+//==============================================================================
+
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ADLUtilAsync.h"
+#include "ADLUtilTest.h"
+
+typedef std::vector<uint32_t>                      AdapterIndices;
+typedef std::vector<std::pair<uint32_t, uint32_t>> AdapterIndexPairs;
+
+// Notifications received by a subscriber
+struct Notifications
+{
+    std::mutex                          mutex;   ///< protects changes
+    std::vector<ADLUtil_AdapterChanges> changes; ///< the changes of every notification
+
+    // @returns the notifications received since the last call
+    std::vector<ADLUtil_AdapterChanges> Take()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return std::move(changes);
+    }
+};
+
+// Reconfigures the stand-in library, refreshes, and checks the one notification of the new generation
+static void CheckRefresh(ADLUtil_StandIn& standIn, const ADLStandIn_Config& config, Notifications& notifications,
+                         const AdapterIndices& added, const AdapterIndices& removed, const AdapterIndexPairs& changed)
+{
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+    uint64_t      previousGeneration = pADLUtils->GetGeneration();
+
+    // UDIDs without a revision are parsed with a warning, and still published
+    standIn.Configure(config);
+    ADLUTIL_CHECK((config.omitRevision ? ADL_WARNING : ADL_SUCCESS) == pADLUtils->Refresh());
+    ADLUTIL_CHECK(previousGeneration + 1 == pADLUtils->GetGeneration());
+
+    std::vector<ADLUtil_AdapterChanges> received = notifications.Take();
+    ADLUTIL_CHECK(1 == received.size());
+
+    if (1 == received.size())
+    {
+        const ADLUtil_AdapterChanges& changes = received[0];
+        ADLUTIL_CHECK(previousGeneration == changes.previousGeneration);
+        ADLUTIL_CHECK(pADLUtils->GetGeneration() == changes.generation);
+        ADLUTIL_CHECK(nullptr != changes.previousList && nullptr != changes.currentList);
+        ADLUTIL_CHECK(static_cast<size_t>(config.gpuCount * config.logicalAdaptersPerGPU) == changes.currentList->size());
+        ADLUTIL_CHECK(added == changes.added);
+        ADLUTIL_CHECK(removed == changes.removed);
+        ADLUTIL_CHECK(changed == changes.changed);
+    }
+}
+
+int main()
+{
+    ADLUtil_StandIn standIn;
+
+    AMDTADLUtils*        pADLUtils = AMDTADLUtils::Instance();
+    ADLStandIn_Config    config = ADLStandIn_GetDefaultConfig();
+    AsicInfoListSnapshot asicInfoList;
+    Notifications        notifications;
+    Notifications        unsubscribed;
+
+    uint64_t subscriptionID = ADLUtil_Subscribe([&notifications](const ADLUtil_AdapterChanges& changes)
+    {
+        std::lock_guard<std::mutex> lock(notifications.mutex);
+        notifications.changes.push_back(changes);
+    });
+
+    uint64_t unsubscribedID = ADLUtil_Subscribe([&unsubscribed](const ADLUtil_AdapterChanges& changes)
+    {
+        std::lock_guard<std::mutex> lock(unsubscribed.mutex);
+        unsubscribed.changes.push_back(changes);
+    });
+
+    ADLUTIL_CHECK(subscriptionID != unsubscribedID);
+
+    // the first enumeration publishes every adapter as added
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(asicInfoList));
+    ADLUTIL_CHECK(1 == pADLUtils->GetGeneration());
+
+    std::vector<ADLUtil_AdapterChanges> received = notifications.Take();
+    ADLUTIL_CHECK(1 == received.size() && 0 == received[0].previousGeneration && nullptr == received[0].previousList);
+    ADLUTIL_CHECK(1 == received.size() && (AdapterIndices{0, 1}) == received[0].added);
+    ADLUTIL_CHECK(1 == unsubscribed.Take().size());
+
+    // the same adapters keep the generation and notify nobody
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->Refresh());
+    ADLUTIL_CHECK(1 == pADLUtils->GetGeneration());
+    ADLUTIL_CHECK(notifications.Take().empty());
+
+    // a third GPU is added behind the others, then removed again
+    config.gpuCount = 3;
+    CheckRefresh(standIn, config, notifications, {2}, {}, {});
+
+    config.gpuCount = 2;
+    CheckRefresh(standIn, config, notifications, {}, {2}, {});
+
+    // renamed adapters keep their PCI location and UDID, so they are changed rather than replaced
+    config.renameAdapters = true;
+    CheckRefresh(standIn, config, notifications, {}, {}, {{0, 0}, {1, 1}});
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(asicInfoList));
+    ADLUTIL_CHECK(2 == asicInfoList->size() && "ADL Stand-In GPU 1 (Renamed)" == std::string((*asicInfoList)[1].adapterName));
+
+    // the UDID identifies an adapter, so a UDID without its revision is another adapter at the same location
+    config.omitRevision = true;
+    CheckRefresh(standIn, config, notifications, {0, 1}, {0, 1}, {});
+
+    // a second logical adapter per GPU renumbers the adapters; the UDIDs end in the adapter index, so only the first
+    // adapter keeps its UDID, and the adapter of the second GPU is replaced
+    config.logicalAdaptersPerGPU = 2;
+    CheckRefresh(standIn, config, notifications, {1, 2, 3}, {1}, {});
+
+    // every change so far reached the second subscriber as well; once unsubscribed it hears of no further generation
+    ADLUTIL_CHECK(5 == unsubscribed.Take().size());
+    ADLUtil_Unsubscribe(unsubscribedID);
+
+    config.gpuCount = 4;
+    CheckRefresh(standIn, config, notifications, {4, 5, 6, 7}, {}, {});
+    ADLUTIL_CHECK(unsubscribed.Take().empty());
+
+    // unsubscribing twice is harmless
+    ADLUtil_Unsubscribe(unsubscribedID);
+    ADLUtil_Unsubscribe(subscriptionID);
+
+    config.gpuCount = 1;
+    standIn.Configure(config);
+    ADLUTIL_CHECK(ADL_WARNING == pADLUtils->Refresh());
+    ADLUTIL_CHECK(ADL_WARNING == pADLUtils->GetAsicInfoList(asicInfoList));
+    ADLUTIL_CHECK(2 == asicInfoList->size());
+    ADLUTIL_CHECK(notifications.Take().empty());
+    ADLUTIL_CHECK(unsubscribed.Take().empty());
+
+    return ADLUtil_GetTestExitCode();
+}
@@ -0,0 +1,95 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests that a profile recorded against the stand-in library replays the same adapters, versions and telemetry
+///         without loading the library, with and without the recorded latencies.
+//==============================================================================
+
+#include <chrono>
+#include <cstdio>
+
+#include "ADLUtilEntrypoints.h"
+#include "ADLUtilTest.h"
+
+// The profile of the test, in the working directory of the test
+static const char* const s_profilePath = "adl_util_test_replay.adlr";
+
+// The latency of every stand-in entry point while recording
+static constexpr uint32_t s_latencyUs = 20000;
+
+// @returns the VRAM usage of an adapter, -1 if the call failed.
+static int GetVRAMUsage(int adapterIndex)
+{
+    AMDTADLUtils*       pADLUtils = AMDTADLUtils::Instance();
+    AMDTADLUtils::Lease lease;
+    int                 vramUsageMB = -1;
+
+    if (ADL_SUCCESS == pADLUtils->AcquireLease(lease) &&
+        ADL_OK != pADLUtils->Call<ADLUtil_Entrypoint::ADL2_Adapter_VRAMUsage_Get>(static_cast<ADL_CONTEXT_HANDLE>(pADLUtils->GetContext()), adapterIndex, &vramUsageMB))
+    {
+        vramUsageMB = -1;
+    }
+
+    return vramUsageMB;
+}
+
+int main()
+{
+    ADLUtil_StandIn standIn;
+    AMDTADLUtils*   pADLUtils = AMDTADLUtils::Instance();
+
+    remove(s_profilePath);
+
+    // record an enumeration, the versions and a telemetry call of four GPUs with two logical adapters each; the stand-in
+    // reports 512 MB of VRAM usage per GPU number
+    ADLStandIn_Config config = ADLStandIn_GetDefaultConfig();
+    config.gpuCount = 4;
+    config.logicalAdaptersPerGPU = 2;
+    config.latencyUs = s_latencyUs;
+    standIn.Configure(config);
+    pADLUtils->SetRecordPath(s_profilePath);
+
+    AsicInfoList         recordedList;
+    ADLUtil_VersionsInfo recordedVersions;
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(recordedList) && 8 == recordedList.size());
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetVersionsInfo(recordedVersions));
+    ADLUTIL_CHECK(4 * 512 == GetVRAMUsage(recordedList.empty() ? 0 : recordedList.back().adapterIndex));
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->Unload());
+    pADLUtils->SetRecordPath("");
+
+    // replay it against a stand-in that would report something else, and that must not be loaded
+    standIn.Configure(ADLStandIn_GetDefaultConfig());
+    pADLUtils->SetReplayPath(s_profilePath);
+
+    AsicInfoList         replayedList;
+    ADLUtil_VersionsInfo replayedVersions;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(replayedList));
+    ADLUTIL_CHECK(std::chrono::microseconds(s_latencyUs) > std::chrono::steady_clock::now() - start);
+    ADLUTIL_CHECK(recordedList.size() == replayedList.size());
+
+    for (size_t i = 0; i < recordedList.size() && i < replayedList.size(); ++i)
+    {
+        ADLUTIL_CHECK(recordedList[i].udid == replayedList[i].udid && recordedList[i].adapterName == replayedList[i].adapterName);
+        ADLUTIL_CHECK(recordedList[i].adapterIndex == replayedList[i].adapterIndex && recordedList[i].gpuIndex == replayedList[i].gpuIndex);
+    }
+
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetVersionsInfo(replayedVersions));
+    ADLUTIL_CHECK(recordedVersions.driverVersion == replayedVersions.driverVersion);
+    ADLUTIL_CHECK(4 * 512 == GetVRAMUsage(replayedList.empty() ? 0 : replayedList.back().adapterIndex));
+    ADLUTIL_CHECK(0 == standIn.GetCounters().createCount);
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->Unload());
+
+    // with the recorded latencies, the count and the adapter info calls take as long as they did
+    pADLUtils->SetReplayPath(s_profilePath, true);
+    start = std::chrono::steady_clock::now();
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(replayedList) && 8 == replayedList.size());
+    ADLUTIL_CHECK(std::chrono::microseconds(2 * s_latencyUs) <= std::chrono::steady_clock::now() - start);
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->Unload());
+
+    pADLUtils->SetReplayPath("");
+    remove(s_profilePath);
+
+    return ADLUtil_GetTestExitCode();
+}
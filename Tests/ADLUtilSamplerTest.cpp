@@ -0,0 +1,106 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests the telemetry sampler against the synthetic counters of the stand-in library.
+//==============================================================================
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "ADLUtilSampler.h"
+#include "ADLUtilTest.h"
+
+// Rate of the sampler, high enough that the spin window must be clamped to the period
+static constexpr unsigned int s_rateHz = 2000;
+
+int main()
+{
+    ADLUtil_StandIn standIn;
+
+    ADLStandIn_Config config = ADLStandIn_GetDefaultConfig();
+    config.gpuCount = 2;
+    config.logicalAdaptersPerGPU = 2;
+    standIn.Configure(config);
+
+    ADLUtil_TelemetrySampler                   sampler;
+    std::shared_ptr<ADLUtil_TelemetryConsumer> consumer = sampler.AddConsumer(1 << 16);
+    std::shared_ptr<ADLUtil_TelemetryConsumer> smallConsumer = sampler.AddConsumer(4);
+
+    uint64_t startNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    ADLUTIL_CHECK(ADL_SUCCESS == sampler.Start(s_rateHz));
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    // a consumer added while sampling starts receiving samples with the next tick
+    std::shared_ptr<ADLUtil_TelemetryConsumer> lateConsumer = sampler.AddConsumer(1 << 16);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    sampler.RemoveConsumer(lateConsumer);
+
+    sampler.Stop();
+    uint64_t stopNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    uint64_t tickCount = sampler.GetTickCount();
+    ADLUTIL_CHECK(0 < tickCount);
+
+    // the logical adapters of a GPU are sampled once, through the first of them
+    std::vector<ADLUtil_TelemetrySample> samples;
+    ADLUtil_TelemetrySample              sample;
+
+    while (consumer->TryPop(sample))
+    {
+        samples.push_back(sample);
+    }
+
+    ADLUTIL_CHECK(2 * tickCount == samples.size());
+    ADLUTIL_CHECK(0 == consumer->GetOverrunCount());
+
+    uint64_t lastTimestampNs = 0;
+
+    for (size_t i = 0; i < samples.size(); ++i)
+    {
+        const ADLUtil_TelemetrySample& gpuSample = samples[i];
+        int                            gpu = static_cast<int>(gpuSample.physicalGPU);
+
+        ADLUTIL_CHECK(i / 2 == gpuSample.tick && i % 2 == gpuSample.physicalGPU);
+        ADLUTIL_CHECK(gpu * 2 == gpuSample.adapterIndex);
+        ADLUTIL_CHECK(45000 + gpu * 1000 == gpuSample.temperature);
+        ADLUTIL_CHECK(1200 + gpu * 100 == gpuSample.fanSpeedRPM);
+        ADLUTIL_CHECK(512 * (gpu + 1) == gpuSample.vramUsageMB);
+        ADLUTIL_CHECK(130000 + gpu * 1000 == gpuSample.engineClock);
+        ADLUTIL_CHECK(0 <= gpuSample.activityPercent && 100 >= gpuSample.activityPercent);
+
+        // each sample carries the time its GPU was read, so the GPUs of one tick have distinct, increasing times
+        ADLUTIL_CHECK(startNs <= gpuSample.timestampNs && stopNs >= gpuSample.timestampNs && lastTimestampNs < gpuSample.timestampNs);
+        lastTimestampNs = gpuSample.timestampNs;
+    }
+
+    // ticks are spaced by the period on average; the spin window must not stretch them at this rate
+    if (2 < tickCount)
+    {
+        double meanPeriodNs = static_cast<double>(samples.back().timestampNs - samples.front().timestampNs) / static_cast<double>(tickCount - 1);
+        ADLUTIL_CHECK(0.5e9 / s_rateHz < meanPeriodNs);
+    }
+
+    // a consumer that is not drained keeps its first samples and counts the rest as overruns
+    uint64_t smallCount = 0;
+
+    while (smallConsumer->TryPop(sample))
+    {
+        ++smallCount;
+    }
+
+    ADLUTIL_CHECK(4 == smallCount);
+    ADLUTIL_CHECK(2 * tickCount - 4 == smallConsumer->GetOverrunCount());
+
+    uint64_t lateCount = 0;
+
+    while (lateConsumer->TryPop(sample))
+    {
+        ++lateCount;
+    }
+
+    ADLUTIL_CHECK(0 < lateCount && samples.size() > lateCount);
+
+    return ADLUtil_GetTestExitCode();
+}
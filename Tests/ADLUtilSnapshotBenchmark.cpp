@@ -0,0 +1,70 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  adl_util_bench_snapshot: warm reads of the ASIC list by many threads, through the snapshot getter, the
+///         copying getter and the copy-under-mutex and std::atomic_load schemes they replaced.
+//==============================================================================
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "ADLUtil.h"
+#include "ADLUtilBench.h"
+#include "ADLUtilTest.h"
+
+int main(int argc, char* argv[])
+{
+    ADLUtil_Bench   bench(argc, argv);
+    ADLUtil_StandIn standIn;
+    AMDTADLUtils*   pADLUtils = AMDTADLUtils::Instance();
+
+    ADLStandIn_Config config = ADLStandIn_GetDefaultConfig();
+    config.gpuCount = 4;
+    standIn.Configure(config);
+
+    AsicInfoList asicInfoList;
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetAsicInfoList(asicInfoList));
+
+    // the baseline: every read locks and deep-copies the list
+    std::mutex baselineMutex;
+
+    // the first snapshot implementation: a shared_ptr read with std::atomic_load, which locks a mutex of a pool
+    std::shared_ptr<const AsicInfoList> atomicLoadSnapshot = std::make_shared<const AsicInfoList>(asicInfoList);
+
+    uint32_t maxThreadCount = std::max(std::thread::hardware_concurrency(), 8u);
+
+    for (uint32_t threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2)
+    {
+        std::string suffix = "/threads:" + std::to_string(threadCount);
+
+        bench.RunConcurrent("snapshot" + suffix, threadCount, bench.GetIterations(10.0), [&](uint64_t)
+        {
+            AsicInfoListSnapshot snapshot;
+            pADLUtils->GetAsicInfoList(snapshot);
+        });
+
+        bench.RunConcurrent("copy" + suffix, threadCount, bench.GetIterations(), [&](uint64_t)
+        {
+            AsicInfoList copy;
+            pADLUtils->GetAsicInfoList(copy);
+        });
+
+        bench.RunConcurrent("baseline_copy_under_mutex" + suffix, threadCount, bench.GetIterations(), [&](uint64_t)
+        {
+            std::lock_guard<std::mutex> lock(baselineMutex);
+            AsicInfoList copy = asicInfoList;
+        });
+
+        bench.RunConcurrent("baseline_atomic_load" + suffix, threadCount, bench.GetIterations(10.0), [&](uint64_t)
+        {
+            std::shared_ptr<const AsicInfoList> snapshot = std::atomic_load(&atomicLoadSnapshot);
+        });
+    }
+
+    int benchResult = bench.Finish();
+    return (0 == benchResult) ? ADLUtil_GetTestExitCode() : benchResult;
+}
@@ -0,0 +1,131 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests the sysfs backend against a fake bus/pci/devices and class/drm tree: which devices are enumerated, in
+///         which order, with which DRM card, and that missing IDs are reported as ADL_WARNING.
+//==============================================================================
+
+#include <string>
+#include <string_view>
+
+#include "ADLUtilFakeSysfs.h"
+#include "ADLUtilSysfs.h"
+#include "ADLUtilTest.h"
+
+// @returns true if a path ends with the given name.
+static bool EndsWith(std::string_view path, std::string_view name)
+{
+    return path.size() >= name.size() && path.substr(path.size() - name.size()) == name;
+}
+
+// The AMD display controllers are enumerated in PCI order with their IDs, name and DRM card; other devices are skipped
+static void TestEnumeration()
+{
+    ADLUtil_FakeSysfs sysfs("adl_util_test_sysfs_enumeration");
+
+    ADLUtil_FakePCIDevice namedDevice = ADLUtil_MakeFakeAMDDevice("0000:0a:00.0", "0x73bf");
+    namedDevice.classCode = "0x038000";
+    namedDevice.productName = "AMD Radeon PRO W6800";
+    sysfs.AddDevice(namedDevice);
+    sysfs.AddDevice(ADLUtil_MakeFakeAMDDevice("0001:01:00.0", "0x1234"));
+    sysfs.AddDevice(ADLUtil_MakeFakeAMDDevice("0000:03:00.0", "0x73bf"));
+
+    // the HDMI audio function of the GPU, an Intel GPU and a directory that is no PCI slot
+    ADLUtil_FakePCIDevice audioDevice = ADLUtil_MakeFakeAMDDevice("0000:03:00.1", "0xab28");
+    audioDevice.classCode = "0x040300";
+    sysfs.AddDevice(audioDevice);
+    ADLUtil_FakePCIDevice intelDevice = ADLUtil_MakeFakeAMDDevice("0000:00:02.0", "0x4680");
+    intelDevice.vendor = "0x8086";
+    sysfs.AddDevice(intelDevice);
+    sysfs.AddDevice(ADLUtil_MakeFakeAMDDevice("not-a-slot", "0x73bf"));
+
+    sysfs.AddDRMCard("card1", "0000:03:00.0");
+    sysfs.AddDRMCard("card1-DP-1", "0000:0a:00.0");
+    sysfs.AddDRMCard("card0", "0000:0a:00.0");
+
+    AsicInfoList asicInfoList;
+    ADLUTIL_CHECK(ADL_SUCCESS == ADLUtil_EnumerateSysfsAdapters(sysfs.GetRoot(), asicInfoList));
+    ADLUTIL_CHECK(3 == asicInfoList.size());
+
+    if (3 != asicInfoList.size())
+    {
+        return;
+    }
+
+    ADLUTIL_CHECK(3 == asicInfoList[0].busNumber && 0xa == asicInfoList[1].busNumber && 1 == asicInfoList[2].busNumber);
+    ADLUTIL_CHECK(1 == asicInfoList[2].topology.pciDomain);
+
+    ADLUTIL_CHECK(asicInfoList[0].udid == "PCI_VEN_1002&DEV_73BF&SUBSYS_E3871DA2&REV_C1");
+    ADLUTIL_CHECK(0x1002 == asicInfoList[0].vendorID && 0x73bf == asicInfoList[0].deviceID && 0xc1 == asicInfoList[0].revID);
+    ADLUTIL_CHECK(0xe3871da2 == asicInfoList[0].subsystemID);
+    ADLUTIL_CHECK(asicInfoList[0].family == "Navi 21" && asicInfoList[0].adapterName == "AMD Navi 21");
+    ADLUTIL_CHECK(asicInfoList[1].adapterName == "AMD Radeon PRO W6800");
+    ADLUTIL_CHECK(asicInfoList[2].family.empty() && asicInfoList[2].adapterName == "AMD Radeon Graphics");
+
+    ADLUTIL_CHECK(EndsWith(asicInfoList[0].registryPathExt, "card1") && EndsWith(asicInfoList[1].registryPathExt, "card0"));
+    ADLUTIL_CHECK(asicInfoList[2].registryPathExt.empty());
+    ADLUTIL_CHECK(EndsWith(asicInfoList[0].registryPath, "0000:03:00.0"));
+}
+
+// A device whose IDs cannot all be read is listed, and the enumeration returns ADL_WARNING
+static void TestMissingIDs()
+{
+    ADLUtil_FakeSysfs sysfs("adl_util_test_sysfs_missing_ids");
+
+    ADLUtil_FakePCIDevice device = ADLUtil_MakeFakeAMDDevice("0000:03:00.0", "0x73bf");
+    device.revision.clear();
+    sysfs.AddDevice(device);
+    sysfs.AddDevice(ADLUtil_MakeFakeAMDDevice("0000:04:00.0", "0x73bf"));
+
+    AsicInfoList asicInfoList;
+    ADLUTIL_CHECK(ADL_WARNING == ADLUtil_EnumerateSysfsAdapters(sysfs.GetRoot(), asicInfoList));
+    ADLUTIL_CHECK(2 == asicInfoList.size());
+    ADLUTIL_CHECK(!asicInfoList.empty() && 0x73bf == asicInfoList[0].deviceID && 0 == asicInfoList[0].revID);
+
+    // a tree without PCI devices
+    asicInfoList.clear();
+    ADLUTIL_CHECK(ADL_NOT_FOUND == ADLUtil_EnumerateSysfsAdapters(sysfs.GetRoot() + "/missing", asicInfoList));
+    ADLUTIL_CHECK(asicInfoList.empty());
+}
+
+// AMDTADLUtils with the sysfs backend serves the tree and the module version, and the warning, without loading ADL
+static void TestBackend(ADLUtil_StandIn& standIn)
+{
+    ADLUtil_FakeSysfs sysfs("adl_util_test_sysfs_backend");
+
+    ADLUtil_FakePCIDevice device = ADLUtil_MakeFakeAMDDevice("0000:03:00.0", "0x73bf");
+    device.subsystemDevice.clear();
+    sysfs.AddDevice(device);
+    sysfs.SetDriverVersion("6.10.5");
+
+    AMDTADLUtils* pADLUtils = AMDTADLUtils::Instance();
+    pADLUtils->SetBackend(ADLUtil_Backend::Sysfs);
+    pADLUtils->SetSysfsRoot(sysfs.GetRoot());
+    pADLUtils->Reset();
+
+    AsicInfoList asicInfoList;
+    ADLUTIL_CHECK(ADL_WARNING == pADLUtils->GetAsicInfoList(asicInfoList));
+    ADLUTIL_CHECK(1 == asicInfoList.size());
+
+    ADLUtil_VersionsInfo versionsInfo;
+    ADLUTIL_CHECK(ADL_SUCCESS == pADLUtils->GetVersionsInfo(versionsInfo));
+    ADLUTIL_CHECK("6.10.5" == versionsInfo.driverVersion);
+
+    ADLUTIL_CHECK(0 == standIn.GetCounters().createCount);
+
+    pADLUtils->SetBackend(ADLUtil_Backend::ADL);
+    pADLUtils->SetSysfsRoot("");
+    pADLUtils->Reset();
+}
+
+int main()
+{
+    ADLUtil_StandIn standIn;
+
+    TestEnumeration();
+    TestMissingIDs();
+    TestBackend(standIn);
+
+    return ADLUtil_GetTestExitCode();
+}
@@ -0,0 +1,105 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Checks and stand-in library access shared by the adl_util tests and benchmarks.
+//==============================================================================
+
+#ifndef _ADL_UTIL_TEST_H_
+#define _ADL_UTIL_TEST_H_
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+
+#include "ADLUtil.h"
+#include "ADLUtilLoader.h"
+#include "ADLStandIn.h"
+
+/// Number of failed checks of the test
+inline std::atomic<int>& ADLUtil_GetFailedCheckCount()
+{
+    static std::atomic<int> s_failedCheckCount(0);
+    return s_failedCheckCount;
+}
+
+/// Reports a failed check without stopping the test, so that one run shows every failure
+#define ADLUTIL_CHECK(condition)                                                          \
+    do                                                                                    \
+    {                                                                                     \
+        if (!(condition))                                                                 \
+        {                                                                                 \
+            fprintf(stderr, "%s(%d): check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++ADLUtil_GetFailedCheckCount();                                              \
+        }                                                                                 \
+    } while (false)
+
+/// @returns the exit code of the test: 0 if every check passed.
+inline int ADLUtil_GetTestExitCode()
+{
+    int failedCheckCount = ADLUtil_GetFailedCheckCount().load();
+
+    if (0 != failedCheckCount)
+    {
+        fprintf(stderr, "%d checks failed\n", failedCheckCount);
+    }
+
+    return (0 == failedCheckCount) ? 0 : 1;
+}
+
+//------------------------------------------------------------------------------------
+/// Holds the stand-in ADL library loaded for the duration of a test and points AMDTADLUtils at it.
+/// Its own handle keeps the configuration alive while adl_util loads and unloads the library.
+//------------------------------------------------------------------------------------
+class ADLUtil_StandIn
+{
+public:
+    /// constructor, loads the stand-in library with its default configuration
+    /// @param[in] pLibraryName the stand-in library to load, ADL_STANDIN_LEGACY_LIBRARY for a driver without the ADL2 context
+    explicit ADLUtil_StandIn(const char* pLibraryName = ADL_STANDIN_LIBRARY) :
+        m_libHandle(ADLUtil_LoadLibrary(pLibraryName)),
+        m_pConfigure(nullptr),
+        m_pGetCounters(nullptr)
+    {
+        if (nullptr == m_libHandle)
+        {
+            fprintf(stderr, "cannot load the stand-in library %s\n", pLibraryName);
+            exit(1);
+        }
+
+        m_pConfigure = reinterpret_cast<ADLStandIn_Configure_fn>(ADLUtil_GetProcAddress(m_libHandle, "ADLStandIn_Configure"));
+        m_pGetCounters = reinterpret_cast<ADLStandIn_GetCounters_fn>(ADLUtil_GetProcAddress(m_libHandle, "ADLStandIn_GetCounters"));
+        Configure(ADLStandIn_GetDefaultConfig());
+
+        AMDTADLUtils::Instance()->SetLibraryName(pLibraryName);
+    }
+
+    /// destructor, unloads the stand-in library
+    ~ADLUtil_StandIn()
+    {
+        AMDTADLUtils::Instance()->Unload();
+        ADLUtil_FreeLibrary(m_libHandle);
+    }
+
+    ADLUtil_StandIn(const ADLUtil_StandIn&) = delete;
+    ADLUtil_StandIn& operator=(const ADLUtil_StandIn&) = delete;
+
+    /// Replaces the behavior of the stand-in library and clears its counters
+    /// @param[in] config the behavior
+    void Configure(const ADLStandIn_Config& config) { m_pConfigure(&config); }
+
+    /// @returns the counters of the calls the stand-in library served since it was last configured.
+    ADLStandIn_Counters GetCounters() const
+    {
+        ADLStandIn_Counters counters = {};
+        m_pGetCounters(&counters);
+        return counters;
+    }
+
+private:
+    ADLUtil_LibraryHandle     m_libHandle;    ///< the test's own handle of the stand-in library
+    ADLStandIn_Configure_fn   m_pConfigure;   ///< ADLStandIn_Configure
+    ADLStandIn_GetCounters_fn m_pGetCounters; ///< ADLStandIn_GetCounters
+};
+
+#endif //_ADL_UTIL_TEST_H_
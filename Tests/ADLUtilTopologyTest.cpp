@@ -0,0 +1,135 @@
+//==============================================================================
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+/// @author AMD Developer Tools Team
+/// @file
+/// @brief  Tests that GPUs at the same bus/device/function in two PCI domains are told apart by the physical GPU index,
+///         the topology and the adapter diff, and the CPU affinity read from local_cpulist.
+//==============================================================================
+
+#include <string>
+#include <vector>
+
+#include "ADLUtilFakeSysfs.h"
+#include "ADLUtilPhysicalGPUIndex.h"
+#include "ADLUtilTopology.h"
+#include "ADLUtilTest.h"
+
+// @returns an AMD display controller at the given slot with its link and NUMA attributes
+static ADLUtil_FakePCIDevice MakeDevice(const std::string& slotName, const std::string& numaNode, const std::string& localCPUList)
+{
+    ADLUtil_FakePCIDevice device = ADLUtil_MakeFakeAMDDevice(slotName, "0x73bf");
+    device.linkWidth = "16";
+    device.numaNode = numaNode;
+    device.localCPUList = localCPUList;
+    return device;
+}
+
+// @returns a logical adapter at bus 3, device 0, function 0 of the given PCI domain
+static ADLUtil_ASICInfo MakeAdapter(int pciDomain, int adapterIndex)
+{
+    ADLUtil_ASICInfo asicInfo = {};
+    asicInfo.vendorID = 0x1002;
+    asicInfo.deviceID = 0x73BF;
+    asicInfo.busNumber = 3;
+    asicInfo.adapterIndex = adapterIndex;
+    asicInfo.udid = "PCI_VEN_1002&DEV_73BF&SUBSYS_E3871DA2&REV_C1_4&3&0&0000";
+    asicInfo.topology.pciDomain = pciDomain;
+    return asicInfo;
+}
+
+// Checks that GPUs in two PCI domains are different GPUs with their own topology
+static void TestPCIDomains()
+{
+    ADLUtil_FakeSysfs sysfs("adl_util_test_topology");
+    sysfs.AddDevice(MakeDevice("0000:03:00.0", "0", "0-3"));
+    sysfs.AddDevice(MakeDevice("0001:03:00.0", "1", "4-7"));
+
+    // the same bus/device/function in domains 0 and 1, with two logical adapters each
+    AsicInfoList asicInfoList = {MakeAdapter(0, 0), MakeAdapter(1, 1), MakeAdapter(0, 2), MakeAdapter(1, 3)};
+
+    ADLUtil_PhysicalGPUIndex physicalGPUIndex(asicInfoList);
+    ADLUTIL_CHECK(2 == physicalGPUIndex.GetCount());
+    ADLUTIL_CHECK(0 == physicalGPUIndex.FindByBusLocation(0, 3, 0, 0) && 1 == physicalGPUIndex.FindByBusLocation(1, 3, 0, 0));
+    ADLUTIL_CHECK(ADLUtil_PhysicalGPUIndex::s_notFound == physicalGPUIndex.FindByBusLocation(2, 3, 0, 0));
+    ADLUTIL_CHECK(1 == physicalGPUIndex.GetPCIDomain(1) && 2 == physicalGPUIndex.GetLogicalAdapters(1).size());
+
+    // each GPU gets the topology of its own domain
+    ADLUtil_FillAdapterTopology(sysfs.GetRoot(), asicInfoList);
+    ADLUTIL_CHECK(0 == asicInfoList[0].gpuIndex && 1 == asicInfoList[1].gpuIndex);
+    ADLUTIL_CHECK(0 == asicInfoList[2].gpuIndex && 1 == asicInfoList[3].gpuIndex);
+    ADLUTIL_CHECK(0 == asicInfoList[2].topology.numaNode && 0 == asicInfoList[2].topology.localCPUs[0]);
+    ADLUTIL_CHECK(1 == asicInfoList[3].topology.numaNode && 4 == asicInfoList[3].topology.localCPUs[0]);
+    ADLUTIL_CHECK(1 == asicInfoList[3].topology.pciDomain && 16 == asicInfoList[3].topology.linkWidth);
+
+    // a GPU that moved to another domain is a removed and an added adapter, not the same one
+    AsicInfoList previousList = {MakeAdapter(0, 0)};
+    AsicInfoList currentList = {MakeAdapter(1, 0)};
+
+    ADLUtil_AdapterChanges changes;
+    ADLUtil_DiffAsicInfoLists(previousList, currentList, changes);
+    ADLUTIL_CHECK(1 == changes.added.size() && 1 == changes.removed.size() && changes.changed.empty());
+}
+
+// Checks the CPU affinity of GPUs whose local_cpulist has ranges, single CPUs, CPUs beyond CPU_SETSIZE, a malformed
+// entry or is missing, and of a GPU without a sysfs directory
+static void TestCPUAffinity()
+{
+    ADLUtil_FakeSysfs sysfs("adl_util_test_topology_affinity");
+    sysfs.AddDevice(MakeDevice("0000:01:00.0", "0", "0-3,8-11,16"));
+    sysfs.AddDevice(MakeDevice("0000:02:00.0", "1", "24-25,20,21-22,20"));
+    sysfs.AddDevice(MakeDevice("0000:03:00.0", "0", ""));
+    sysfs.AddDevice(MakeDevice("0000:04:00.0", "0", "0-3,x"));
+    sysfs.AddDevice(MakeDevice("0000:05:00.0", "1", "2,4096-4097"));
+
+    AsicInfoList asicInfoList;
+
+    for (int busNumber = 1; busNumber <= 6; ++busNumber)
+    {
+        ADLUtil_ASICInfo asicInfo = MakeAdapter(0, busNumber - 1);
+        asicInfo.busNumber = busNumber;
+        asicInfoList.push_back(asicInfo);
+    }
+
+    ADLUtil_FillAdapterTopology(sysfs.GetRoot(), asicInfoList);
+
+    std::vector<uint32_t> cpus;
+
+    // ranges and single CPUs, in any order and overlapping, come back sorted and without duplicates
+    ADLUTIL_CHECK(ADLUtil_GetCPUAffinity(asicInfoList[0], cpus));
+    ADLUTIL_CHECK((std::vector<uint32_t>{0, 1, 2, 3, 8, 9, 10, 11, 16}) == cpus);
+    ADLUTIL_CHECK(ADLUtil_GetCPUAffinity(asicInfoList[1], cpus));
+    ADLUTIL_CHECK((std::vector<uint32_t>{20, 21, 22, 24, 25}) == cpus);
+
+    // without local_cpulist, with a malformed one or without a sysfs directory any CPU is as good as another
+    for (size_t adapter : {2, 3, 5})
+    {
+        cpus.assign(1, 0);
+        ADLUTIL_CHECK(!ADLUtil_GetCPUAffinity(asicInfoList[adapter], cpus));
+        ADLUTIL_CHECK(cpus.empty());
+    }
+
+    ADLUTIL_CHECK(ADLUtil_GetCPUAffinity(asicInfoList[4], cpus));
+    ADLUTIL_CHECK((std::vector<uint32_t>{2, 4096, 4097}) == cpus);
+
+#ifdef __linux__
+    cpu_set_t cpuSet;
+
+    ADLUTIL_CHECK(ADLUtil_GetCPUAffinity(asicInfoList[0], cpuSet));
+    ADLUTIL_CHECK(9 == CPU_COUNT(&cpuSet) && CPU_ISSET(16, &cpuSet) && !CPU_ISSET(4, &cpuSet));
+
+    // CPUs beyond CPU_SETSIZE do not fit the set and are left out
+    ADLUTIL_CHECK(ADLUtil_GetCPUAffinity(asicInfoList[4], cpuSet));
+    ADLUTIL_CHECK(1 == CPU_COUNT(&cpuSet) && CPU_ISSET(2, &cpuSet));
+
+    ADLUTIL_CHECK(!ADLUtil_GetCPUAffinity(asicInfoList[2], cpuSet));
+    ADLUTIL_CHECK(0 == CPU_COUNT(&cpuSet));
+#endif
+}
+
+int main()
+{
+    TestPCIDomains();
+    TestCPUAffinity();
+
+    return ADLUtil_GetTestExitCode();
+}